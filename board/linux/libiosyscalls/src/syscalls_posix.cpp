@@ -49,6 +49,7 @@ namespace
         __REAL_DECL(fchmod);
         __REAL_DECL(fsync);
         __REAL_DECL(fdatasync);
+        __REAL_DECL(ftruncate);
 
 #if __GLIBC__ > 2 || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 33))
         __REAL_DECL(stat);
@@ -103,6 +104,7 @@ namespace
         __REAL_DLSYM(fchmod);
         __REAL_DLSYM(fsync);
         __REAL_DLSYM(fdatasync);
+        __REAL_DLSYM(ftruncate);
 
 #if __GLIBC__ > 2 || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 33))
         __REAL_DLSYM(stat);
@@ -135,8 +137,8 @@ namespace
 
         if (!(real::link && real::unlink && real::rmdir && real::symlink && real::fcntl && real::chdir &&
               real::fchdir && real::getcwd && real::getwd && real::get_current_dir_name && real::mkdir && real::chmod &&
-              real::fchmod && real::fsync && real::fdatasync && real::read && real::write && real::lseek &&
-              real::lseek64 && real::mount && real::umount && real::ioctl && real::poll && real::statvfs
+              real::fchmod && real::fsync && real::fdatasync && real::ftruncate && real::read && real::write &&
+              real::lseek && real::lseek64 && real::mount && real::umount && real::ioctl && real::poll && real::statvfs
 #if __GLIBC__ > 2 || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 28))
               && real::fcntl64
 #endif
@@ -509,6 +511,19 @@ extern "C"
     }
     __asm__(".symver _iosys_fdatasync,fdatasync@GLIBC_2.2.5");
 
+    int _iosys_ftruncate(int fd, off_t length)
+    {
+        if (vfs::is_image_fd(fd)) {
+            TRACE_SYSCALLN("(%d) -> VFS", fd);
+            return vfs::invoke_fs(&fs::ftruncate, vfs::to_image_fd(fd), length);
+        }
+        else {
+            TRACE_SYSCALLN("(%d) -> linux fs", fd);
+            return real::ftruncate(fd, length);
+        }
+    }
+    __asm__(".symver _iosys_ftruncate,ftruncate@GLIBC_2.2.5");
+
     int _iosys_symlink(const char *target, const char *linkpath)
     {
         if (vfs::redirect_to_image(target)) {
@@ -119,6 +119,10 @@ extern "C"
     {
         return syscalls::fsync(_REENT->_errno, fd);
     }
+    int ftruncate(int fd, off_t length)
+    {
+        return syscalls::ftruncate(_REENT->_errno, fd, length);
+    }
     int statvfs(const char *path, struct statvfs *buf)
     {
         return syscalls::statvfs(_REENT->_errno, path, buf);
@@ -36,6 +36,13 @@ else()
     set(PROF_ON 0 CACHE INTERNAL "")
 endif()
 
+option(BUS_TRACE "BUS_TRACE" OFF)
+if(${BUS_TRACE} STREQUAL "ON")
+    set(BUS_TRACE_ENABLED 1 CACHE INTERNAL "")
+else()
+    set(BUS_TRACE_ENABLED 0 CACHE INTERNAL "")
+endif()
+
 # add CurrentMeasurement enable option
 option(CURRENT_MEASUREMENT "CURRENT_MEASUREMENT" OFF)
 
@@ -85,5 +92,6 @@ set(PROJECT_CONFIG_DEFINITIONS
         LOG_LUART_ENABLED=${LOG_LUART_ENABLED}
         MAGIC_ENUM_RANGE_MAX=256
         PROF_ON=${PROF_ON}
+        BUS_TRACE_ENABLED=${BUS_TRACE_ENABLED}
         CACHE INTERNAL ""
         )
@@ -106,6 +106,9 @@ namespace app
         connect(typeid(AppRefreshMessage),
                 [this](sys::Message *msg) -> sys::MessagePointer { return handleAppRefresh(msg); });
         connect(sevm::BatteryStatusChangeMessage(), [&](sys::Message *) { return handleBatteryStatusChange(); });
+        // Battery status is read from the store on every notification, so only the latest one matters.
+        mailbox.setRule(typeid(sevm::BatteryStatusChangeMessage),
+                        {sys::MailboxLane::Background, sys::MailboxPolicy::Coalesce});
         connect(typeid(app::manager::DOMRequest),
                 [&](sys::Message *msg) -> sys::MessagePointer { return handleGetDOM(msg); });
         connect(typeid(AppUpdateWindowMessage),
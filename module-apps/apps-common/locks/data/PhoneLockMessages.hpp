@@ -83,6 +83,12 @@ namespace locks
         {
             return isFirstData;
         }
+
+        /// Only the latest time is shown, unless the queued update is the first one which rebuilds the view
+        [[nodiscard]] bool supersedes(const sys::Message &queued) const noexcept override
+        {
+            return isFirstData || !static_cast<const PhoneLockTimeUpdate &>(queued).isFirstData;
+        }
     };
 
     class NextPhoneUnlockAttemptLockTime : public sys::DataMessage
@@ -48,15 +48,21 @@ namespace audio
         return currentOperation->SetInputGain(gainToSet);
     }
 
+    audio::RetCode Audio::SetLoudnessGain(float gain_dB)
+    {
+        return currentOperation->SetLoudnessGain(gain_dB);
+    }
+
     audio::RetCode Audio::Start(Operation::Type op,
                                 audio::Token token,
                                 const std::string &filePath,
                                 const audio::PlaybackType &playbackType,
-                                const audio::PlaybackMode &playbackMode)
+                                const audio::PlaybackMode &playbackMode,
+                                const audio::RecordingFormat &recordingFormat)
     {
 
         try {
-            auto ret = Operation::Create(op, filePath, playbackType, playbackMode, serviceCallback);
+            auto ret = Operation::Create(op, filePath, playbackType, playbackMode, serviceCallback, recordingFormat);
             switch (op) {
             case Operation::Type::Playback:
                 currentState = State::Playback;
@@ -51,6 +51,9 @@ namespace audio
         // Range 0-10
         audio::RetCode SetInputGain(Gain gain);
 
+        // Loudness normalization offset of the played file in dB
+        audio::RetCode SetLoudnessGain(float gain_dB);
+
         Volume GetOutputVolume()
         {
             return currentOperation->GetOutputVolume();
@@ -95,10 +98,11 @@ namespace audio
 
         // Operations
         virtual audio::RetCode Start(Operation::Type op,
-                                     audio::Token token                      = audio::Token::MakeBadToken(),
-                                     const std::string &filePath             = "",
-                                     const audio::PlaybackType &playbackType = audio::PlaybackType::None,
-                                     const audio::PlaybackMode &playbackMode = audio::PlaybackMode::Single);
+                                     audio::Token token                            = audio::Token::MakeBadToken(),
+                                     const std::string &filePath                   = "",
+                                     const audio::PlaybackType &playbackType       = audio::PlaybackType::None,
+                                     const audio::PlaybackMode &playbackMode       = audio::PlaybackMode::Single,
+                                     const audio::RecordingFormat &recordingFormat = audio::RecordingFormat::Pcm);
 
         virtual audio::RetCode Start();
         virtual audio::RetCode Stop();
@@ -57,6 +57,12 @@ namespace audio
         Loop
     };
 
+    enum class RecordingFormat
+    {
+        Pcm,     ///< 16-bit PCM WAV
+        ImaAdpcm ///< 4-bit IMA ADPCM WAV, a quarter of the PCM size
+    };
+
     enum class PlaybackType
     {
         None,
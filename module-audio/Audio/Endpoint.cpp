@@ -2,6 +2,7 @@
 // For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
 
 #include "Endpoint.hpp"
+#include "StreamTelemetry.hpp"
 
 #include <algorithm>
 #include <vector>
@@ -37,7 +38,7 @@ auto Endpoint::isFormatSupported(const AudioFormat &format) -> bool
     return std::find(std::begin(formats), std::end(formats), format) != std::end(formats);
 }
 
-StreamConnection::StreamConnection(Source *source, Sink *sink, AbstractStream *stream)
+StreamConnection::StreamConnection(Source *source, Sink *sink, AbstractStream *stream, std::string name)
     : _sink(sink), _source(source), _stream(stream)
 {
     assert(_sink != nullptr);
@@ -46,6 +47,10 @@ StreamConnection::StreamConnection(Source *source, Sink *sink, AbstractStream *s
 
     _sink->connectStream(*_stream);
     _source->connectStream(*_stream);
+
+    if (auto buffer = audio::telemetry::findStream(_stream); buffer != nullptr) {
+        audio::telemetry::track(this, std::move(name), *buffer);
+    }
 }
 
 StreamConnection::~StreamConnection()
@@ -55,6 +60,7 @@ StreamConnection::~StreamConnection()
 
 void StreamConnection::destroy()
 {
+    audio::telemetry::untrack(this);
     disable();
     _sink->disconnectStream();
     _source->disconnectStream();
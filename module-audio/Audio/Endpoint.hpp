@@ -8,6 +8,7 @@
 
 #include <chrono>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include <cstdint>
@@ -97,7 +98,8 @@ namespace audio
     {
       public:
         StreamConnection() = default;
-        StreamConnection(Source *source, Sink *sink, AbstractStream *stream);
+        /// @param name - name of the connection in the stream telemetry
+        StreamConnection(Source *source, Sink *sink, AbstractStream *stream, std::string name = "stream");
         ~StreamConnection();
 
         void enable();
@@ -0,0 +1,72 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include "PcmKernels.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+/// @brief Saturating int16 PCM kernels used by the mixer, on top of the PCM kernels.
+namespace audio::mix
+{
+    using pcm::Gain;
+    using pcm::gainShift;
+    using pcm::maxScaleGain;
+    using pcm::saturate;
+    using pcm::scale;
+    using pcm::unityGain;
+
+    /// @brief Adds scaled input to the output, both interleaved int16 samples.
+    /// @param out - accumulated samples
+    /// @param in - samples to add
+    /// @param samples - number of samples (not frames) in both buffers
+    /// @param gain - Q15 gain applied to the input, in range [0, unityGain]
+    inline void accumulate(std::int16_t *__restrict out,
+                           const std::int16_t *__restrict in,
+                           std::size_t samples,
+                           Gain gain) noexcept
+    {
+        if (gain == unityGain) {
+            pcm::addSaturate(out, in, samples);
+        }
+        else {
+            pcm::addScaled(out, in, samples, gain);
+        }
+    }
+
+    /// @brief Adds input to the output with the gain ramping linearly from gainStart to gainEnd over the buffer.
+    inline void accumulateRamp(std::int16_t *__restrict out,
+                               const std::int16_t *__restrict in,
+                               std::size_t samples,
+                               Gain gainStart,
+                               Gain gainEnd) noexcept
+    {
+        if (samples == 0) {
+            return;
+        }
+        // Q30 gain keeps the per-sample step accurate for short ramps
+        const std::int32_t start = gainStart * unityGain;
+        const std::int32_t step  = (gainEnd - gainStart) * unityGain / static_cast<std::int32_t>(samples);
+        for (std::size_t i = 0; i < samples; ++i) {
+            const auto gain = (start + step * static_cast<std::int32_t>(i)) >> gainShift;
+            out[i]          = saturate(out[i] + ((in[i] * gain) >> gainShift));
+        }
+    }
+
+    /// @brief Scales samples in place with the gain ramping linearly from gainStart to gainEnd over the buffer.
+    /// @param gainStart, gainEnd - Q15 gains, in range [0, maxScaleGain]
+    inline void scaleRamp(std::int16_t *samples, std::size_t count, Gain gainStart, Gain gainEnd) noexcept
+    {
+        if (count == 0) {
+            return;
+        }
+        const std::int32_t start = gainStart * unityGain;
+        const std::int32_t step  = (gainEnd - gainStart) * unityGain / static_cast<std::int32_t>(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto gain = (start + step * static_cast<std::int32_t>(i)) >> gainShift;
+            samples[i]      = saturate((samples[i] * gain) >> gainShift);
+        }
+    }
+} // namespace audio::mix
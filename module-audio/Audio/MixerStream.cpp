@@ -0,0 +1,383 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "MixerStream.hpp"
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include <algorithm>
+
+using namespace audio;
+
+auto MixerStream::Input::target() const noexcept -> mix::Gain
+{
+    return (gain * duckLevel) >> mix::gainShift;
+}
+
+void MixerStream::Input::rampTo(mix::Gain newTarget, std::size_t blocks) noexcept
+{
+    if (blocks == 0) {
+        current = newTarget;
+        step    = 0;
+        return;
+    }
+
+    step = (newTarget - current) / static_cast<mix::Gain>(blocks);
+    if (step == 0 && newTarget != current) {
+        step = newTarget > current ? 1 : -1;
+    }
+}
+
+auto MixerStream::Input::next() const noexcept -> mix::Gain
+{
+    const auto end = target();
+    if (step > 0) {
+        return std::min(current + step, end);
+    }
+    if (step < 0) {
+        return std::max(current + step, end);
+    }
+    return current;
+}
+
+MixerStream::MixerStream(AudioFormat format, Stream::Allocator &allocator, std::size_t blockSize)
+    : format(format), blockSize(blockSize), mixBuffer(allocator.allocate(blockSize))
+{}
+
+auto MixerStream::addInput(AbstractStream &input, mix::Gain gain) -> std::optional<InputID>
+{
+    const auto traits = input.getOutputTraits();
+    if (traits.blockSize != blockSize || traits.format != format || format.getBitWidth() != 16) {
+        return std::nullopt;
+    }
+
+    LockGuard lock;
+
+    auto slot = std::find_if(inputs.begin(), inputs.end(), [](const auto &in) { return in.stream == nullptr; });
+    if (slot == inputs.end()) {
+        return std::nullopt;
+    }
+
+    const auto id = static_cast<InputID>(std::distance(inputs.begin(), slot));
+    *slot         = Input{};
+    slot->stream  = &input;
+    slot->gain    = gain;
+    if (duckingInput.has_value()) {
+        slot->duckLevel = duckedLevel;
+    }
+    slot->current = slot->target();
+    return id;
+}
+
+void MixerStream::removeInput(InputID id)
+{
+    // blocks are mixed outside of the lock, the input can only be detached once the mixer is done reading it
+    for (;; vTaskDelay(1)) {
+        LockGuard lock;
+
+        if (mixing) {
+            continue;
+        }
+        if (!isValid(id)) {
+            return;
+        }
+
+        auto &input = inputs[id];
+        if (input.peeked) {
+            input.stream->unpeek();
+        }
+        input = Input{};
+
+        if (duckingInput == id) {
+            unduck(std::chrono::milliseconds{0});
+        }
+        return;
+    }
+}
+
+void MixerStream::setGain(InputID id, mix::Gain gain, std::chrono::milliseconds ramp)
+{
+    LockGuard lock;
+
+    if (!isValid(id)) {
+        return;
+    }
+
+    auto &input = inputs[id];
+    input.gain  = std::clamp(gain, mix::Gain{0}, mix::unityGain);
+    input.rampTo(input.target(), rampBlocks(ramp));
+}
+
+void MixerStream::duck(InputID id, mix::Gain level, std::chrono::milliseconds ramp)
+{
+    LockGuard lock;
+
+    if (!isValid(id)) {
+        return;
+    }
+
+    duckingInput      = id;
+    duckedLevel       = std::clamp(level, mix::Gain{0}, mix::unityGain);
+    const auto blocks = rampBlocks(ramp);
+    for (InputID i = 0; i < maxInputs; ++i) {
+        auto &input = inputs[i];
+        if (input.stream == nullptr) {
+            continue;
+        }
+        input.duckLevel = i == id ? mix::unityGain : duckedLevel;
+        input.rampTo(input.target(), blocks);
+    }
+}
+
+void MixerStream::unduck(std::chrono::milliseconds ramp)
+{
+    LockGuard lock;
+
+    duckingInput.reset();
+    const auto blocks = rampBlocks(ramp);
+    for (auto &input : inputs) {
+        if (input.stream == nullptr) {
+            continue;
+        }
+        input.duckLevel = mix::unityGain;
+        input.rampTo(input.target(), blocks);
+    }
+}
+
+auto MixerStream::getInputsCount() const noexcept -> std::size_t
+{
+    return std::count_if(inputs.begin(), inputs.end(), [](const auto &in) { return in.stream != nullptr; });
+}
+
+void MixerStream::registerListener(EventListener *listener)
+{
+    LockGuard lock;
+
+    listeners.push_back(listener);
+}
+
+void MixerStream::unregisterListeners(EventListener *listener)
+{
+    LockGuard lock;
+
+    auto it = std::find(listeners.begin(), listeners.end(), listener);
+    if (it != listeners.end()) {
+        listeners.erase(it);
+    }
+}
+
+bool MixerStream::push(void *, std::size_t)
+{
+    return false;
+}
+
+bool MixerStream::push(const Span &)
+{
+    return false;
+}
+
+bool MixerStream::push()
+{
+    return false;
+}
+
+bool MixerStream::reserve(Span &)
+{
+    return false;
+}
+
+void MixerStream::commit()
+{}
+
+void MixerStream::release()
+{}
+
+bool MixerStream::pop(Span &span)
+{
+    /// sanity - do not store buffers different than internal block size
+    if (span.dataSize != blockSize) {
+        return false;
+    }
+
+    /// peek in progress
+    if (LockGuard lock; peeked) {
+        return false;
+    }
+
+    Span mixed;
+    if (!peek(mixed)) {
+        std::fill(span.data, span.dataEnd(), 0);
+        return false;
+    }
+
+    std::copy(mixed.data, mixed.dataEnd(), span.data);
+    consume();
+    return true;
+}
+
+bool MixerStream::peek(Span &span)
+{
+    Sources sources;
+    std::size_t count = 0;
+    {
+        LockGuard lock;
+
+        /// single block lookahead - the mixed block is held until consumed
+        if (peeked) {
+            span.reset();
+            return false;
+        }
+        if (isEmpty()) {
+            span.reset();
+            broadcastEvent(Event::StreamUnderFlow);
+            return false;
+        }
+
+        count  = takeSources(sources);
+        peeked = true;
+        mixing = true;
+    }
+
+    // the blocks stay peeked in their streams, so that the producers can't overwrite them
+    mixBlock(sources, count);
+
+    LockGuard lock;
+    mixing = false;
+    span   = Span{.data = mixBuffer.get(), .dataSize = blockSize};
+    return true;
+}
+
+void MixerStream::consume()
+{
+    LockGuard lock;
+
+    if (!peeked) {
+        return;
+    }
+
+    for (auto &input : inputs) {
+        if (input.stream == nullptr) {
+            continue;
+        }
+        if (input.peeked) {
+            input.stream->consume();
+            input.peeked = false;
+        }
+        // envelopes run with the output clock, also when the input underflows
+        input.current = input.next();
+        if (input.current == input.target()) {
+            input.step = 0;
+        }
+    }
+    peeked = false;
+
+    if (isEmpty()) {
+        broadcastEvent(Event::StreamEmpty);
+    }
+}
+
+void MixerStream::unpeek()
+{
+    LockGuard lock;
+
+    for (auto &input : inputs) {
+        if (input.peeked) {
+            input.stream->unpeek();
+            input.peeked = false;
+        }
+    }
+    peeked = false;
+}
+
+void MixerStream::reset()
+{
+    LockGuard lock;
+
+    unpeek();
+    for (auto &input : inputs) {
+        if (input.stream != nullptr) {
+            input.stream->reset();
+        }
+    }
+}
+
+auto MixerStream::getInputTraits() const noexcept -> Traits
+{
+    return Traits{.blockSize = blockSize, .format = format};
+}
+
+auto MixerStream::getOutputTraits() const noexcept -> Traits
+{
+    return Traits{.blockSize = blockSize, .format = format};
+}
+
+bool MixerStream::isEmpty() const noexcept
+{
+    return std::all_of(
+        inputs.begin(), inputs.end(), [](const auto &in) { return in.stream == nullptr || in.stream->isEmpty(); });
+}
+
+bool MixerStream::isFull() const noexcept
+{
+    return getInputsCount() != 0 && std::all_of(inputs.begin(), inputs.end(), [](const auto &in) {
+               return in.stream == nullptr || in.stream->isFull();
+           });
+}
+
+auto MixerStream::rampBlocks(std::chrono::milliseconds ramp) const noexcept -> std::size_t
+{
+    const std::size_t bytes = format.microsecondsToBytes(ramp);
+    return (bytes + blockSize - 1) / blockSize;
+}
+
+auto MixerStream::isValid(InputID id) const noexcept -> bool
+{
+    return id < maxInputs && inputs[id].stream != nullptr;
+}
+
+auto MixerStream::takeSources(Sources &sources) -> std::size_t
+{
+    std::size_t count = 0;
+    for (auto &input : inputs) {
+        if (input.stream == nullptr) {
+            continue;
+        }
+
+        Span block;
+        if (!input.stream->peek(block)) {
+            continue;
+        }
+        input.peeked     = true;
+        sources[count++] = Source{.samples  = reinterpret_cast<const std::int16_t *>(block.data),
+                                  .gainFrom = input.current,
+                                  .gainTo   = input.next()};
+    }
+    return count;
+}
+
+void MixerStream::mixBlock(const Sources &sources, std::size_t count)
+{
+    auto out           = reinterpret_cast<std::int16_t *>(mixBuffer.get());
+    const auto samples = blockSize / sizeof(std::int16_t);
+    std::fill(out, out + samples, 0);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto &source = sources[i];
+        if (source.gainFrom == source.gainTo) {
+            if (source.gainFrom != 0) {
+                mix::accumulate(out, source.samples, samples, source.gainFrom);
+            }
+        }
+        else {
+            mix::accumulateRamp(out, source.samples, samples, source.gainFrom, source.gainTo);
+        }
+    }
+}
+
+void MixerStream::broadcastEvent(Event event)
+{
+    for (auto listener : listeners) {
+        listener->onEvent(this, event);
+    }
+}
@@ -0,0 +1,141 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include "AbstractStream.hpp"
+#include "MixKernel.hpp"
+#include "Stream.hpp"
+
+#include <CriticalSectionGuard.hpp>
+
+#include <array>
+#include <chrono>
+#include <list>
+#include <optional>
+
+namespace audio
+{
+    /**
+     * @brief Read side of a stream summing blocks of up to maxInputs input streams.
+     *
+     * Each producer (e.g. a decoder) writes to its own input stream while the sink reads mixed blocks with
+     * peek/consume or pop. An input with no data ready contributes silence, so a block never waits for a slow
+     * producer and its cost is bounded by maxInputs * blockSize samples. Every input has its own gain and can be
+     * ducked while another input is playing, gain changes are applied as linear ramps over whole blocks.
+     * Only 16-bit PCM is supported, all inputs have to share the format and the block size of the mixer.
+     *
+     * The blocks of the inputs are peeked and the gains taken under the lock, the mixing itself runs outside of it.
+     * Reading (peek, pop, consume, unpeek, reset) is up to a single sink, removeInput waits for a block being mixed.
+     */
+    class MixerStream : public AbstractStream
+    {
+      public:
+        using InputID = std::size_t;
+
+        static constexpr auto maxInputs = 4U;
+
+        MixerStream(AudioFormat format, Stream::Allocator &allocator, std::size_t blockSize);
+
+        /**
+         * @brief Adds an input to the mix
+         *
+         * @param input - stream to read from, it has to outlive its registration
+         * @param gain - Q15 gain of the input
+         * @return ID of the input, nullopt if there is no free slot or the stream does not match the mixer
+         */
+        auto addInput(AbstractStream &input, mix::Gain gain = mix::unityGain) -> std::optional<InputID>;
+        /// Detaches the input, the stream is not accessed by the mixer once this returns
+        void removeInput(InputID id);
+
+        /**
+         * @brief Changes the gain of an input
+         *
+         * @param id - input to change
+         * @param gain - Q15 target gain
+         * @param ramp - time to reach the target, rounded up to whole blocks
+         */
+        void setGain(InputID id, mix::Gain gain, std::chrono::milliseconds ramp = std::chrono::milliseconds{0});
+
+        /**
+         * @brief Attenuates all inputs but the one given, e.g. music during a notification tone
+         *
+         * @param id - input which keeps its gain
+         * @param level - Q15 attenuation of the remaining inputs
+         * @param ramp - time to reach the attenuation
+         */
+        void duck(InputID id, mix::Gain level, std::chrono::milliseconds ramp);
+        /**
+         * @brief Restores gains of inputs ducked, done automatically when the ducking input is removed
+         */
+        void unduck(std::chrono::milliseconds ramp);
+
+        [[nodiscard]] auto getInputsCount() const noexcept -> std::size_t;
+
+        void registerListener(EventListener *listener) override;
+        void unregisterListeners(EventListener *listener) override;
+
+        /// writes go to the inputs, the mixer itself can only be read
+        bool push(void *data, std::size_t dataSize) override;
+        bool push(const Span &span) override;
+        bool push() override;
+        bool reserve(Span &span) override;
+        void commit() override;
+        void release() override;
+
+        bool pop(Span &span) override;
+        bool peek(Span &span) override;
+        void consume() override;
+        void unpeek() override;
+        void reset() override;
+
+        [[nodiscard]] auto getInputTraits() const noexcept -> Traits override;
+        [[nodiscard]] auto getOutputTraits() const noexcept -> Traits override;
+        [[nodiscard]] bool isEmpty() const noexcept override;
+        [[nodiscard]] bool isFull() const noexcept override;
+
+      private:
+        using LockGuard = cpp_freertos::CriticalSectionGuard;
+
+        struct Input
+        {
+            AbstractStream *stream = nullptr;
+            mix::Gain gain         = mix::unityGain; ///< set by the user
+            mix::Gain duckLevel    = mix::unityGain;
+            mix::Gain current      = mix::unityGain; ///< gain at the start of the next block
+            mix::Gain step         = 0;              ///< gain change per block, 0 when not ramping
+            bool peeked            = false;
+
+            [[nodiscard]] auto target() const noexcept -> mix::Gain;
+            void rampTo(mix::Gain target, std::size_t blocks) noexcept;
+            /// gain at the end of the next block
+            [[nodiscard]] auto next() const noexcept -> mix::Gain;
+        };
+
+        /// Block of an input taken for mixing with the gains at its start and end
+        struct Source
+        {
+            const std::int16_t *samples = nullptr;
+            mix::Gain gainFrom          = 0;
+            mix::Gain gainTo            = 0;
+        };
+        using Sources = std::array<Source, maxInputs>;
+
+        [[nodiscard]] auto rampBlocks(std::chrono::milliseconds ramp) const noexcept -> std::size_t;
+        [[nodiscard]] auto isValid(InputID id) const noexcept -> bool;
+        /// Peeks the inputs with data, to be called under the lock
+        auto takeSources(Sources &sources) -> std::size_t;
+        void mixBlock(const Sources &sources, std::size_t count);
+        void broadcastEvent(Event event);
+
+        AudioFormat format;
+        std::size_t blockSize;
+        Stream::UniqueStreamBuffer mixBuffer;
+        std::array<Input, maxInputs> inputs;
+        std::optional<InputID> duckingInput;
+        mix::Gain duckedLevel = mix::unityGain;
+        bool peeked           = false;
+        bool mixing           = false;
+        std::list<EventListener *> listeners;
+    };
+} // namespace audio
@@ -19,7 +19,8 @@ namespace audio
                                                  const std::string &filePath,
                                                  const audio::PlaybackType &playbackType,
                                                  const PlaybackMode &playbackMode,
-                                                 AudioServiceMessage::Callback callback)
+                                                 AudioServiceMessage::Callback callback,
+                                                 const RecordingFormat &recordingFormat)
     {
         std::unique_ptr<Operation> inst;
 
@@ -34,7 +35,7 @@ namespace audio
             inst = std::make_unique<RouterOperation>(filePath, callback);
             break;
         case Type::Recorder:
-            inst = std::make_unique<RecorderOperation>(filePath, callback);
+            inst = std::make_unique<RecorderOperation>(filePath, recordingFormat, callback);
             break;
         }
 
@@ -63,7 +63,8 @@ namespace audio
                                                  const std::string &filePath             = "",
                                                  const audio::PlaybackType &operations   = audio::PlaybackType::None,
                                                  const audio::PlaybackMode &playbackMode = audio::PlaybackMode::Single,
-                                                 AudioServiceMessage::Callback callback  = nullptr);
+                                                 AudioServiceMessage::Callback callback  = nullptr,
+                                                 const RecordingFormat &recordingFormat  = RecordingFormat::Pcm);
 
         virtual audio::RetCode Start(audio::Token token)             = 0;
         virtual audio::RetCode Stop()                                = 0;
@@ -75,6 +76,12 @@ namespace audio
 
         virtual Position GetPosition() = 0;
 
+        /// Gain in dB normalizing the loudness of the played file, ignored by operations which don't play files
+        virtual audio::RetCode SetLoudnessGain([[maybe_unused]] float gain_dB)
+        {
+            return audio::RetCode::Ignored;
+        }
+
         Volume GetOutputVolume() const
         {
             return (currentProfile != nullptr) ? currentProfile->GetOutputVolume() : Volume{};
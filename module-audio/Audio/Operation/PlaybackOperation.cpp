@@ -6,11 +6,15 @@
 #include "Audio/decoder/Decoder.hpp"
 #include "Audio/Profiles/Profile.hpp"
 #include "Audio/StreamFactory.hpp"
+#include "Audio/transcode/EqualizerTransform.hpp"
+#include "Audio/transcode/TransformComposite.hpp"
 
 #include "Audio/AudioCommon.hpp"
 
 #include <log/log.hpp>
 
+#include <algorithm>
+
 namespace audio
 {
     using namespace AudioServiceMessage;
@@ -26,15 +30,11 @@ namespace audio
         AddProfile(Profile::Type::PlaybackBluetoothA2DP, playbackType, false);
         AddProfile(Profile::Type::PlaybackLoudspeaker, playbackType, true);
 
+        // in the loop mode the decoder rewinds by itself, the end is reported only for a file without samples
         endOfFileCallback = [this]() {
-            if (this->playbackMode == PlaybackMode::Single) {
-                state          = State::Idle;
-                const auto msg = AudioServiceMessage::EndOfFile(operationToken);
-                serviceCallback(&msg);
-            }
-            else {
-                dec->rewind();
-            }
+            state          = State::Idle;
+            const auto msg = AudioServiceMessage::EndOfFile(operationToken);
+            serviceCallback(&msg);
         };
 
         fileDeletedCallback = [this]() {
@@ -47,6 +47,8 @@ namespace audio
         if (dec == nullptr) {
             throw AudioInitException("Error during initializing decoder", RetCode::FileDoesntExist);
         }
+        dec->setLooping(playbackMode == PlaybackMode::Loop);
+
         auto format = dec->getSourceFormat();
         LOG_DEBUG("Source format: %s", format.toString().c_str());
 
@@ -65,7 +67,7 @@ namespace audio
         // create stream
         StreamFactory streamFactory(playbackTimeConstraint);
         try {
-            dataStreamOut = streamFactory.makeStream(*dec, *audioDevice, currentProfile->getAudioFormat());
+            dataStreamOut = makeOutputStream(streamFactory);
         }
         catch (std::invalid_argument &e) {
             LOG_FATAL("Cannot create audio stream: %s", e.what());
@@ -73,7 +75,8 @@ namespace audio
         }
 
         // create audio connection
-        outputConnection = std::make_unique<StreamConnection>(dec.get(), audioDevice.get(), dataStreamOut.get());
+        outputConnection = std::make_unique<StreamConnection>(
+            dec.get(), audioDevice.get(), dataStreamOut.get(), currentProfile->GetName());
 
         // decoder worker soft start - must be called after connection setup
         dec->startDecodingWorker(endOfFileCallback, fileDeletedCallback);
@@ -89,6 +92,42 @@ namespace audio
         return GetDeviceError(ret);
     }
 
+    auto PlaybackOperation::makeOutputStream(StreamFactory &streamFactory) -> std::unique_ptr<AbstractStream>
+    {
+        using transcode::EqualizerTransform;
+        using transcode::GainTransform;
+
+        const auto format = currentProfile->getAudioFormat();
+        const auto &bands = currentProfile->getEqualizer();
+        std::vector<std::shared_ptr<transcode::Transform>> transforms;
+
+        // music is normalized with the loudness measured by the file indexer, other sounds are played as they are.
+        // The gain is looked up after the playback starts, so the transform starts at the last known gain.
+        loudnessTransform.reset();
+        if (playbackType == PlaybackType::Multimedia && GainTransform::isSupported(format)) {
+            loudnessTransform = std::make_shared<GainTransform>(format, loudnessGain);
+            transforms.push_back(loudnessTransform);
+        }
+
+        // Bluetooth headsets are not equalized by the codec, so the filters run in the stream before SBC encoding
+        if (currentProfile->GetType() == Profile::Type::PlaybackBluetoothA2DP && !EqualizerTransform::isFlat(bands) &&
+            EqualizerTransform::isSupported(format)) {
+            auto equalizer = std::make_shared<EqualizerTransform>(format, bands, EqualizerTransform::LimiterSettings{});
+            LOG_INFO("Software equalizer enabled, %zu bands", equalizer->getActiveBandsCount());
+            transforms.push_back(std::move(equalizer));
+        }
+
+        switch (transforms.size()) {
+        case 0:
+            return streamFactory.makeStream(*dec, *audioDevice, format);
+        case 1:
+            return streamFactory.makeInputTranscodingStream(*dec, *audioDevice, format, std::move(transforms.front()));
+        default:
+            return streamFactory.makeInputTranscodingStream(
+                *dec, *audioDevice, format, std::make_shared<transcode::TransformComposite>(std::move(transforms)));
+        }
+    }
+
     RetCode PlaybackOperation::Stop()
     {
         state = State::Idle;
@@ -146,6 +185,16 @@ namespace audio
         return GetDeviceError(ret);
     }
 
+    RetCode PlaybackOperation::SetLoudnessGain(float gain_dB)
+    {
+        loudnessGain = std::min(gain_dB, transcode::GainTransform::maxGain_dB);
+        LOG_INFO("Loudness normalization gain: %.2f dB", loudnessGain);
+        if (loudnessTransform != nullptr) {
+            loudnessTransform->setGain(loudnessGain);
+        }
+        return RetCode::Success;
+    }
+
     Position PlaybackOperation::GetPosition()
     {
         return dec->getCurrentPosition();
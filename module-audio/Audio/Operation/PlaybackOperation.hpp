@@ -5,9 +5,11 @@
 
 #include "Operation.hpp"
 #include "Audio/Stream.hpp"
+#include "Audio/StreamFactory.hpp"
 #include "Audio/Endpoint.hpp"
 #include "Audio/decoder/DecoderWorker.hpp"
 #include "Audio/decoder/Decoder.hpp"
+#include "Audio/transcode/GainTransform.hpp"
 
 #include <chrono>
 
@@ -33,6 +35,7 @@ namespace audio
         RetCode SwitchProfile(const Profile::Type type) final;
         RetCode SetOutputVolume(float vol) final;
         RetCode SetInputGain(float gain) final;
+        RetCode SetLoudnessGain(float gain_dB) final;
 
         Position GetPosition() final;
         RetCode SwitchToPriorityProfile(PlaybackType playbackType) final;
@@ -40,10 +43,14 @@ namespace audio
       private:
         static constexpr auto playbackTimeConstraint = 10ms;
         PlaybackMode playbackMode                    = PlaybackMode::Single;
+        float loudnessGain                           = 0.0f; ///< dB, offset normalizing the track loudness
 
-        std::unique_ptr<Stream> dataStreamOut;
+        auto makeOutputStream(StreamFactory &streamFactory) -> std::unique_ptr<AbstractStream>;
+
+        std::unique_ptr<AbstractStream> dataStreamOut;
         std::unique_ptr<Decoder> dec;
         std::unique_ptr<StreamConnection> outputConnection;
+        std::shared_ptr<transcode::GainTransform> loudnessTransform;
 
         DecoderWorker::EndOfFileCallback endOfFileCallback;
         DecoderWorker::FileDeletedCallback fileDeletedCallback;
@@ -15,7 +15,9 @@ namespace audio
 
 #define PERF_STATS_ON 0
 
-    RecorderOperation::RecorderOperation(const std::string &filePath, AudioServiceMessage::Callback callback)
+    RecorderOperation::RecorderOperation(const std::string &filePath,
+                                         RecordingFormat recordingFormat,
+                                         AudioServiceMessage::Callback callback)
         : Operation(std::move(callback))
     {
 
@@ -32,7 +34,7 @@ namespace audio
             // LOG_DEBUG("Watermark:%lu",uxTaskGetStackHighWaterMark2(NULL));  M.P: left here on purpose, it's handy
             // during sf tests on hardware
 #endif
-            if (ret == 0) {
+            if (enc->hasOutputFailed()) {
                 state          = State::Idle;
                 const auto req = AudioServiceMessage::FileSystemNoSpace(operationToken);
                 serviceCallback(&req);
@@ -51,6 +53,12 @@ namespace audio
         }
         currentProfile = defaultProfile;
 
+        auto retCode = SwitchToPriorityProfile();
+        if (retCode != RetCode::Success) {
+            throw AudioInitException("Failed to switch audio profile", retCode);
+        }
+
+        // the file format follows the recording profile, not the default one
         std::uint32_t channels = 0;
         if ((currentProfile->GetInOutFlags() & static_cast<std::uint32_t>(audio::codec::Flags::InputLeft)) ||
             (currentProfile->GetInOutFlags() & static_cast<std::uint32_t>(audio::codec::Flags::InputRight))) {
@@ -61,15 +69,11 @@ namespace audio
         }
 
         enc = Encoder::Create(filePath,
-                              Encoder::Format{.chanNr = channels, .sampleRate = currentProfile->GetSampleRate()});
+                              Encoder::Format{.chanNr = channels, .sampleRate = currentProfile->GetSampleRate()},
+                              recordingFormat);
         if (enc == nullptr) {
             throw AudioInitException("Error during initializing encoder", RetCode::InvalidFormat);
         }
-
-        auto retCode = SwitchToPriorityProfile();
-        if (retCode != RetCode::Success) {
-            throw AudioInitException("Failed to switch audio profile", retCode);
-        }
     }
 
     audio::RetCode RecorderOperation::Start(audio::Token token)
@@ -80,6 +84,7 @@ namespace audio
         }
         operationToken = token;
         state          = State::Active;
+        enc->startFlushWorker();
 
         if (audioDevice->isFormatSupportedBySource(currentProfile->getAudioFormat())) {
             auto ret = audioDevice->Start();
@@ -97,8 +102,10 @@ namespace audio
             return RetCode::InvokedInIncorrectState;
         }
 
-        state = State::Idle;
-        return GetDeviceError(audioDevice->Stop());
+        state    = State::Idle;
+        auto ret = audioDevice->Stop();
+        enc->stopFlushWorker();
+        return GetDeviceError(ret);
     }
 
     audio::RetCode RecorderOperation::Pause()
@@ -12,7 +12,9 @@ namespace audio
     class RecorderOperation : public Operation
     {
       public:
-        RecorderOperation(const std::string &filePath, AudioServiceMessage::Callback callback);
+        RecorderOperation(const std::string &filePath,
+                          RecordingFormat recordingFormat,
+                          AudioServiceMessage::Callback callback);
 
         audio::RetCode Start(audio::Token token) final;
         audio::RetCode Stop() final;
@@ -68,10 +68,14 @@ namespace audio
         }
 
         // create audio connections
-        voiceInputConnection =
-            std::make_unique<audio::StreamConnection>(audioDevice.get(), audioDeviceCellular.get(), dataStreamIn.get());
-        voiceOutputConnection = std::make_unique<audio::StreamConnection>(
-            audioDeviceCellular.get(), audioDevice.get(), dataStreamOut.get());
+        voiceInputConnection  = std::make_unique<audio::StreamConnection>(audioDevice.get(),
+                                                                         audioDeviceCellular.get(),
+                                                                         dataStreamIn.get(),
+                                                                         currentProfile->GetName() + " uplink");
+        voiceOutputConnection = std::make_unique<audio::StreamConnection>(audioDeviceCellular.get(),
+                                                                          audioDevice.get(),
+                                                                          dataStreamOut.get(),
+                                                                          currentProfile->GetName() + " downlink");
 
         // enable audio connections
         voiceOutputConnection->enable();
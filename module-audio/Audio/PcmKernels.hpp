@@ -0,0 +1,387 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_FEATURE_SIMD32)
+#include <arm_acle.h>
+#endif
+
+/// @brief PCM kernels shared by the decoders, transforms and the mixer.
+/// Every kernel has a scalar loop the compiler is free to vectorize. The ones on the playback path also have
+/// SSE2 code for the host and use the packed 16-bit instructions of the Cortex-M7, chosen at compile time. These
+/// process whole vectors and leave the remainder to the scalar loop, the results are the same bit for bit.
+namespace audio::pcm
+{
+    /// Gains are Q15 fixed point, unity is 1.0
+    using Gain = std::int32_t;
+
+    inline constexpr unsigned gainShift = 15;
+    inline constexpr Gain unityGain     = Gain{1} << gainShift;
+    /// Highest gain of scale(), a sample multiplied by it still fits in 32 bits
+    inline constexpr Gain maxScaleGain = 2 * unityGain - 1;
+
+    constexpr auto saturate(std::int32_t value) noexcept -> std::int16_t
+    {
+        return static_cast<std::int16_t>(value > INT16_MAX ? INT16_MAX : (value < INT16_MIN ? INT16_MIN : value));
+    }
+
+    namespace detail
+    {
+        template <typename T>
+        inline auto load32(const T *data) noexcept -> std::uint32_t
+        {
+            std::uint32_t word;
+            std::memcpy(&word, data, sizeof(word));
+            return word;
+        }
+
+        template <typename T>
+        inline void store32(T *data, std::uint32_t word) noexcept
+        {
+            std::memcpy(data, &word, sizeof(word));
+        }
+
+#if defined(__SSE2__)
+        inline auto load(const void *data) noexcept -> __m128i
+        {
+            return _mm_loadu_si128(static_cast<const __m128i *>(data));
+        }
+
+        inline void store(void *data, __m128i value) noexcept
+        {
+            _mm_storeu_si128(static_cast<__m128i *>(data), value);
+        }
+
+        /// Sign extends the lower or upper four int16 samples to int32
+        inline auto widenLow(__m128i samples) noexcept -> __m128i
+        {
+            return _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+        }
+
+        inline auto widenHigh(__m128i samples) noexcept -> __m128i
+        {
+            return _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+        }
+
+        /// Q15 products of eight int16 samples with a gain up to maxScaleGain, as two vectors of int32
+        /// Gains above int16 are multiplied as negative ones, the missing multiple of 65536 is added to the high half.
+        inline void multiply(__m128i samples, Gain gain, __m128i &low, __m128i &high) noexcept
+        {
+            const auto factor = _mm_set1_epi16(static_cast<std::int16_t>(gain));
+            const auto lower  = _mm_mullo_epi16(samples, factor);
+            auto upper        = _mm_mulhi_epi16(samples, factor);
+            if (gain > INT16_MAX) {
+                upper = _mm_add_epi16(upper, samples);
+            }
+            low  = _mm_srai_epi32(_mm_unpacklo_epi16(lower, upper), gainShift);
+            high = _mm_srai_epi32(_mm_unpackhi_epi16(lower, upper), gainShift);
+        }
+#endif
+
+        /// Vectorized part of repeat<2>(), returns the number of frames left at the beginning
+        template <typename Frame>
+        inline auto repeatTwice([[maybe_unused]] Frame *out,
+                                [[maybe_unused]] const Frame *in,
+                                std::size_t frames) noexcept -> std::size_t
+        {
+            auto i = frames;
+#if defined(__SSE2__)
+            // a block is read before it is written, the following blocks are read below what has been written
+            if constexpr (sizeof(Frame) == 2 || sizeof(Frame) == 4) {
+                constexpr std::size_t lanes = sizeof(__m128i) / sizeof(Frame);
+                for (; i > frames % lanes; i -= lanes) {
+                    const auto v = load(in + i - lanes);
+                    if constexpr (sizeof(Frame) == 2) {
+                        store(out + 2 * i - 2 * lanes, _mm_unpacklo_epi16(v, v));
+                        store(out + 2 * i - lanes, _mm_unpackhi_epi16(v, v));
+                    }
+                    else {
+                        store(out + 2 * i - 2 * lanes, _mm_unpacklo_epi32(v, v));
+                        store(out + 2 * i - lanes, _mm_unpackhi_epi32(v, v));
+                    }
+                }
+            }
+#elif defined(__ARM_FEATURE_SIMD32)
+            // two samples per word access
+            if constexpr (sizeof(Frame) == 2) {
+                for (; i > frames % 2; i -= 2) {
+                    const auto pair = load32(in + i - 2);
+                    store32(out + 2 * i - 4, (pair & 0xFFFFU) * 0x10001U);
+                    store32(out + 2 * i - 2, (pair >> 16) * 0x10001U);
+                }
+            }
+#endif
+            return i;
+        }
+
+        /// Vectorized part of decimate<2>(), returns the number of frames done
+        template <typename Frame>
+        inline auto decimateTwice([[maybe_unused]] Frame *out,
+                                  [[maybe_unused]] const Frame *in,
+                                  [[maybe_unused]] std::size_t frames) noexcept -> std::size_t
+        {
+            std::size_t i = 0;
+#if defined(__SSE2__)
+            if constexpr (sizeof(Frame) == 2) {
+                for (; i < frames - frames % 8; i += 8) {
+                    // even samples sign extended in place of the pairs, so that packing does not saturate them
+                    const auto even0 = _mm_srai_epi32(_mm_slli_epi32(load(in + 2 * i), 16), 16);
+                    const auto even1 = _mm_srai_epi32(_mm_slli_epi32(load(in + 2 * i + 8), 16), 16);
+                    store(out + i, _mm_packs_epi32(even0, even1));
+                }
+            }
+            else if constexpr (sizeof(Frame) == 4) {
+                for (; i < frames - frames % 4; i += 4) {
+                    const auto even0 = _mm_shuffle_epi32(load(in + 2 * i), _MM_SHUFFLE(3, 1, 2, 0));
+                    const auto even1 = _mm_shuffle_epi32(load(in + 2 * i + 4), _MM_SHUFFLE(3, 1, 2, 0));
+                    store(out + i, _mm_unpacklo_epi64(even0, even1));
+                }
+            }
+#elif defined(__ARM_FEATURE_SIMD32)
+            if constexpr (sizeof(Frame) == 2) {
+                for (; i < frames - frames % 2; i += 2) {
+                    store32(out + i, (load32(in + 2 * i) & 0xFFFFU) | (load32(in + 2 * i + 2) << 16));
+                }
+            }
+#endif
+            return i;
+        }
+    } // namespace detail
+
+    /// @brief Repeats every frame Ratio times, the output may start at the input to convert in place.
+    /// @tparam Ratio - number of copies of a frame
+    /// @tparam Frame - integer type holding all samples of a frame, e.g. std::uint32_t for stereo int16
+    /// @param out - frames * Ratio frames
+    /// @param in - frames to repeat
+    /// @param frames - number of input frames
+    template <unsigned Ratio, typename Frame>
+    inline void repeat(Frame *out, const Frame *in, std::size_t frames) noexcept
+    {
+        static_assert(Ratio > 0);
+        static_assert(std::is_integral_v<Frame>);
+
+        auto i = frames;
+        if constexpr (Ratio == 2) {
+            i = detail::repeatTwice(out, in, frames);
+        }
+        for (; i > 0; i--) {
+            for (unsigned j = 1; j <= Ratio; j++) {
+                out[i * Ratio - j] = in[i - 1];
+            }
+        }
+    }
+
+    /// @brief Keeps the first of every Ratio frames, the output may start at the input to convert in place.
+    /// @tparam Ratio - decimation order
+    /// @tparam Frame - integer type holding all samples of a frame
+    /// @param out - frames output frames
+    /// @param in - frames * Ratio input frames
+    /// @param frames - number of output frames
+    template <unsigned Ratio, typename Frame>
+    inline void decimate(Frame *out, const Frame *in, std::size_t frames) noexcept
+    {
+        static_assert(Ratio > 0);
+        static_assert(std::is_integral_v<Frame>);
+
+        std::size_t i = 0;
+        if constexpr (Ratio == 2) {
+            i = detail::decimateTwice(out, in, frames);
+        }
+        for (; i < frames; ++i) {
+            out[i] = in[i * Ratio];
+        }
+    }
+
+    /// @brief Spreads mono samples over stereo frames, the output may start at the input to convert in place.
+    /// @param out - frames * 2 samples
+    /// @param in - frames samples
+    /// @param frames - number of frames
+    template <typename Sample>
+    inline void monoToStereo(Sample *out, const Sample *in, std::size_t frames) noexcept
+    {
+        repeat<2>(out, in, frames);
+    }
+
+    /// @brief Averages the channels of stereo int16 frames, the output may start at the input to convert in place.
+    /// @param out - frames samples
+    /// @param in - frames * 2 samples
+    /// @param frames - number of frames
+    inline void stereoToMono(std::int16_t *out, const std::int16_t *in, std::size_t frames) noexcept
+    {
+        std::size_t i = 0;
+#if defined(__SSE2__)
+        const auto ones = _mm_set1_epi16(1);
+        for (; i < frames - frames % 8; i += 8) {
+            const auto sum0 = _mm_madd_epi16(detail::load(in + 2 * i), ones);
+            const auto sum1 = _mm_madd_epi16(detail::load(in + 2 * i + 8), ones);
+            detail::store(out + i, _mm_packs_epi32(_mm_srai_epi32(sum0, 1), _mm_srai_epi32(sum1, 1)));
+        }
+#elif defined(__ARM_FEATURE_SIMD32)
+        for (; i < frames; ++i) {
+            const auto frame = static_cast<int16x2_t>(detail::load32(in + 2 * i));
+            out[i]           = static_cast<std::int16_t>(__smuad(frame, 0x10001) >> 1);
+        }
+#endif
+        for (; i < frames; ++i) {
+            out[i] = static_cast<std::int16_t>((in[2 * i] + in[2 * i + 1]) >> 1);
+        }
+    }
+
+    /// @brief Converts int16 samples to float in range [-1, 1).
+    inline void toFloat(float *__restrict out, const std::int16_t *__restrict in, std::size_t samples) noexcept
+    {
+        constexpr float scale = 1.0f / 32768.0f;
+        std::size_t i         = 0;
+#if defined(__SSE2__)
+        const auto factor = _mm_set1_ps(scale);
+        for (; i < samples - samples % 8; i += 8) {
+            const auto v = detail::load(in + i);
+            _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(detail::widenLow(v)), factor));
+            _mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(detail::widenHigh(v)), factor));
+        }
+#endif
+        for (; i < samples; ++i) {
+            out[i] = static_cast<float>(in[i]) * scale;
+        }
+    }
+
+    /// @brief Converts float samples to int16, rounding to the nearest value and saturating the ones out of range.
+    inline void fromFloat(std::int16_t *__restrict out, const float *__restrict in, std::size_t samples) noexcept
+    {
+        constexpr float scale = 32768.0f;
+        constexpr float lower = INT16_MIN;
+        constexpr float upper = INT16_MAX;
+        std::size_t i         = 0;
+#if defined(__SSE2__)
+        const auto factor = _mm_set1_ps(scale);
+        const auto min    = _mm_set1_ps(lower);
+        const auto max    = _mm_set1_ps(upper);
+        for (; i < samples - samples % 8; i += 8) {
+            const auto low  = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(in + i), factor), min), max);
+            const auto high = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(in + i + 4), factor), min), max);
+            detail::store(out + i, _mm_packs_epi32(_mm_cvtps_epi32(low), _mm_cvtps_epi32(high)));
+        }
+#endif
+        for (; i < samples; ++i) {
+            // written as the SSE2 min and max, so that NaN ends up as the lowest value on both paths
+            auto value = in[i] * scale;
+            value      = value > lower ? value : lower;
+            value      = value < upper ? value : upper;
+            out[i]     = static_cast<std::int16_t>(std::lrintf(value));
+        }
+    }
+
+    /// @brief Converts int16 samples to int32 with Shift guard bits below them, e.g. for filtering.
+    template <unsigned Shift>
+    inline void toQ(std::int32_t *__restrict out, const std::int16_t *__restrict in, std::size_t samples) noexcept
+    {
+        static_assert(Shift < 16);
+        std::size_t i = 0;
+#if defined(__SSE2__)
+        for (; i < samples - samples % 8; i += 8) {
+            const auto v = detail::load(in + i);
+            detail::store(out + i, _mm_slli_epi32(detail::widenLow(v), Shift));
+            detail::store(out + i + 4, _mm_slli_epi32(detail::widenHigh(v), Shift));
+        }
+#endif
+        for (; i < samples; ++i) {
+            out[i] = static_cast<std::int32_t>(in[i]) * (1 << Shift);
+        }
+    }
+
+    /// @brief Converts int32 samples with Shift guard bits back to int16, rounding and saturating them.
+    template <unsigned Shift>
+    inline void fromQ(std::int16_t *__restrict out, const std::int32_t *__restrict in, std::size_t samples) noexcept
+    {
+        static_assert(Shift > 0 && Shift < 16);
+        constexpr auto rounding = std::int32_t{1} << (Shift - 1);
+        std::size_t i           = 0;
+#if defined(__SSE2__)
+        const auto round = _mm_set1_epi32(rounding);
+        for (; i < samples - samples % 8; i += 8) {
+            const auto low  = _mm_srai_epi32(_mm_add_epi32(detail::load(in + i), round), Shift);
+            const auto high = _mm_srai_epi32(_mm_add_epi32(detail::load(in + i + 4), round), Shift);
+            detail::store(out + i, _mm_packs_epi32(low, high));
+        }
+#endif
+        for (; i < samples; ++i) {
+            out[i] = saturate((in[i] + rounding) >> Shift);
+        }
+    }
+
+    /// @brief Scales int16 samples in place.
+    /// @param samples - samples to scale
+    /// @param count - number of samples (not frames)
+    /// @param gain - Q15 gain, in range [0, maxScaleGain]
+    inline void scale(std::int16_t *__restrict samples, std::size_t count, Gain gain) noexcept
+    {
+        std::size_t i = 0;
+#if defined(__SSE2__)
+        for (; i < count - count % 8; i += 8) {
+            __m128i low, high;
+            detail::multiply(detail::load(samples + i), gain, low, high);
+            detail::store(samples + i, _mm_packs_epi32(low, high));
+        }
+#endif
+        for (; i < count; ++i) {
+            samples[i] = saturate((samples[i] * gain) >> gainShift);
+        }
+    }
+
+    /// @brief Adds scaled input to the output, both int16 samples.
+    /// @param out - accumulated samples
+    /// @param in - samples to add
+    /// @param samples - number of samples (not frames) in both buffers
+    /// @param gain - Q15 gain applied to the input, in range [0, maxScaleGain]
+    inline void addScaled(std::int16_t *__restrict out,
+                          const std::int16_t *__restrict in,
+                          std::size_t samples,
+                          Gain gain) noexcept
+    {
+        std::size_t i = 0;
+#if defined(__SSE2__)
+        for (; i < samples - samples % 8; i += 8) {
+            __m128i low, high;
+            detail::multiply(detail::load(in + i), gain, low, high);
+            const auto accumulated = detail::load(out + i);
+            low                    = _mm_add_epi32(low, detail::widenLow(accumulated));
+            high                   = _mm_add_epi32(high, detail::widenHigh(accumulated));
+            detail::store(out + i, _mm_packs_epi32(low, high));
+        }
+#endif
+        for (; i < samples; ++i) {
+            out[i] = saturate(out[i] + ((in[i] * gain) >> gainShift));
+        }
+    }
+
+    /// @brief Adds the input to the output, saturating the sums.
+    inline void addSaturate(std::int16_t *__restrict out,
+                            const std::int16_t *__restrict in,
+                            std::size_t samples) noexcept
+    {
+        std::size_t i = 0;
+#if defined(__SSE2__)
+        for (; i < samples - samples % 8; i += 8) {
+            detail::store(out + i, _mm_adds_epi16(detail::load(out + i), detail::load(in + i)));
+        }
+#elif defined(__ARM_FEATURE_SIMD32)
+        for (; i < samples - samples % 2; i += 2) {
+            const auto sum = __qadd16(static_cast<int16x2_t>(detail::load32(out + i)),
+                                      static_cast<int16x2_t>(detail::load32(in + i)));
+            detail::store32(out + i, static_cast<std::uint32_t>(sum));
+        }
+#endif
+        for (; i < samples; ++i) {
+            out[i] = saturate(out[i] + in[i]);
+        }
+    }
+} // namespace audio::pcm
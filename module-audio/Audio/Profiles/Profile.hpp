@@ -114,6 +114,11 @@ namespace audio
             return AudioFormat(audioConfiguration.sampleRate_Hz, audioConfiguration.bitWidth, channels);
         }
 
+        auto getEqualizer() const noexcept -> const audio::equalizer::Equalizer &
+        {
+            return audioConfiguration.filterCoefficients;
+        }
+
         const std::string &GetName() const
         {
             return name;
@@ -1,4 +1,4 @@
-// Copyright (c) 2017-2024, Mudita Sp. z.o.o. All rights reserved.
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
 
 #pragma once
@@ -12,17 +12,28 @@ namespace audio
     {
       public:
         ProfilePlaybackBluetoothA2DP(Volume volume)
-            : Profile("Playback Bluetooth A2DP",
-                      Type::PlaybackBluetoothA2DP,
-                      audio::codec::Configuration{.sampleRate_Hz = 44100,
-                                                  .bitWidth      = 16,
-                                                  .flags         = 0,
-                                                  .outputVolume  = static_cast<float>(volume),
-                                                  .inputGain     = 0,
-                                                  .inputPath     = audio::codec::InputPath::None,
-                                                  .outputPath    = audio::codec::OutputPath::None},
-                      AudioDevice::Type::BluetoothA2DP)
-        {}
+            : Profile(
+                  "Playback Bluetooth A2DP",
+                  Type::PlaybackBluetoothA2DP,
+                  purefs::dir::getSystemDataDirPath() / "equalizer/bluetooth_a2dp_playback.json",
+                  audio::codec::Configuration{
+                      .sampleRate_Hz = 44100,
+                      .bitWidth      = 16,
+                      .flags         = 0,
+                      .outputVolume  = 0,
+                      .inputGain     = 0,
+                      .inputPath     = audio::codec::InputPath::None,
+                      .outputPath    = audio::codec::OutputPath::None,
+                      .filterCoefficients =
+                          {qfilter_CalculateCoeffs(audio::equalizer::FilterType::None, 60.0f, 44100, 0.701f, 0),
+                           qfilter_CalculateCoeffs(audio::equalizer::FilterType::None, 250.0f, 44100, 0.701f, 0),
+                           qfilter_CalculateCoeffs(audio::equalizer::FilterType::None, 1000.0f, 44100, 0.701f, 0),
+                           qfilter_CalculateCoeffs(audio::equalizer::FilterType::None, 4000.0f, 44100, 0.701f, 0),
+                           qfilter_CalculateCoeffs(audio::equalizer::FilterType::None, 12000.0f, 44100, 0.701f, 0)}},
+                  AudioDevice::Type::BluetoothA2DP)
+        {
+            audioConfiguration.outputVolume = static_cast<float>(volume);
+        }
     };
 
 } // namespace audio
@@ -3,18 +3,31 @@
 
 #include "Stream.hpp"
 
+#include <macros.h>
+#include <ticks.hpp>
+
 #include <algorithm>
 #include <iterator>
 
 using namespace audio;
 
+namespace
+{
+    auto now() -> StreamMetrics::Timestamp
+    {
+        const auto ticks = isIRQ() ? cpp_freertos::Ticks::GetTicksFromISR() : cpp_freertos::Ticks::GetTicks();
+        return static_cast<StreamMetrics::Timestamp>(cpp_freertos::Ticks::TicksToMs(ticks));
+    }
+} // namespace
+
 Stream::Stream(AudioFormat format, Allocator &allocator, std::size_t blockSize, unsigned int bufferingSize)
     : _allocator(allocator), _blockSize(blockSize), _blockCount(bufferingSize), _format(format),
       _buffer(_allocator.allocate(_blockSize * _blockCount)), _emptyBuffer(_allocator.allocate(_blockSize)),
-      _dataStart(_buffer.get(), _blockSize * _blockCount, _buffer.get(), _blockSize), _dataEnd(_dataStart),
-      _peekPosition(_dataStart), _writeReservationPosition(_dataStart)
+      _metrics(_blockCount), _dataStart(_buffer.get(), _blockSize * _blockCount, _buffer.get(), _blockSize),
+      _dataEnd(_dataStart), _peekPosition(_dataStart), _writeReservationPosition(_dataStart)
 {
     std::fill(_emptyBuffer.get(), _emptyBuffer.get() + blockSize, 0);
+    _metrics.reset(now());
 }
 
 bool Stream::push(void *data, std::size_t dataSize)
@@ -39,6 +52,7 @@ bool Stream::push(const Span &span)
 
     /// no space left
     if (isFull()) {
+        _metrics.onOverrun(_blocksUsed);
         broadcastEvent(Event::StreamOverflow);
         return false;
     }
@@ -49,6 +63,7 @@ bool Stream::push(const Span &span)
     _dataEnd++;
     _blocksUsed++;
     _writeReservationPosition = _dataEnd;
+    _metrics.onWrite(now());
 
     broadcastStateEvents();
 
@@ -77,11 +92,13 @@ bool Stream::pop(Span &span)
 
     if (isEmpty()) {
         span = getNullSpan();
+        _metrics.onUnderrun(now());
         broadcastEvent(Event::StreamUnderFlow);
         return false;
     }
 
     std::copy((*_dataStart).data, (*_dataStart).dataEnd(), span.data);
+    _metrics.onRead(_blocksUsed, now());
 
     _dataStart++;
     _blocksUsed--;
@@ -95,6 +112,11 @@ void Stream::consume()
 {
     LockGuard lock;
 
+    const auto timestamp = now();
+    for (std::size_t i = 0; i < _peekCount; ++i) {
+        _metrics.onRead(_blocksUsed - i, timestamp);
+    }
+
     _blocksUsed -= _peekCount;
     _peekCount = 0;
     _dataStart = _peekPosition;
@@ -113,6 +135,7 @@ bool Stream::peek(Span &span)
     }
 
     span = getNullSpan();
+    _metrics.onUnderrun(now());
     broadcastEvent(Event::StreamUnderFlow);
     return false;
 }
@@ -136,6 +159,7 @@ bool Stream::reserve(Span &span)
     }
 
     // reset data to peek end
+    _metrics.onOverrun(_peekCount);
     _blocksUsed = 0;
     _dataEnd    = _peekPosition;
 
@@ -152,6 +176,11 @@ void Stream::commit()
 {
     LockGuard lock;
 
+    const auto timestamp = now();
+    for (std::size_t i = 0; i < _reserveCount; ++i) {
+        _metrics.onWrite(timestamp);
+    }
+
     _blocksUsed += _reserveCount;
     _reserveCount = 0;
     _dataEnd      = _writeReservationPosition;
@@ -260,6 +289,12 @@ bool Stream::blocksAvailable() const noexcept
     return !isFull();
 }
 
+auto Stream::getMetrics() const -> StreamMetrics::Snapshot
+{
+    LockGuard lock;
+    return _metrics.snapshot(now());
+}
+
 void Stream::reset()
 {
     LockGuard lock;
@@ -273,6 +308,7 @@ void Stream::reset()
     _blocksUsed   = 0;
     _peekCount    = 0;
     _reserveCount = 0;
+    _metrics.flush();
 }
 
 Stream::UniqueStreamBuffer StandardStreamAllocator::allocate(std::size_t size)
@@ -5,6 +5,7 @@
 
 #include "AbstractStream.hpp"
 #include "AudioFormat.hpp"
+#include "StreamMetrics.hpp"
 
 #include <memory/NonCachedMemAllocator.hpp>
 #include <CriticalSectionGuard.hpp>
@@ -93,6 +94,7 @@ namespace audio
         [[nodiscard]] std::size_t getPeekedCount() const noexcept;
         [[nodiscard]] std::size_t getReservedCount() const noexcept;
         [[nodiscard]] bool blocksAvailable() const noexcept;
+        [[nodiscard]] auto getMetrics() const -> StreamMetrics::Snapshot;
 
       private:
         using LockGuard = cpp_freertos::CriticalSectionGuard;
@@ -111,6 +113,7 @@ namespace audio
         UniqueStreamBuffer _buffer;
         UniqueStreamBuffer _emptyBuffer;
         std::list<AbstractStream::EventListener *> listeners;
+        StreamMetrics _metrics;
 
         RawBlockIterator _dataStart;
         RawBlockIterator _dataEnd;
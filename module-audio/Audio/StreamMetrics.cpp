@@ -0,0 +1,127 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "StreamMetrics.hpp"
+
+#include <algorithm>
+
+namespace audio
+{
+    StreamMetrics::StreamMetrics(std::size_t blockCount) : blockCount(blockCount), writeTimes(blockCount)
+    {}
+
+    void StreamMetrics::reset(Timestamp now) noexcept
+    {
+        flush();
+        start         = now;
+        blocksWritten = 0;
+        blocksRead    = 0;
+        underruns     = 0;
+        overruns      = 0;
+        fillLevels    = {};
+        latencyMin    = 0;
+        latencyMax    = 0;
+        latencySum    = 0;
+        latencyCount  = 0;
+        maxWriteGap   = 0;
+        maxReadGap    = 0;
+    }
+
+    void StreamMetrics::flush() noexcept
+    {
+        writeTimesHead  = 0;
+        writeTimesCount = 0;
+        // gaps across a pause or a restart are not the producer's nor the consumer's fault
+        written = false;
+        read    = false;
+    }
+
+    void StreamMetrics::onWrite(Timestamp now) noexcept
+    {
+        if (written) {
+            maxWriteGap = std::max(maxWriteGap, now - lastWrite);
+        }
+        written   = true;
+        lastWrite = now;
+        ++blocksWritten;
+
+        if (writeTimes.empty()) {
+            return;
+        }
+        if (writeTimesCount == writeTimes.size()) {
+            writeTimesHead = (writeTimesHead + 1) % writeTimes.size();
+            --writeTimesCount;
+        }
+        writeTimes[(writeTimesHead + writeTimesCount) % writeTimes.size()] = now;
+        ++writeTimesCount;
+    }
+
+    void StreamMetrics::onRead(std::size_t usedBlocks, Timestamp now) noexcept
+    {
+        trackRead(now);
+        ++blocksRead;
+
+        if (blockCount != 0) {
+            const auto bin = std::min(usedBlocks * fillLevelBins / blockCount, fillLevelBins - 1);
+            ++fillLevels[bin];
+        }
+
+        if (writeTimesCount == 0) {
+            return;
+        }
+        const auto latency = now - writeTimes[writeTimesHead];
+        writeTimesHead     = (writeTimesHead + 1) % writeTimes.size();
+        --writeTimesCount;
+
+        latencyMin = latencyCount == 0 ? latency : std::min(latencyMin, latency);
+        latencyMax = std::max(latencyMax, latency);
+        latencySum += latency;
+        ++latencyCount;
+    }
+
+    void StreamMetrics::onUnderrun(Timestamp now) noexcept
+    {
+        trackRead(now);
+        ++fillLevels[0];
+        recentUnderruns[underruns % recentUnderrunsCapacity] = now;
+        ++underruns;
+    }
+
+    void StreamMetrics::onOverrun(std::size_t keptBlocks) noexcept
+    {
+        ++overruns;
+        writeTimesCount = std::min(writeTimesCount, keptBlocks);
+    }
+
+    void StreamMetrics::trackRead(Timestamp now) noexcept
+    {
+        if (read) {
+            maxReadGap = std::max(maxReadGap, now - lastRead);
+        }
+        read     = true;
+        lastRead = now;
+    }
+
+    auto StreamMetrics::snapshot(Timestamp now) const noexcept -> Snapshot
+    {
+        Snapshot result;
+        result.duration       = now - start;
+        result.blocksWritten  = blocksWritten;
+        result.blocksRead     = blocksRead;
+        result.underruns      = underruns;
+        result.overruns       = overruns;
+        result.fillLevels     = fillLevels;
+        result.latencyMin     = latencyMin;
+        result.latencyMax     = latencyMax;
+        result.latencyAverage = latencyCount == 0 ? 0 : static_cast<std::uint32_t>(latencySum / latencyCount);
+        result.maxWriteGap    = maxWriteGap;
+        result.maxReadGap     = maxReadGap;
+
+        result.recentUnderrunsCount = std::min<std::size_t>(underruns, recentUnderrunsCapacity);
+        for (std::size_t i = 0; i < result.recentUnderrunsCount; ++i) {
+            const auto index          = (underruns - result.recentUnderrunsCount + i) % recentUnderrunsCapacity;
+            result.recentUnderruns[i] = recentUnderruns[index];
+        }
+        return result;
+    }
+} // namespace audio
@@ -0,0 +1,96 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace audio
+{
+    /**
+     * @brief Buffering statistics of a single stream.
+     *
+     * Counts underruns and overruns, builds a histogram of the stream fill level seen by the reader and measures
+     * the time each block spends in the stream, from being written by the producer (e.g. decoder) to being consumed
+     * by the reader (e.g. DMA). The longest gaps between writes and between reads tell a stalled producer from
+     * an irregular consumer. Timestamps of the latest underruns can be matched with the system metrics windows to
+     * see the CPU frequency at the time.
+     *
+     * Memory is allocated in the constructor only, the updates are meant to run in the stream's critical sections,
+     * also from interrupts.
+     */
+    class StreamMetrics
+    {
+      public:
+        using Timestamp = std::uint32_t; ///< [ms since boot]
+
+        static constexpr std::size_t fillLevelBins           = 8;
+        static constexpr std::size_t recentUnderrunsCapacity = 8;
+
+        struct Snapshot
+        {
+            std::uint32_t duration{0}; ///< [ms] since the last reset
+            std::uint32_t blocksWritten{0};
+            std::uint32_t blocksRead{0};
+            std::uint32_t underruns{0}; ///< reads from the empty stream
+            std::uint32_t overruns{0};  ///< writes to the full stream
+            /// Reads per stream fill level before the read, bin i covers [i/8, (i+1)/8) of the capacity
+            std::array<std::uint32_t, fillLevelBins> fillLevels{};
+            std::uint32_t latencyMin{0};     ///< [ms] from the write of a block to its read
+            std::uint32_t latencyAverage{0}; ///< [ms]
+            std::uint32_t latencyMax{0};     ///< [ms]
+            std::uint32_t maxWriteGap{0};    ///< [ms] longest time between two writes
+            std::uint32_t maxReadGap{0};     ///< [ms] longest time between two reads
+            std::array<Timestamp, recentUnderrunsCapacity> recentUnderruns{}; ///< oldest first
+            std::size_t recentUnderrunsCount{0};
+        };
+
+        explicit StreamMetrics(std::size_t blockCount);
+
+        /// Starts over, all statistics are cleared
+        void reset(Timestamp now) noexcept;
+        /// Forgets the blocks in the stream when its data is dropped, the statistics are kept
+        void flush() noexcept;
+
+        void onWrite(Timestamp now) noexcept;
+        /// @param usedBlocks - blocks in the stream before the read
+        void onRead(std::size_t usedBlocks, Timestamp now) noexcept;
+        void onUnderrun(Timestamp now) noexcept;
+        /// @param keptBlocks - blocks left in the stream after dropping the overwritten ones
+        void onOverrun(std::size_t keptBlocks) noexcept;
+
+        /// Does not allocate, can be taken in a critical section
+        [[nodiscard]] auto snapshot(Timestamp now) const noexcept -> Snapshot;
+
+      private:
+        void trackRead(Timestamp now) noexcept;
+
+        std::size_t blockCount;
+        /// Write times of the blocks in the stream, in the stream order
+        std::vector<Timestamp> writeTimes;
+        std::size_t writeTimesHead  = 0;
+        std::size_t writeTimesCount = 0;
+
+        Timestamp start     = 0;
+        Timestamp lastWrite = 0;
+        Timestamp lastRead  = 0;
+        bool written        = false;
+        bool read           = false;
+
+        std::uint32_t blocksWritten = 0;
+        std::uint32_t blocksRead    = 0;
+        std::uint32_t underruns     = 0;
+        std::uint32_t overruns      = 0;
+        std::array<std::uint32_t, fillLevelBins> fillLevels{};
+        std::uint32_t latencyMin   = 0;
+        std::uint32_t latencyMax   = 0;
+        std::uint64_t latencySum   = 0;
+        std::uint32_t latencyCount = 0;
+        std::uint32_t maxWriteGap  = 0;
+        std::uint32_t maxReadGap   = 0;
+        std::array<Timestamp, recentUnderrunsCapacity> recentUnderruns{};
+    };
+} // namespace audio
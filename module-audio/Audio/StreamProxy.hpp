@@ -53,7 +53,6 @@ namespace audio
         [[nodiscard]] bool isEmpty() const noexcept override;
         [[nodiscard]] bool isFull() const noexcept override;
 
-      protected:
         auto getWrappedStream() -> AbstractStream &;
 
       private:
@@ -0,0 +1,163 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "StreamTelemetry.hpp"
+#include "Stream.hpp"
+#include "StreamProxy.hpp"
+
+#include <log/log.hpp>
+#include <mutex.hpp>
+#include <ticks.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <fstream>
+#include <iterator>
+
+namespace audio::telemetry
+{
+    namespace
+    {
+        struct TrackedStream
+        {
+            const void *connection;
+            std::string name;
+            Stream *stream;
+        };
+
+        struct Registry
+        {
+            std::vector<TrackedStream> active;
+            std::deque<StreamReport> finished;
+        };
+
+        auto registryMutex() -> cpp_freertos::MutexStandard &
+        {
+            static cpp_freertos::MutexStandard mutex;
+            return mutex;
+        }
+
+        auto registry() -> Registry &
+        {
+            static Registry instance;
+            return instance;
+        }
+
+        auto now() -> StreamMetrics::Timestamp
+        {
+            return static_cast<StreamMetrics::Timestamp>(
+                cpp_freertos::Ticks::TicksToMs(cpp_freertos::Ticks::GetTicks()));
+        }
+
+        auto makeReport(const TrackedStream &tracked, bool active) -> StreamReport
+        {
+            const auto traits = tracked.stream->getOutputTraits();
+            return StreamReport{.name          = tracked.name,
+                                .active        = active,
+                                .timestamp     = now(),
+                                .blockCount    = tracked.stream->getBlockCount(),
+                                .blockDuration = traits.format.bytesToMicroseconds(traits.blockSize),
+                                .metrics       = tracked.stream->getMetrics()};
+        }
+
+        template <typename T, std::size_t N>
+        auto join(const std::array<T, N> &values, std::size_t count) -> std::string
+        {
+            std::string result;
+            for (std::size_t i = 0; i < count; ++i) {
+                result += (i == 0 ? "" : " ") + std::to_string(values[i]);
+            }
+            return result;
+        }
+    } // namespace
+
+    auto findStream(AbstractStream *stream) -> Stream *
+    {
+        while (stream != nullptr) {
+            if (const auto buffer = dynamic_cast<Stream *>(stream); buffer != nullptr) {
+                return buffer;
+            }
+            const auto proxy = dynamic_cast<StreamProxy *>(stream);
+            stream           = proxy != nullptr ? &proxy->getWrappedStream() : nullptr;
+        }
+        return nullptr;
+    }
+
+    void track(const void *connection, std::string name, Stream &stream)
+    {
+        cpp_freertos::LockGuard lock{registryMutex()};
+        registry().active.push_back(TrackedStream{connection, std::move(name), &stream});
+    }
+
+    void untrack(const void *connection)
+    {
+        cpp_freertos::LockGuard lock{registryMutex()};
+        auto &active     = registry().active;
+        const auto found = std::find_if(active.begin(), active.end(), [connection](const auto &tracked) {
+            return tracked.connection == connection;
+        });
+        if (found == active.end()) {
+            return;
+        }
+
+        auto &finished = registry().finished;
+        finished.push_front(makeReport(*found, false));
+        if (finished.size() > finishedReportsCapacity) {
+            finished.pop_back();
+        }
+        const auto &report = finished.front();
+        LOG_INFO("Stream %s: %u underruns, %u overruns, latency %u-%u ms",
+                 report.name.c_str(),
+                 static_cast<unsigned>(report.metrics.underruns),
+                 static_cast<unsigned>(report.metrics.overruns),
+                 static_cast<unsigned>(report.metrics.latencyMin),
+                 static_cast<unsigned>(report.metrics.latencyMax));
+        active.erase(found);
+    }
+
+    auto getReports() -> std::vector<StreamReport>
+    {
+        cpp_freertos::LockGuard lock{registryMutex()};
+        std::vector<StreamReport> reports;
+        const auto &active = registry().active;
+        std::transform(active.rbegin(), active.rend(), std::back_inserter(reports), [](const auto &tracked) {
+            return makeReport(tracked, true);
+        });
+        const auto &finished = registry().finished;
+        reports.insert(reports.end(), finished.begin(), finished.end());
+        return reports;
+    }
+
+    auto toCsv(const std::vector<StreamReport> &reports) -> std::string
+    {
+        std::string csv{"timestamp_ms,name,active,blocks,block_us,duration_ms,written,read,underruns,overruns,"
+                        "latency_min_ms,latency_avg_ms,latency_max_ms,write_gap_ms,read_gap_ms,fill_levels,"
+                        "recent_underruns_ms\n"};
+        for (const auto &report : reports) {
+            const auto &metrics = report.metrics;
+            csv += std::to_string(report.timestamp) + ',' + report.name + ',' + (report.active ? "1" : "0") + ',' +
+                   std::to_string(report.blockCount) + ',' + std::to_string(report.blockDuration.count()) + ',' +
+                   std::to_string(metrics.duration) + ',' + std::to_string(metrics.blocksWritten) + ',' +
+                   std::to_string(metrics.blocksRead) + ',' + std::to_string(metrics.underruns) + ',' +
+                   std::to_string(metrics.overruns) + ',' + std::to_string(metrics.latencyMin) + ',' +
+                   std::to_string(metrics.latencyAverage) + ',' + std::to_string(metrics.latencyMax) + ',' +
+                   std::to_string(metrics.maxWriteGap) + ',' + std::to_string(metrics.maxReadGap) + ',' +
+                   join(metrics.fillLevels, metrics.fillLevels.size()) + ',' +
+                   join(metrics.recentUnderruns, metrics.recentUnderrunsCount) + '\n';
+        }
+        return csv;
+    }
+
+    bool exportCsv(const std::filesystem::path &path)
+    {
+        const auto csv = toCsv(getReports());
+
+        std::ofstream file(path, std::ios::trunc);
+        if (!file.is_open()) {
+            LOG_ERROR("Unable to open %s", path.c_str());
+            return false;
+        }
+        file << csv;
+        return file.good();
+    }
+} // namespace audio::telemetry
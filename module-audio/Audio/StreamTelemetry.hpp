@@ -0,0 +1,50 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include "StreamMetrics.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace audio
+{
+    class AbstractStream;
+    class Stream;
+} // namespace audio
+
+namespace audio::telemetry
+{
+    /// Metrics of a stream connection, e.g. a playback to the Bluetooth headset or a call uplink
+    struct StreamReport
+    {
+        std::string name;
+        bool active{false};
+        StreamMetrics::Timestamp timestamp{0}; ///< [ms since boot] of the report or of the end of the connection
+        std::size_t blockCount{0};
+        std::chrono::microseconds blockDuration{0};
+        StreamMetrics::Snapshot metrics;
+    };
+
+    /// Number of finished connections whose reports are kept
+    inline constexpr std::size_t finishedReportsCapacity = 8;
+
+    /// Buffering stream behind the proxies, if any
+    [[nodiscard]] auto findStream(AbstractStream *stream) -> Stream *;
+
+    /// Starts reporting the stream of a connection
+    void track(const void *connection, std::string name, Stream &stream);
+    /// Stores the last report of the connection, to be called before the stream is destroyed
+    void untrack(const void *connection);
+
+    /// Active connections followed by the finished ones, newest first
+    [[nodiscard]] auto getReports() -> std::vector<StreamReport>;
+    /// One line per report, fill levels and underrun timestamps separated by spaces
+    [[nodiscard]] auto toCsv(const std::vector<StreamReport> &reports) -> std::string;
+    /// Writes all reports as CSV
+    bool exportCsv(const std::filesystem::path &path);
+} // namespace audio::telemetry
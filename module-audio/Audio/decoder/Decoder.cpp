@@ -1,6 +1,7 @@
 // Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
 // For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
 
+#include <cinttypes>
 #include <cstdio>
 #include <Utils.hpp>
 #include "Decoder.hpp"
@@ -20,14 +21,15 @@ namespace audio
             return;
         }
 
-        constexpr std::size_t streamBufferSize = 16 * 1024;
-        streamBuffer                      = std::make_unique<char[]>(streamBufferSize);
-        setvbuf(fd, streamBuffer.get(), _IOFBF, streamBufferSize);
+        // reads are buffered by the decoder input already
+        setvbuf(fd, nullptr, _IONBF, 0);
 
         std::fseek(fd, 0, SEEK_END);
         fileSize = std::ftell(fd);
         std::rewind(fd);
 
+        input = std::make_unique<DecoderInput>(fd, fileSize);
+
         tags = fetchTags();
     }
 
@@ -37,6 +39,16 @@ namespace audio
             audioWorker->close();
         }
 
+        if (input) {
+            const auto statistics = input->getStatistics();
+            LOG_DEBUG("Decoder input: %" PRIu32 " reads, %" PRIu32 " bytes, %" PRIu32 " underruns, %" PRIu32
+                      " invalidations",
+                      statistics.fileReads,
+                      statistics.bytesRead,
+                      statistics.underruns,
+                      statistics.invalidations);
+        }
+
         if (fd != nullptr) {
             std::fclose(fd);
         }
@@ -83,8 +95,8 @@ namespace audio
             const auto channelMode = (tags->num_channel == 1) ? DecoderWorker::ChannelMode::ForceStereo
                                                               : DecoderWorker::ChannelMode::NoConversion;
 
-            audioWorker =
-                std::make_unique<DecoderWorker>(_stream, this, endOfFileCallback, fileDeletedCallback, channelMode);
+            audioWorker = std::make_unique<DecoderWorker>(
+                _stream, this, endOfFileCallback, fileDeletedCallback, channelMode, loop.get());
             audioWorker->init();
             audioWorker->run();
         }
@@ -101,6 +113,23 @@ namespace audio
         audioWorker = nullptr;
     }
 
+    auto Decoder::setLooping(bool enabled, std::chrono::milliseconds crossfade) -> void
+    {
+        loop = enabled ? std::make_unique<DecoderLoop>(*this, crossfade) : nullptr;
+    }
+
+    auto Decoder::prefetchInput() -> void
+    {
+        if (input) {
+            input->prefetch();
+        }
+    }
+
+    auto Decoder::getInputStatistics() const noexcept -> DecoderInput::Statistics
+    {
+        return input ? input->getStatistics() : DecoderInput::Statistics{};
+    }
+
     auto Decoder::onDataReceive() -> void
     {
         audioWorker->enablePlayback();
@@ -5,8 +5,11 @@
 
 #include "Audio/AudioCommon.hpp"
 #include "Audio/Endpoint.hpp"
+#include "DecoderInput.hpp"
+#include "DecoderLoop.hpp"
 #include "DecoderWorker.hpp"
 
+#include <chrono>
 #include <memory>
 #include <vector>
 
@@ -36,6 +39,9 @@ namespace audio
         // Rewind to first audio sample
         virtual auto rewind() -> void = 0;
 
+        // Sample accurate seek, frame counts samples of all channels once
+        virtual auto seekToFrame(std::uint64_t frame) -> bool = 0;
+
         [[nodiscard]] auto getSampleRate() const noexcept -> std::uint32_t
         {
             return sampleRate;
@@ -64,6 +70,14 @@ namespace audio
                                  const DecoderWorker::FileDeletedCallback &fileDeletedCallback) -> void;
         auto stopDecodingWorker() -> void;
 
+        // Continue from the beginning at the end of the file instead of reporting it, optionally crossfading the end
+        // with the beginning. Must be set before decoding starts, takes effect when the decoding worker is started.
+        auto setLooping(bool enabled, std::chrono::milliseconds crossfade = std::chrono::milliseconds::zero()) -> void;
+
+        // Reads ahead the file data the decoder will need next
+        auto prefetchInput() -> void;
+        [[nodiscard]] auto getInputStatistics() const noexcept -> DecoderInput::Statistics;
+
         // Factory method
         static auto Create(const std::string &path) -> std::unique_ptr<Decoder>;
 
@@ -82,7 +96,7 @@ namespace audio
         std::uint32_t bitsPerSample;
         float position = 0;
         std::FILE *fd  = nullptr;
-        std::unique_ptr<char[]> streamBuffer;
+        std::unique_ptr<DecoderInput> input;
         std::uint32_t fileSize = 0;
         std::string filePath;
 
@@ -91,5 +105,6 @@ namespace audio
 
         // Decoding worker
         std::unique_ptr<DecoderWorker> audioWorker;
+        std::unique_ptr<DecoderLoop> loop;
     };
 } // namespace audio
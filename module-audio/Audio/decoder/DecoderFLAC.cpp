@@ -78,24 +78,27 @@ namespace audio
         setPosition(0.0f);
     }
 
+    auto DecoderFLAC::seekToFrame(std::uint64_t frame) -> bool
+    {
+        if (!isInitialized || drflac_seek_to_pcm_frame(flac, frame) == DRFLAC_FALSE) {
+            return false;
+        }
+        position = frame / static_cast<float>(sampleRate);
+        return true;
+    }
+
     auto DecoderFLAC::drflacRead(void *pUserData, void *pBufferOut, std::size_t bytesToRead) -> std::size_t
     {
         const auto decoderContext = static_cast<DecoderFLAC *>(pUserData);
 
-        /* Check if the file exists - std::fread happily returns bytesToRead if
-         * requested to read from deleted file, what causes decoding library
-         * to enter infinite loop of reading. */
-        if (!fileExists(decoderContext->fd)) {
-            return 0;
-        }
-        return std::fread(pBufferOut, 1, bytesToRead, decoderContext->fd);
+        return decoderContext->input->read(pBufferOut, bytesToRead);
     }
 
     auto DecoderFLAC::drflacSeek(void *pUserData, int offset, drflac_seek_origin origin) -> drflac_bool32
     {
         const auto decoderContext = static_cast<DecoderFLAC *>(pUserData);
-        const auto seekError =
-            std::fseek(decoderContext->fd, offset, (origin == drflac_seek_origin_start) ? SEEK_SET : SEEK_CUR);
-        return (seekError == 0) ? DRFLAC_TRUE : DRFLAC_FALSE;
+        const auto whence         = (origin == drflac_seek_origin_start) ? SEEK_SET : SEEK_CUR;
+        const auto seekDone       = decoderContext->input->seek(offset, whence);
+        return seekDone ? DRFLAC_TRUE : DRFLAC_FALSE;
     }
 } // namespace audio
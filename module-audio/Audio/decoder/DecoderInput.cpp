@@ -0,0 +1,136 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "DecoderInput.hpp"
+#include "DecoderCommon.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace audio
+{
+    auto DecoderInput::Chunk::contains(std::size_t pos) const noexcept -> bool
+    {
+        return size != 0 && pos >= offset && pos < offset + size;
+    }
+
+    DecoderInput::DecoderInput(std::FILE *fd, std::size_t fileSize)
+        : fd(fd), fileSize(fileSize), buffer(std::make_unique<std::uint8_t[]>(2 * chunkSize))
+    {
+        chunks[0].data = buffer.get();
+        chunks[1].data = buffer.get() + chunkSize;
+    }
+
+    auto DecoderInput::read(void *data, std::size_t size) -> std::size_t
+    {
+        auto out          = static_cast<std::uint8_t *>(data);
+        std::size_t total = 0;
+
+        while (total < size && position < fileSize) {
+            auto chunk = find(position);
+            if (chunk == nullptr) {
+                ++statistics.underruns;
+                // keep the chunk just before the position, decoders may step back a little
+                const auto keepFirst = position > 0 && chunks[0].contains(position - 1);
+                auto &target         = keepFirst ? chunks[1] : chunks[0];
+                if (!load(target, position / chunkSize * chunkSize)) {
+                    break;
+                }
+                chunk = &target;
+            }
+
+            const auto available = chunk->offset + chunk->size - position;
+            const auto toCopy    = std::min(size - total, available);
+            std::memcpy(out + total, chunk->data + (position - chunk->offset), toCopy);
+            total += toCopy;
+            position += toCopy;
+        }
+        return total;
+    }
+
+    auto DecoderInput::seek(std::int64_t offset, int origin) -> bool
+    {
+        const auto base   = origin == SEEK_CUR ? static_cast<std::int64_t>(position) : 0;
+        const auto target = base + offset;
+        if (target < 0 || target > static_cast<std::int64_t>(fileSize)) {
+            return false;
+        }
+
+        position = static_cast<std::size_t>(target);
+        if (position < fileSize && find(position) == nullptr && (chunks[0].size != 0 || chunks[1].size != 0)) {
+            chunks[0].size = 0;
+            chunks[1].size = 0;
+            ++statistics.invalidations;
+        }
+        return true;
+    }
+
+    auto DecoderInput::tell() const noexcept -> std::size_t
+    {
+        return position;
+    }
+
+    void DecoderInput::prefetch()
+    {
+        if (position >= fileSize) {
+            return;
+        }
+
+        auto current = find(position);
+        if (current == nullptr) {
+            current = &chunks[0];
+            if (!load(*current, position / chunkSize * chunkSize)) {
+                return;
+            }
+        }
+
+        const auto next = current->offset + chunkSize;
+        auto &spare     = other(*current);
+        if (next < fileSize && !(spare.size != 0 && spare.offset == next)) {
+            load(spare, next);
+        }
+    }
+
+    auto DecoderInput::getStatistics() const noexcept -> Statistics
+    {
+        return statistics;
+    }
+
+    auto DecoderInput::find(std::size_t pos) noexcept -> Chunk *
+    {
+        for (auto &chunk : chunks) {
+            if (chunk.contains(pos)) {
+                return &chunk;
+            }
+        }
+        return nullptr;
+    }
+
+    auto DecoderInput::load(Chunk &chunk, std::size_t offset) -> bool
+    {
+        chunk.size = 0;
+
+        /* Check if the file exists - std::fread happily returns the size requested
+         * when reading from a deleted file, what causes decoding libraries
+         * to enter an infinite loop of reading. */
+        if (!fileExists(fd) || std::fseek(fd, static_cast<long>(offset), SEEK_SET) != 0) {
+            return false;
+        }
+
+        const auto bytesRead = std::fread(chunk.data, 1, std::min(chunkSize, fileSize - offset), fd);
+        if (bytesRead == 0) {
+            return false;
+        }
+
+        chunk.offset = offset;
+        chunk.size   = bytesRead;
+        ++statistics.fileReads;
+        statistics.bytesRead += bytesRead;
+        return true;
+    }
+
+    auto DecoderInput::other(const Chunk &chunk) noexcept -> Chunk &
+    {
+        return &chunk == &chunks[0] ? chunks[1] : chunks[0];
+    }
+} // namespace audio
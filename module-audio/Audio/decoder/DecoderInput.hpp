@@ -0,0 +1,83 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+namespace audio
+{
+    /**
+     * @brief Read-ahead input of a decoder.
+     *
+     * The file is read in chunks aligned to chunkSize into two buffers. The decoder reads from the chunk holding the
+     * current position while prefetch() refills the other one with the chunk that follows, so that flash is accessed
+     * with a few large reads done when the decoding worker is awake anyway instead of on every decoded block.
+     * A read which has to wait for the file is counted as an underrun. Seeking within the buffered chunks only moves
+     * the position, seeking elsewhere drops the buffers without reading anything.
+     */
+    class DecoderInput
+    {
+      public:
+        static constexpr std::size_t chunkSize = 16 * 1024;
+
+        struct Statistics
+        {
+            std::uint32_t fileReads     = 0; ///< Chunks read from the file
+            std::uint32_t bytesRead     = 0; ///< Bytes read from the file
+            std::uint32_t underruns     = 0; ///< Reads which had to wait for the file
+            std::uint32_t invalidations = 0; ///< Seeks outside of the buffered chunks
+        };
+
+        DecoderInput(std::FILE *fd, std::size_t fileSize);
+
+        /**
+         * @brief Copies data from the current position and advances it
+         *
+         * @return number of bytes read, less than size at the end of the file or if the file was deleted
+         */
+        auto read(void *data, std::size_t size) -> std::size_t;
+
+        /**
+         * @brief Moves the current position
+         *
+         * @param offset - offset relative to the origin
+         * @param origin - SEEK_SET or SEEK_CUR
+         * @return true if the new position is within the file
+         */
+        auto seek(std::int64_t offset, int origin) -> bool;
+
+        [[nodiscard]] auto tell() const noexcept -> std::size_t;
+
+        /**
+         * @brief Reads the chunk following the current one if it is not buffered yet
+         */
+        void prefetch();
+
+        [[nodiscard]] auto getStatistics() const noexcept -> Statistics;
+
+      private:
+        struct Chunk
+        {
+            std::uint8_t *data = nullptr;
+            std::size_t offset = 0;
+            std::size_t size   = 0; ///< 0 if the chunk holds no data
+
+            [[nodiscard]] auto contains(std::size_t position) const noexcept -> bool;
+        };
+
+        auto find(std::size_t position) noexcept -> Chunk *;
+        auto load(Chunk &chunk, std::size_t offset) -> bool;
+        auto other(const Chunk &chunk) noexcept -> Chunk &;
+
+        std::FILE *fd;
+        std::size_t fileSize;
+        std::size_t position = 0;
+        std::unique_ptr<std::uint8_t[]> buffer;
+        std::array<Chunk, 2> chunks;
+        Statistics statistics;
+    };
+} // namespace audio
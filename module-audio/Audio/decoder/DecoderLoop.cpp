@@ -0,0 +1,127 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "DecoderLoop.hpp"
+#include "Decoder.hpp"
+
+#include <Audio/MixKernel.hpp>
+#include <log/log.hpp>
+
+#include <algorithm>
+
+namespace audio
+{
+    DecoderLoop::DecoderLoop(Decoder &decoder, std::chrono::milliseconds crossfade)
+        : decoder(decoder), channels(std::max(decoder.getChannelCount(), std::uint32_t{1}))
+    {
+        const auto duration = std::clamp(crossfade, std::chrono::milliseconds::zero(), maxCrossfade);
+        const auto frames   = static_cast<std::size_t>(duration.count()) * decoder.getSampleRate() / 1000;
+        length              = frames * channels;
+        crossfadeEnabled    = length != 0;
+
+        if (crossfadeEnabled) {
+            head = std::make_unique<std::int16_t[]>(length);
+            tail = std::make_unique<std::int16_t[]>(length);
+        }
+    }
+
+    auto DecoderLoop::decode(std::uint32_t samplesToRead, std::int16_t *pcmData) -> std::int32_t
+    {
+        std::uint32_t total = 0;
+        auto wrapped        = false;
+
+        while (total < samplesToRead) {
+            const auto samplesRead = decoder.decode(samplesToRead - total, pcmData + total);
+            if (samplesRead == Decoder::fileDeletedRetCode) {
+                return samplesRead;
+            }
+
+            if (samplesRead > 0) {
+                const auto out = pcmData + total;
+                if (crossfadeEnabled) {
+                    captureHead(out, samplesRead);
+                }
+                total += (length == 0) ? samplesRead : delay(out, samplesRead);
+                wrapped = false;
+                continue;
+            }
+
+            // nothing decoded right after rewinding, the file holds no samples
+            if (wrapped) {
+                break;
+            }
+            wrap();
+            wrapped = true;
+        }
+        return static_cast<std::int32_t>(total);
+    }
+
+    auto DecoderLoop::getLoopsCount() const noexcept -> std::uint32_t
+    {
+        return loops;
+    }
+
+    auto DecoderLoop::wrap() -> void
+    {
+        ++loops;
+
+        if (crossfadeEnabled && headFilled < length) {
+            LOG_WARN("File shorter than the crossfade, looping without it");
+            crossfadeEnabled = false;
+        }
+
+        if (!crossfadeEnabled) {
+            decoder.rewind();
+            return;
+        }
+
+        crossfade();
+        if (!decoder.seekToFrame(length / channels)) {
+            LOG_ERROR("Failed to skip the crossfaded head, looping from the beginning");
+            decoder.rewind();
+        }
+    }
+
+    auto DecoderLoop::captureHead(const std::int16_t *samples, std::size_t count) -> void
+    {
+        const auto toCopy = std::min(count, length - headFilled);
+        std::copy_n(samples, toCopy, head.get() + headFilled);
+        headFilled += toCopy;
+    }
+
+    auto DecoderLoop::delay(std::int16_t *samples, std::size_t count) -> std::size_t
+    {
+        // the delay line is filled first, nothing leaves it until then
+        const auto toFill = std::min(count, length - tailFilled);
+        if (toFill > 0) {
+            std::copy_n(samples, toFill, tail.get() + tailFilled);
+            tailFilled += toFill;
+            std::move(samples + toFill, samples + count, samples);
+        }
+
+        const auto toSwap = count - toFill;
+        for (std::size_t done = 0; done < toSwap;) {
+            const auto chunk = std::min(toSwap - done, length - tailPosition);
+            std::swap_ranges(samples + done, samples + done + chunk, tail.get() + tailPosition);
+            done += chunk;
+            tailPosition = (tailPosition + chunk) % length;
+        }
+        return toSwap;
+    }
+
+    auto DecoderLoop::crossfade() -> void
+    {
+        // the delay line holds the tail of the file, it is mixed in place with the cached head
+        const auto frames = length / channels;
+        for (std::size_t frame = 0; frame < frames; ++frame) {
+            const auto fadeIn  = static_cast<mix::Gain>(frame * mix::unityGain / frames);
+            const auto fadeOut = mix::unityGain - fadeIn;
+            for (std::size_t channel = 0; channel < channels; ++channel) {
+                const auto sample = frame * channels + channel;
+                auto &out         = tail[(tailPosition + sample) % length];
+                const auto mixed  = out * fadeOut + head[sample] * fadeIn;
+                out               = static_cast<std::int16_t>(mixed >> mix::gainShift);
+            }
+        }
+    }
+} // namespace audio
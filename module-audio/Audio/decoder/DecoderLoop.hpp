@@ -0,0 +1,61 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+namespace audio
+{
+    class Decoder;
+
+    /**
+     * @brief Gapless looping on top of a decoder.
+     *
+     * At the end of the file the decoder is rewound and decoding continues into the same buffer, so the stream is fed
+     * without a gap and the decoder is never reopened.
+     *
+     * With a crossfade the output is delayed by the crossfade length. The samples held back at the end of the file
+     * are the tail which is faded out, while the head faded in is cached during the first pass, so the crossfade is
+     * computed at the loop boundary without decoding anything twice. Decoding then resumes right after the head.
+     */
+    class DecoderLoop
+    {
+      public:
+        static constexpr std::chrono::milliseconds maxCrossfade{500};
+
+        DecoderLoop(Decoder &decoder, std::chrono::milliseconds crossfade);
+
+        /**
+         * @brief Decodes samples, continuing from the beginning of the file at its end
+         *
+         * @return number of samples decoded, less than samplesToRead only if the file holds no samples,
+         * Decoder::fileDeletedRetCode if the file was deleted
+         */
+        auto decode(std::uint32_t samplesToRead, std::int16_t *pcmData) -> std::int32_t;
+
+        [[nodiscard]] auto getLoopsCount() const noexcept -> std::uint32_t;
+
+      private:
+        auto wrap() -> void;
+        auto captureHead(const std::int16_t *samples, std::size_t count) -> void;
+        auto delay(std::int16_t *samples, std::size_t count) -> std::size_t;
+        auto crossfade() -> void;
+
+        Decoder &decoder;
+        std::uint32_t channels;
+        std::size_t length; ///< Crossfade length in samples, 0 if disabled
+        bool crossfadeEnabled;
+
+        std::unique_ptr<std::int16_t[]> head;
+        std::size_t headFilled = 0;
+
+        std::unique_ptr<std::int16_t[]> tail; ///< Delay line, the oldest sample is at tailPosition
+        std::size_t tailFilled   = 0;
+        std::size_t tailPosition = 0;
+
+        std::uint32_t loops = 0;
+    };
+} // namespace audio
@@ -68,6 +68,15 @@ namespace audio
         setPosition(0.0f);
     }
 
+    auto DecoderMP3::seekToFrame(std::uint64_t frame) -> bool
+    {
+        if (!isInitialized || mp3dec_ex_seek(dec.get(), frame * channelCount) != 0) {
+            return false;
+        }
+        position = frame / static_cast<float>(sampleRate);
+        return true;
+    }
+
     auto DecoderMP3::decode(std::uint32_t samplesToRead, std::int16_t *pcmData) -> std::int32_t
     {
         const auto samplesRead = mp3dec_ex_read(dec.get(), reinterpret_cast<mp3d_sample_t *>(pcmData), samplesToRead);
@@ -90,18 +99,12 @@ namespace audio
     {
         const auto decoderContext = static_cast<DecoderMP3 *>(pUserData);
 
-        /* Check if the file exists - std::fread happily returns bytesToRead if
-         * requested to read from deleted file, what causes decoding library
-         * to enter infinite loop of reading. */
-        if (!fileExists(decoderContext->fd)) {
-            return 0;
-        }
-        return std::fread(pBufferOut, 1, bytesToRead, decoderContext->fd);
+        return decoderContext->input->read(pBufferOut, bytesToRead);
     }
 
     auto DecoderMP3::mp3Seek(std::uint64_t offset, void *pUserData) -> int
     {
         const auto decoderContext = static_cast<DecoderMP3 *>(pUserData);
-        return std::fseek(decoderContext->fd, offset, SEEK_SET);
+        return decoderContext->input->seek(static_cast<std::int64_t>(offset), SEEK_SET) ? 0 : -1;
     }
 } // namespace audio
@@ -18,6 +18,7 @@ namespace audio
 
         auto setPosition(float pos) -> void override;
         auto rewind() -> void override;
+        auto seekToFrame(std::uint64_t frame) -> bool override;
 
       private:
         std::unique_ptr<mp3dec_ex_t> dec;
@@ -60,6 +60,15 @@ namespace audio
         setPosition(0.0f);
     }
 
+    auto DecoderWAV::seekToFrame(std::uint64_t frame) -> bool
+    {
+        if (!isInitialized || drwav_seek_to_pcm_frame(wav.get(), frame) == DRWAV_FALSE) {
+            return false;
+        }
+        position = frame / static_cast<float>(sampleRate);
+        return true;
+    }
+
     auto DecoderWAV::decode(std::uint32_t samplesToRead, std::int16_t *pcmData) -> std::int32_t
     {
         if (!isInitialized) {
@@ -86,20 +95,14 @@ namespace audio
     {
         const auto decoderContext = static_cast<DecoderWAV *>(pUserData);
 
-        /* Check if the file exists - std::fread happily returns bytesToRead if
-         * requested to read from deleted file, what causes decoding library
-         * to enter infinite loop of reading. */
-        if (!fileExists(decoderContext->fd)) {
-            return 0;
-        }
-        return std::fread(pBufferOut, 1, bytesToRead, decoderContext->fd);
+        return decoderContext->input->read(pBufferOut, bytesToRead);
     }
 
     auto DecoderWAV::drwavSeek(void *pUserData, int offset, drwav_seek_origin origin) -> drwav_bool32
     {
         const auto decoderContext = static_cast<DecoderWAV *>(pUserData);
-        const auto seekError =
-            std::fseek(decoderContext->fd, offset, (origin == drwav_seek_origin_start) ? SEEK_SET : SEEK_CUR);
-        return (seekError == 0) ? DRWAV_TRUE : DRWAV_FALSE;
+        const auto whence         = (origin == drwav_seek_origin_start) ? SEEK_SET : SEEK_CUR;
+        const auto seekDone       = decoderContext->input->seek(offset, whence);
+        return seekDone ? DRWAV_TRUE : DRWAV_FALSE;
     }
 } // namespace audio
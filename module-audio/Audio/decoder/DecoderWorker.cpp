@@ -4,15 +4,19 @@
 #include "DecoderWorker.hpp"
 #include <Audio/AbstractStream.hpp>
 #include <Audio/decoder/Decoder.hpp>
+#include <Audio/decoder/DecoderLoop.hpp>
+#include <Audio/PcmKernels.hpp>
 
 audio::DecoderWorker::DecoderWorker(audio::AbstractStream *audioStreamOut,
                                     Decoder *decoder,
                                     const EndOfFileCallback &endOfFileCallback,
                                     const FileDeletedCallback &fileDeletedCallback,
-                                    ChannelMode mode)
+                                    ChannelMode mode,
+                                    DecoderLoop *loop)
     : sys::Worker(DecoderWorker::workerName, DecoderWorker::workerPriority, stackDepth), audioStreamOut(audioStreamOut),
       decoder(decoder), bufferSize(audioStreamOut->getInputTraits().blockSize / sizeof(BufferInternalType)),
-      channelMode(mode), endOfFileCallback(endOfFileCallback), fileDeletedCallback(fileDeletedCallback)
+      channelMode(mode), loop(loop), endOfFileCallback(endOfFileCallback),
+      fileDeletedCallback(fileDeletedCallback)
 {}
 
 audio::DecoderWorker::~DecoderWorker()
@@ -92,9 +96,11 @@ void audio::DecoderWorker::pushAudioData()
     std::int32_t samplesRead = 0;
 
     while (!audioStreamOut->isFull() && playbackEnabled) {
+        decoder->prefetchInput();
+
         auto buffer = decoderBuffer.get();
         const auto totalBufferSize = bufferSize / readScale;
-        samplesRead                = decoder->decode(totalBufferSize, buffer);
+        samplesRead = loop ? loop->decode(totalBufferSize, buffer) : decoder->decode(totalBufferSize, buffer);
 
         if (samplesRead == Decoder::fileDeletedRetCode) {
             fileDeletedCallback();
@@ -107,9 +113,7 @@ void audio::DecoderWorker::pushAudioData()
 
         // pcm mono to stereo force conversion
         if (channelMode == ChannelMode::ForceStereo) {
-            for (auto i = bufferSize / 2; i > 0; i--) {
-                buffer[i * 2 - 1] = buffer[i * 2 - 2] = buffer[i - 1];
-            }
+            pcm::monoToStereo(buffer, buffer, bufferSize / 2);
         }
 
         if (!audioStreamOut->push(decoderBuffer.get(), samplesRead * sizeof(BufferInternalType) * readScale)) {
@@ -12,6 +12,7 @@
 namespace audio
 {
     class Decoder;
+    class DecoderLoop;
     class DecoderWorker : public sys::Worker
     {
       public:
@@ -34,7 +35,8 @@ namespace audio
                       Decoder *decoder,
                       const EndOfFileCallback &endOfFileCallback,
                       const FileDeletedCallback &fileDeletedCallback,
-                      ChannelMode mode);
+                      ChannelMode mode,
+                      DecoderLoop *loop = nullptr);
         ~DecoderWorker() override;
 
         auto init(std::list<sys::WorkerQueueInfo> queues = std::list<sys::WorkerQueueInfo>()) -> bool override;
@@ -65,6 +67,7 @@ namespace audio
         const int bufferSize;
         std::unique_ptr<BufferInternalType[]> decoderBuffer;
         ChannelMode channelMode = ChannelMode::NoConversion;
+        DecoderLoop *loop = nullptr;
 
         EndOfFileCallback endOfFileCallback;
         FileDeletedCallback fileDeletedCallback;
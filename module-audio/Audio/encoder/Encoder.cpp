@@ -2,8 +2,11 @@
 // For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
 
 #include "Encoder.hpp"
+#include "EncoderADPCM.hpp"
 #include "EncoderWAV.hpp"
+#include "EncoderWorker.hpp"
 
+#include <log/log.hpp>
 #include <Utils.hpp>
 
 #include <string>
@@ -13,6 +16,10 @@
 
 namespace audio
 {
+    namespace
+    {
+        constexpr auto flushTimeout = pdMS_TO_TICKS(1000);
+    } // namespace
 
     Encoder::Encoder(const std::string &filePath, const Format &frmt) : format(frmt), filePath(filePath)
     {
@@ -20,26 +27,35 @@ namespace audio
         if (fd == nullptr) {
             return;
         }
-        constexpr size_t streamBufferSize = 6;
-        streamBuffer                      = std::make_unique<char[]>(streamBufferSize);
-        setvbuf(fd, streamBuffer.get(), _IOFBF, streamBufferSize);
+        // the output writes whole chunks, stdio buffering would only copy them
+        setvbuf(fd, nullptr, _IONBF, 0);
+        output        = std::make_unique<EncoderOutput>(fd);
         isInitialized = true;
     }
 
     Encoder::~Encoder()
     {
+        // the encoders finish the file in their destructors, there is nothing left to flush here
+        if (worker != nullptr) {
+            worker->close();
+        }
         if (fd != nullptr) {
             std::fclose(fd);
         }
     }
 
-    std::unique_ptr<Encoder> Encoder::Create(const std::string &filePath, const Format &frmt)
+    std::unique_ptr<Encoder> Encoder::Create(const std::string &filePath,
+                                             const Format &frmt,
+                                             RecordingFormat recordingFormat)
     {
         const auto extension          = std::filesystem::path(filePath).extension();
         const auto extensionLowercase = utils::stringToLowercase(extension);
 
         std::unique_ptr<Encoder> enc;
-        if (extensionLowercase == ".wav") {
+        if (extensionLowercase == ".wav" && recordingFormat == RecordingFormat::ImaAdpcm) {
+            enc = std::make_unique<EncoderADPCM>(filePath, frmt);
+        }
+        else if (extensionLowercase == ".wav") {
             enc = std::make_unique<EncoderWAV>(filePath, frmt);
         }
         else {
@@ -53,4 +69,102 @@ namespace audio
         return nullptr;
     }
 
+    void Encoder::startFlushWorker()
+    {
+        if (worker != nullptr || output == nullptr) {
+            return;
+        }
+        worker = std::make_unique<EncoderWorker>([this]() { flush(); });
+        if (!worker->init() || !worker->run()) {
+            LOG_ERROR("Failed to start the encoder worker, writing in place");
+            worker = nullptr;
+        }
+    }
+
+    void Encoder::stopFlushWorker()
+    {
+        if (worker == nullptr) {
+            return;
+        }
+        worker->close();
+        worker = nullptr;
+        flush();
+    }
+
+    auto Encoder::getOutputStatistics() const noexcept -> EncoderOutput::Statistics
+    {
+        return output != nullptr ? output->getStatistics() : EncoderOutput::Statistics{};
+    }
+
+    bool Encoder::write(const void *data, std::size_t size)
+    {
+        auto bytes = static_cast<const std::uint8_t *>(data);
+
+        while (!outputFailed) {
+            const auto stored = output->write(bytes, size);
+            bytes += stored;
+            size -= stored;
+            fileSize += stored;
+
+            if (const auto chunks = fileSize / EncoderOutput::chunkSize; chunks != chunksFilled) {
+                chunksFilled = chunks;
+                if (worker != nullptr) {
+                    worker->requestFlush();
+                }
+                else {
+                    flush();
+                }
+            }
+
+            if (size == 0) {
+                return true;
+            }
+            if (worker != nullptr && !worker->waitForFlush(flushTimeout)) {
+                // a slow flash is not a failure, only a failed write of the file ends the recording
+                LOG_WARN("Encoder output stalled, %zu chunks wait for the flush", output->pending());
+                worker->requestFlush();
+            }
+        }
+        return false;
+    }
+
+    void Encoder::finish()
+    {
+        if (output == nullptr) {
+            return;
+        }
+        stopFlushWorker();
+        if (!outputFailed && !output->finish()) {
+            outputFailed = true;
+        }
+        HeaderUpdate(output->getFlushedSize());
+    }
+
+    bool Encoder::writeHeader(const void *header, std::size_t size)
+    {
+        if (!output->writeHeader(header, size)) {
+            LOG_ERROR("Updating the header of %s failed", filePath.c_str());
+            outputFailed = true;
+            return false;
+        }
+        return true;
+    }
+
+    void Encoder::flush()
+    {
+        if (outputFailed) {
+            return;
+        }
+        if (!output->flush()) {
+            LOG_ERROR("Writing %s failed", filePath.c_str());
+            outputFailed = true;
+            return;
+        }
+
+        const auto chunks = output->getFlushedSize() / EncoderOutput::chunkSize;
+        if (chunks >= headerChunks + headerUpdateInterval) {
+            headerChunks = chunks;
+            HeaderUpdate(output->getFlushedSize());
+        }
+    }
 } // namespace audio
@@ -3,23 +3,33 @@
 
 #pragma once
 
+#include "EncoderOutput.hpp"
+#include <Audio/AudioCommon.hpp>
+
+#include <atomic>
 #include <memory>
 #include <cstdio>
 #include <string>
 
 namespace audio
 {
+    class EncoderWorker;
 
     class Encoder
     {
       public:
+        /// Chunks written between the header updates, at most that much of the recording is lost on a power loss
+        static constexpr std::size_t headerUpdateInterval = 16;
+
         struct Format
         {
             std::uint32_t chanNr;
             std::uint32_t sampleRate;
         };
 
-        static std::unique_ptr<Encoder> Create(const std::string &filePath, const Format &frmt);
+        static std::unique_ptr<Encoder> Create(const std::string &filePath,
+                                               const Format &frmt,
+                                               RecordingFormat recordingFormat = RecordingFormat::Pcm);
 
         Encoder(const std::string &filePath, const Format &frmt);
 
@@ -27,6 +37,15 @@ namespace audio
 
         virtual std::uint32_t Encode(std::uint32_t samplesToWrite, std::int16_t *pcmData) = 0;
 
+        /**
+         * @brief Moves writing the file to a worker, without it the data is written by Encode
+         */
+        void startFlushWorker();
+        /**
+         * @brief Writes the data collected by the worker and stops it
+         */
+        void stopFlushWorker();
+
         float getCurrentPosition()
         {
             return position;
@@ -37,16 +56,52 @@ namespace audio
             return fileSize;
         }
 
+        [[nodiscard]] auto getOutputStatistics() const noexcept -> EncoderOutput::Statistics;
+
+        /**
+         * @brief The file could not be written, e.g. the disk is full, nothing more will be recorded
+         */
+        [[nodiscard]] bool hasOutputFailed() const noexcept
+        {
+            return outputFailed;
+        }
+
         const Format format;
 
       protected:
-        float position = 0;
-        std::FILE *fd  = nullptr;
-        std::unique_ptr<char[]> streamBuffer;
-        std::uint32_t fileSize = 0;
+        /**
+         * @brief Passes the encoded data to the file, waiting for the worker while all chunks wait for the flush
+         *
+         * @return false if the data could not be stored, e.g. the disk is full
+         */
+        bool write(const void *data, std::size_t size);
+        /**
+         * @brief Writes the remaining data and the final header, to be called by the destructors of the encoders
+         */
+        void finish();
+        /**
+         * @brief Rewrites the header for the data written so far, called from the flushing context
+         *
+         * @param fileLength - bytes written to the file, header included
+         */
+        virtual void HeaderUpdate(std::uint32_t fileLength) = 0;
+        bool writeHeader(const void *header, std::size_t size);
+
+        float position         = 0;
+        std::FILE *fd          = nullptr;
+        std::uint32_t fileSize = 0; ///< Bytes passed to the file, header included
         std::string filePath;
 
         bool isInitialized = false;
+
+      private:
+        void flush();
+
+        std::unique_ptr<EncoderOutput> output;
+        std::unique_ptr<EncoderWorker> worker;
+        std::size_t chunksFilled = 0; ///< Full chunks, the worker is notified about each
+        std::size_t headerChunks = 0; ///< Chunks in the file at the last header update
+        std::atomic<bool> outputFailed{false};
     };
 
 } // namespace audio
@@ -0,0 +1,211 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "EncoderADPCM.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace audio
+{
+    namespace
+    {
+        constexpr std::uint16_t formatImaAdpcm  = 0x0011;
+        constexpr std::uint16_t bitsPerSample   = 4;
+        constexpr std::size_t blockHeaderSize   = 4; ///< Per channel
+        constexpr std::size_t blockBytesPerRate = 256;
+        constexpr std::uint32_t blockRateUnit   = 11025;
+
+        constexpr std::array<std::int16_t, 89> stepTable{
+            7,     8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,    25,    28,
+            31,    34,    37,    41,    45,    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+            130,   143,   157,   173,   190,   209,   230,   253,   279,   307,   337,   371,   408,   449,   494,
+            544,   598,   658,   724,   796,   876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+            2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,  5894,  6484,  7132,  7845,  8630,
+            9493,  10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+        constexpr std::array<std::int8_t, 16> indexTable{-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+
+        void putLE(std::uint8_t *out, std::uint32_t value, std::size_t bytes)
+        {
+            for (std::size_t i = 0; i < bytes; ++i) {
+                out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+            }
+        }
+    } // namespace
+
+    EncoderADPCM::EncoderADPCM(const std::string &filePath, const Encoder::Format &frmt) : Encoder(filePath, frmt)
+    {
+        if (!isInitialized || format.chanNr == 0 || format.chanNr > maxChannels || format.sampleRate == 0) {
+            isInitialized = false;
+            return;
+        }
+
+        /* Blocks of 256 bytes per channel up to 11 kHz, longer for the higher rates, as other encoders do */
+        const auto rateFactor = std::max<std::uint32_t>(1, format.sampleRate / blockRateUnit);
+        blockAlign            = blockBytesPerRate * format.chanNr * rateFactor;
+        samplesPerBlock       = (blockAlign - blockHeaderSize * format.chanNr) * 2 / format.chanNr + 1;
+        frames                = std::make_unique<std::int16_t[]>(samplesPerBlock * format.chanNr);
+        block                 = std::make_unique<std::uint8_t[]>(blockAlign);
+
+        HeaderInit();
+        if (!write(pHeaderBuff, sizeof(pHeaderBuff))) {
+            isInitialized = false;
+        }
+    }
+
+    EncoderADPCM::~EncoderADPCM()
+    {
+        if (isInitialized && framesCount > 0) {
+            encodeBlock();
+        }
+        /* Write the remaining blocks and the final header */
+        finish();
+    }
+
+    std::uint32_t EncoderADPCM::Encode(std::uint32_t samplesToWrite, std::int16_t *pcmData)
+    {
+        const auto channels = format.chanNr;
+        const auto total    = samplesToWrite / channels;
+
+        for (std::uint32_t frame = 0; frame < total;) {
+            const auto toCopy = std::min<std::size_t>(total - frame, samplesPerBlock - framesCount);
+            std::memcpy(
+                &frames[framesCount * channels], &pcmData[frame * channels], toCopy * channels * sizeof(*pcmData));
+            framesCount += toCopy;
+            frame += toCopy;
+
+            if (framesCount == samplesPerBlock && !encodeBlock()) {
+                return 0;
+            }
+        }
+
+        position += static_cast<float>(total) / static_cast<float>(format.sampleRate);
+        return samplesToWrite;
+    }
+
+    auto EncoderADPCM::getBlockAlign() const noexcept -> std::size_t
+    {
+        return blockAlign;
+    }
+
+    auto EncoderADPCM::getSamplesPerBlock() const noexcept -> std::size_t
+    {
+        return samplesPerBlock;
+    }
+
+    auto EncoderADPCM::encodeSample(ChannelState &state, std::int16_t sample) noexcept -> std::uint8_t
+    {
+        const auto step = stepTable[state.index];
+        auto diff       = static_cast<std::int32_t>(sample) - state.predictor;
+
+        std::uint8_t nibble = 0;
+        if (diff < 0) {
+            nibble = 8;
+            diff   = -diff;
+        }
+
+        /* Quantize the difference and reconstruct it exactly as the decoder will */
+        auto quantized = step >> 3;
+        if (diff >= step) {
+            nibble |= 4;
+            diff -= step;
+            quantized += step;
+        }
+        if (diff >= step >> 1) {
+            nibble |= 2;
+            diff -= step >> 1;
+            quantized += step >> 1;
+        }
+        if (diff >= step >> 2) {
+            nibble |= 1;
+            quantized += step >> 2;
+        }
+
+        state.predictor += (nibble & 8) != 0 ? -quantized : quantized;
+        state.predictor = std::clamp<std::int32_t>(state.predictor, INT16_MIN, INT16_MAX);
+        state.index     = std::clamp<std::int32_t>(state.index + indexTable[nibble], 0, stepTable.size() - 1);
+        return nibble;
+    }
+
+    bool EncoderADPCM::encodeBlock()
+    {
+        const auto channels = format.chanNr;
+
+        /* A block cut short at the end of the recording is padded with its last frame */
+        for (auto frame = framesCount; frame < samplesPerBlock; ++frame) {
+            std::memcpy(&frames[frame * channels], &frames[(framesCount - 1) * channels], channels * sizeof(frames[0]));
+        }
+
+        /* Block header: the first frame is stored as is, along with the step index of every channel */
+        auto out = block.get();
+        for (std::size_t channel = 0; channel < channels; ++channel) {
+            auto &state     = states[channel];
+            state.predictor = frames[channel];
+            putLE(out, static_cast<std::uint16_t>(frames[channel]), 2);
+            out[2] = static_cast<std::uint8_t>(state.index);
+            out[3] = 0;
+            out += blockHeaderSize;
+        }
+
+        /* Channels interleaved every 8 samples, 2 samples per byte with the earlier one in the low nibble */
+        for (std::size_t first = 1; first < samplesPerBlock; first += 8) {
+            for (std::size_t channel = 0; channel < channels; ++channel) {
+                auto &state = states[channel];
+                for (std::size_t i = 0; i < 8; i += 2) {
+                    const auto low  = encodeSample(state, frames[(first + i) * channels + channel]);
+                    const auto high = encodeSample(state, frames[(first + i + 1) * channels + channel]);
+                    *out++          = low | (high << 4);
+                }
+            }
+        }
+
+        framesEncoded += framesCount;
+        framesCount = 0;
+        return write(block.get(), blockAlign);
+    }
+
+    void EncoderADPCM::HeaderInit()
+    {
+        const auto byteRate = static_cast<std::uint32_t>(format.sampleRate * blockAlign / samplesPerBlock);
+
+        std::memcpy(&pHeaderBuff[0], "RIFF", 4);
+        std::memcpy(&pHeaderBuff[8], "WAVE", 4);
+
+        /* Format chunk with the size of the IMA ADPCM blocks */
+        std::memcpy(&pHeaderBuff[12], "fmt ", 4);
+        putLE(&pHeaderBuff[16], 20, 4);
+        putLE(&pHeaderBuff[20], formatImaAdpcm, 2);
+        putLE(&pHeaderBuff[22], format.chanNr, 2);
+        putLE(&pHeaderBuff[24], format.sampleRate, 4);
+        putLE(&pHeaderBuff[28], byteRate, 4);
+        putLE(&pHeaderBuff[32], blockAlign, 2);
+        putLE(&pHeaderBuff[34], bitsPerSample, 2);
+        putLE(&pHeaderBuff[36], 2, 2);
+        putLE(&pHeaderBuff[38], samplesPerBlock, 2);
+
+        /* Fact chunk with the number of frames, required for compressed formats */
+        std::memcpy(&pHeaderBuff[40], "fact", 4);
+        putLE(&pHeaderBuff[44], 4, 4);
+
+        std::memcpy(&pHeaderBuff[52], "data", 4);
+
+        /* Sizes are filled in by the header updates */
+    }
+
+    void EncoderADPCM::HeaderUpdate(std::uint32_t fileLength)
+    {
+        if (fileLength < headerSize) {
+            return;
+        }
+        /* Only whole blocks are declared, a partially written one is ignored by the players */
+        const auto blocks   = (fileLength - headerSize) / blockAlign;
+        const auto dataSize = blocks * blockAlign;
+        const auto length   = std::min<std::size_t>(blocks * samplesPerBlock, framesEncoded);
+
+        putLE(&pHeaderBuff[4], headerSize - 8 + dataSize, 4);
+        putLE(&pHeaderBuff[48], length, 4);
+        putLE(&pHeaderBuff[56], dataSize, 4);
+
+        writeHeader(pHeaderBuff, sizeof(pHeaderBuff));
+    }
+} // namespace audio
@@ -0,0 +1,59 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include "Encoder.hpp"
+
+#include <array>
+#include <atomic>
+
+namespace audio
+{
+    /**
+     * @brief IMA ADPCM WAV encoder.
+     *
+     * Each 16-bit sample is coded as a 4-bit step from the previous one, so the file takes about a quarter of
+     * the PCM WAV size, at a cost of a few operations per sample. Samples are coded in blocks which start with
+     * the exact sample and step size of every channel, the blocks of a file cut short by a power loss remain
+     * decodable.
+     */
+    class EncoderADPCM : public Encoder
+    {
+      public:
+        static constexpr std::size_t maxChannels = 2;
+        static constexpr std::size_t headerSize  = 60;
+
+        EncoderADPCM(const std::string &filePath, const Encoder::Format &frmt);
+
+        ~EncoderADPCM();
+
+        std::uint32_t Encode(std::uint32_t samplesToWrite, std::int16_t *pcmData) override final;
+
+        [[nodiscard]] auto getBlockAlign() const noexcept -> std::size_t;
+        [[nodiscard]] auto getSamplesPerBlock() const noexcept -> std::size_t;
+
+      protected:
+        void HeaderUpdate(std::uint32_t fileLength) override;
+
+      private:
+        struct ChannelState
+        {
+            std::int32_t predictor = 0;
+            std::int32_t index     = 0;
+        };
+
+        static auto encodeSample(ChannelState &state, std::int16_t sample) noexcept -> std::uint8_t;
+        bool encodeBlock();
+        void HeaderInit();
+
+        std::size_t blockAlign      = 0; ///< Bytes per block
+        std::size_t samplesPerBlock = 0; ///< Frames per block
+        std::array<ChannelState, maxChannels> states;
+        std::unique_ptr<std::int16_t[]> frames; ///< Frames of the block being collected
+        std::size_t framesCount = 0;
+        std::unique_ptr<std::uint8_t[]> block;
+        std::atomic<std::uint32_t> framesEncoded{0};
+        std::uint8_t pHeaderBuff[headerSize] = {0};
+    };
+} // namespace audio
@@ -0,0 +1,115 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "EncoderOutput.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <unistd.h>
+
+namespace audio
+{
+    EncoderOutput::EncoderOutput(std::FILE *fd)
+        : fd(fd), buffer(std::make_unique<std::uint8_t[]>(chunkSize * chunkCount))
+    {}
+
+    auto EncoderOutput::write(const void *data, std::size_t size) -> std::size_t
+    {
+        auto in           = static_cast<const std::uint8_t *>(data);
+        std::size_t total = 0;
+
+        while (total < size) {
+            if (pending() == chunkCount) {
+                ++statistics.overflows;
+                break;
+            }
+
+            const auto chunk  = buffer.get() + (filled % chunkCount) * chunkSize;
+            const auto toCopy = std::min(size - total, chunkSize - fill);
+            std::memcpy(chunk + fill, in + total, toCopy);
+            total += toCopy;
+            fill += toCopy;
+
+            if (fill == chunkSize) {
+                fill = 0;
+                ++filled;
+            }
+        }
+        return total;
+    }
+
+    auto EncoderOutput::pending() const noexcept -> std::size_t
+    {
+        return filled - flushed;
+    }
+
+    auto EncoderOutput::flush() -> bool
+    {
+        while (pending() > 0) {
+            if (!writeChunk(flushed % chunkCount, chunkSize)) {
+                return false;
+            }
+            ++flushed;
+        }
+        return true;
+    }
+
+    auto EncoderOutput::finish() -> bool
+    {
+        if (!flush()) {
+            return false;
+        }
+        if (fill == 0) {
+            return true;
+        }
+        if (!writeChunk(filled % chunkCount, fill)) {
+            return false;
+        }
+        fill = 0;
+        return true;
+    }
+
+    auto EncoderOutput::writeHeader(const void *header, std::size_t size) -> bool
+    {
+        if (std::fseek(fd, 0, SEEK_SET) != 0) {
+            return false;
+        }
+        const auto written = std::fwrite(header, 1, size, fd);
+        if (std::fseek(fd, 0, SEEK_END) != 0 || written != size) {
+            return false;
+        }
+
+        ++statistics.fileWrites;
+        ++statistics.headerUpdates;
+        statistics.bytesWritten += written;
+        return sync();
+    }
+
+    auto EncoderOutput::getFlushedSize() const noexcept -> std::size_t
+    {
+        return flushedSize;
+    }
+
+    auto EncoderOutput::getStatistics() const noexcept -> Statistics
+    {
+        return statistics;
+    }
+
+    auto EncoderOutput::writeChunk(std::size_t index, std::size_t size) -> bool
+    {
+        const auto written = std::fwrite(buffer.get() + index * chunkSize, 1, size, fd);
+        flushedSize += written;
+        ++statistics.fileWrites;
+        statistics.bytesWritten += written;
+        return written == size;
+    }
+
+    auto EncoderOutput::sync() -> bool
+    {
+        if (std::fflush(fd) != 0) {
+            return false;
+        }
+        const auto descriptor = fileno(fd);
+        return descriptor < 0 || fsync(descriptor) == 0;
+    }
+} // namespace audio
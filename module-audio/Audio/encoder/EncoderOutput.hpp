@@ -0,0 +1,90 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+namespace audio
+{
+    /**
+     * @brief Buffered output of an encoder.
+     *
+     * Encoded data is collected in a ring of chunks. Full chunks are written by flush(), which is meant to run
+     * in a worker, so that the recording never waits for the file and flash is written with a few large writes
+     * aligned to chunkSize instead of a small one for every recorded block. The file header is part of the first
+     * chunk and is rewritten in place by writeHeader().
+     *
+     * write() and flush() may run concurrently, one producer and one flushing thread. finish() may run only when
+     * neither of them does.
+     */
+    class EncoderOutput
+    {
+      public:
+        static constexpr std::size_t chunkSize  = 8 * 1024;
+        static constexpr std::size_t chunkCount = 4;
+
+        struct Statistics
+        {
+            std::uint32_t fileWrites    = 0; ///< Writes to the file, header updates included
+            std::uint32_t bytesWritten  = 0; ///< Bytes written to the file, header updates included
+            std::uint32_t headerUpdates = 0; ///< Header rewrites
+            std::uint32_t overflows     = 0; ///< Writes which found all chunks waiting for the flush
+        };
+
+        explicit EncoderOutput(std::FILE *fd);
+
+        /**
+         * @brief Copies data into the chunks
+         *
+         * @return number of bytes stored, less than size if all chunks are waiting for the flush
+         */
+        auto write(const void *data, std::size_t size) -> std::size_t;
+
+        /**
+         * @brief Number of full chunks waiting for the flush
+         */
+        [[nodiscard]] auto pending() const noexcept -> std::size_t;
+
+        /**
+         * @brief Writes the full chunks to the file
+         *
+         * @return false if the file could not be written, e.g. the disk is full
+         */
+        auto flush() -> bool;
+
+        /**
+         * @brief Writes the full chunks and the beginning of the chunk being filled
+         */
+        auto finish() -> bool;
+
+        /**
+         * @brief Rewrites the beginning of the file and makes all data written so far durable
+         */
+        auto writeHeader(const void *header, std::size_t size) -> bool;
+
+        /**
+         * @brief Size of the file written so far
+         */
+        [[nodiscard]] auto getFlushedSize() const noexcept -> std::size_t;
+
+        [[nodiscard]] auto getStatistics() const noexcept -> Statistics;
+
+      private:
+        auto writeChunk(std::size_t index, std::size_t size) -> bool;
+        auto sync() -> bool;
+
+        std::FILE *fd;
+        std::unique_ptr<std::uint8_t[]> buffer;
+        std::size_t fill = 0; ///< Bytes in the chunk being filled
+        /// Chunks filled and flushed since the start, the difference is the number of chunks waiting
+        std::atomic<std::size_t> filled{0};
+        std::atomic<std::size_t> flushed{0};
+        std::size_t flushedSize = 0;
+        Statistics statistics;
+    };
+} // namespace audio
@@ -23,31 +23,29 @@ namespace audio
         WaveFormat.BlockAlign = WaveFormat.NbrChannels * (WaveFormat.BitPerSample / 8); /* channels * bits/sample / 8 */
 
         HeaderInit(WaveFormat);
+        if (isInitialized && !write(pHeaderBuff, sizeof(pHeaderBuff))) {
+            isInitialized = false;
+        }
     }
 
     EncoderWAV::~EncoderWAV()
     {
-        std::rewind(fd);
-        /* Update the wav file header save it into wav file */
-        HeaderUpdate();
-        if (std::fwrite(pHeaderBuff, 1, sizeof(WAVE_FormatTypeDef), fd) != sizeof(WAVE_FormatTypeDef)) {
-            LOG_ERROR("Updating WAV header failed");
-        }
+        /* Write the remaining samples and the final wav file header */
+        finish();
     }
 
     std::uint32_t EncoderWAV::Encode(std::uint32_t samplesToWrite, std::int16_t *pcmData)
     {
         /*
-         * Write int16_t PCM samples to file.
+         * Pass int16_t PCM samples to the file.
          */
-        auto byteswritten = std::fwrite(pcmData, sizeof(std::int16_t), samplesToWrite, fd);
-        if (byteswritten != samplesToWrite) {
+        if (!write(pcmData, samplesToWrite * sizeof(std::int16_t))) {
             return 0;
         }
 
         /* Calculate frame duration in seconds */
         position += static_cast<float>(samplesToWrite / format.chanNr) / static_cast<float>(format.sampleRate);
-        return byteswritten;
+        return samplesToWrite;
     }
 
     void EncoderWAV::HeaderInit(const EncoderWAV::WAVE_FormatTypeDef &pWaveFormatStruct)
@@ -115,22 +113,27 @@ namespace audio
         pHeaderBuff[43] = 0x00;
     }
 
-    void EncoderWAV::HeaderUpdate()
+    void EncoderWAV::HeaderUpdate(std::uint32_t fileLength)
     {
-        /* Write the file length ---------------------------------------------------*/
-        /* The sampling time: this value will be written back at the end of the
-           recording operation.  Example: 661500 Btyes = 0x000A17FC, byte[7]=0x00, byte[4]=0xFC */
-        pHeaderBuff[4] = (std::uint8_t)(fileSize);
-        pHeaderBuff[5] = (std::uint8_t)(fileSize >> 8);
-        pHeaderBuff[6] = (std::uint8_t)(fileSize >> 16);
-        pHeaderBuff[7] = (std::uint8_t)(fileSize >> 24);
+        if (fileLength < sizeof(pHeaderBuff)) {
+            return;
+        }
+        /* Write the RIFF chunk length ---------------------------------------------*/
+        /* Updated periodically while recording and at the end of the recording
+           operation.  Example: 661500 Btyes = 0x000A17FC, byte[7]=0x00, byte[4]=0xFC */
+        const std::uint32_t riffSize = fileLength - 8;
+        pHeaderBuff[4]               = (std::uint8_t)(riffSize);
+        pHeaderBuff[5]               = (std::uint8_t)(riffSize >> 8);
+        pHeaderBuff[6]               = (std::uint8_t)(riffSize >> 16);
+        pHeaderBuff[7]               = (std::uint8_t)(riffSize >> 24);
         /* Write the number of sample data -----------------------------------------*/
-        /* This variable will be written back at the end of the recording operation */
-        fileSize -= 44;
-        pHeaderBuff[40] = (std::uint8_t)(fileSize);
-        pHeaderBuff[41] = (std::uint8_t)(fileSize >> 8);
-        pHeaderBuff[42] = (std::uint8_t)(fileSize >> 16);
-        pHeaderBuff[43] = (std::uint8_t)(fileSize >> 24);
+        const std::uint32_t dataSize = fileLength - sizeof(pHeaderBuff);
+        pHeaderBuff[40]              = (std::uint8_t)(dataSize);
+        pHeaderBuff[41]              = (std::uint8_t)(dataSize >> 8);
+        pHeaderBuff[42]              = (std::uint8_t)(dataSize >> 16);
+        pHeaderBuff[43]              = (std::uint8_t)(dataSize >> 24);
+
+        writeHeader(pHeaderBuff, sizeof(pHeaderBuff));
     }
 
 } // namespace audio
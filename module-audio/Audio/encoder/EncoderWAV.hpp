@@ -17,6 +17,9 @@ namespace audio
 
         std::uint32_t Encode(std::uint32_t samplesToWrite, std::int16_t *pcmData) override final;
 
+      protected:
+        void HeaderUpdate(std::uint32_t fileLength) override;
+
       private:
         using WAVE_FormatTypeDef = struct
         {
@@ -38,8 +41,6 @@ namespace audio
 
         void HeaderInit(const WAVE_FormatTypeDef &pWaveFormatStruct);
 
-        void HeaderUpdate();
-
         std::uint8_t pHeaderBuff[44] = {0};
     };
 
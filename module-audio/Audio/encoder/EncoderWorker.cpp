@@ -0,0 +1,38 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "EncoderWorker.hpp"
+
+audio::EncoderWorker::EncoderWorker(FlushCallback flushCallback)
+    : sys::Worker(EncoderWorker::workerName, EncoderWorker::workerPriority, stackDepth),
+      flushCallback(std::move(flushCallback))
+{}
+
+auto audio::EncoderWorker::requestFlush() -> bool
+{
+    return sendCommand({.command = static_cast<std::uint32_t>(Command::Flush), .data = nullptr});
+}
+
+auto audio::EncoderWorker::waitForFlush(TickType_t timeout) -> bool
+{
+    return flushSemaphore.Take(timeout);
+}
+
+auto audio::EncoderWorker::handleMessage(std::uint32_t queueID) -> bool
+{
+    auto &queue = queues[queueID];
+    if (queue->GetQueueName() != SERVICE_QUEUE_NAME) {
+        return true;
+    }
+
+    sys::WorkerCommand cmd;
+    if (getServiceQueue().Dequeue(&cmd, 0)) {
+        switch (static_cast<Command>(cmd.command)) {
+        case Command::Flush:
+            flushCallback();
+            flushSemaphore.Give();
+            break;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,47 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <Service/Worker.hpp>
+#include <semaphore.hpp>
+
+#include <functional>
+
+namespace audio
+{
+    /**
+     * @brief Writes the encoded data to the file in the background, on request of the encoder
+     */
+    class EncoderWorker : public sys::Worker
+    {
+      public:
+        using FlushCallback = std::function<void()>;
+
+        explicit EncoderWorker(FlushCallback flushCallback);
+
+        auto requestFlush() -> bool;
+        /**
+         * @brief Waits for the end of a flush
+         *
+         * @param timeout - ticks to wait
+         * @return false if no flush ended in time
+         */
+        auto waitForFlush(TickType_t timeout) -> bool;
+
+      private:
+        enum class Command
+        {
+            Flush
+        };
+
+        static constexpr std::size_t stackDepth = 4 * 1024;
+        static constexpr auto workerName        = "EncoderWorker";
+        static constexpr auto workerPriority    = static_cast<UBaseType_t>(sys::ServicePriority::Low);
+
+        auto handleMessage(std::uint32_t queueID) -> bool override;
+
+        FlushCallback flushCallback;
+        cpp_freertos::BinarySemaphore flushSemaphore;
+    };
+} // namespace audio
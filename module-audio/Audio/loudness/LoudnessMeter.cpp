@@ -0,0 +1,189 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "LoudnessMeter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace audio::loudness
+{
+    namespace
+    {
+        constexpr double pi            = 3.14159265358979323846;
+        constexpr double fullScale     = 32768.0;
+        constexpr double loudnessShift = -0.691; // offset of the BS.1770 loudness formula
+        constexpr double relativeGate  = -10.0;
+
+        auto toLoudness(double power) -> double
+        {
+            return loudnessShift + 10.0 * std::log10(power);
+        }
+
+        auto toPower(double loudness) -> double
+        {
+            return std::pow(10.0, (loudness - loudnessShift) / 10.0);
+        }
+    } // namespace
+
+    auto playbackGain(const Measurement &measurement) noexcept -> float
+    {
+        return std::min({referenceLoudness - measurement.integrated, maxBoost, -measurement.peak});
+    }
+
+    LoudnessMeter::LoudnessMeter(std::uint32_t sampleRate, std::uint32_t channels)
+        : channels(channels), samplesPerStep((sampleRate + 5) / 10), histogram(histogramBins)
+    {
+        if (channels == 0 || channels > maxChannels || samplesPerStep == 0) {
+            throw std::invalid_argument("Unsupported loudness meter format");
+        }
+
+        // K-weighting filters of BS.1770 designed for the sample rate, the reference coefficients are given for 48 kHz
+        const auto rate = static_cast<double>(sampleRate);
+
+        constexpr double shelvingFrequency = 1681.974450955533;
+        constexpr double shelvingGain      = 3.999843853973347;
+        constexpr double shelvingQ         = 0.7071752369554196;
+        auto k                             = std::tan(pi * shelvingFrequency / rate);
+        const auto vh                      = std::pow(10.0, shelvingGain / 20.0);
+        const auto vb                      = std::pow(vh, 0.4996667741545416);
+        auto a0                            = 1.0 + k / shelvingQ + k * k;
+        shelving                           = Biquad{.b0 = (vh + vb * k / shelvingQ + k * k) / a0,
+                                                    .b1 = 2.0 * (k * k - vh) / a0,
+                                                    .b2 = (vh - vb * k / shelvingQ + k * k) / a0,
+                                                    .a1 = 2.0 * (k * k - 1.0) / a0,
+                                                    .a2 = (1.0 - k / shelvingQ + k * k) / a0};
+
+        constexpr double highpassFrequency = 38.13547087602444;
+        constexpr double highpassQ         = 0.5003270373238773;
+        k                                  = std::tan(pi * highpassFrequency / rate);
+        a0                                 = 1.0 + k / highpassQ + k * k;
+        highpass                           = Biquad{.b0 = 1.0,
+                                                    .b1 = -2.0,
+                                                    .b2 = 1.0,
+                                                    .a1 = 2.0 * (k * k - 1.0) / a0,
+                                                    .a2 = (1.0 - k / highpassQ + k * k) / a0};
+
+        reset();
+    }
+
+    void LoudnessMeter::process(const std::int16_t *samples, std::size_t frames) noexcept
+    {
+        for (std::size_t frame = 0; frame < frames; ++frame) {
+            for (std::uint32_t channel = 0; channel < channels; ++channel) {
+                const auto sample = samples[frame * channels + channel];
+                peak              = std::max(peak, std::abs(static_cast<std::int32_t>(sample)));
+
+                auto &state = states[channel];
+                const auto y =
+                    weight(highpass, state[1], weight(shelving, state[0], static_cast<double>(sample) / fullScale));
+                stepPower += y * y;
+            }
+
+            if (++stepFill == samplesPerStep) {
+                finishStep();
+            }
+        }
+    }
+
+    auto LoudnessMeter::weight(const Biquad &filter, State &state, double x) noexcept -> double
+    {
+        const auto y =
+            filter.b0 * x + filter.b1 * state.x1 + filter.b2 * state.x2 - filter.a1 * state.y1 - filter.a2 * state.y2;
+        state.x2 = state.x1;
+        state.x1 = x;
+        state.y2 = state.y1;
+        state.y1 = y;
+        return y;
+    }
+
+    void LoudnessMeter::finishStep() noexcept
+    {
+        // channel weights are 1 for left and right, so the block power is the sum of the channels' mean squares
+        steps[stepsCount % stepsPerBlock] = stepPower / samplesPerStep;
+        ++stepsCount;
+        stepPower = 0;
+        stepFill  = 0;
+
+        if (stepsCount >= stepsPerBlock) {
+            double power = 0;
+            for (const auto step : steps) {
+                power += step;
+            }
+            addBlock(power / stepsPerBlock);
+        }
+    }
+
+    void LoudnessMeter::addBlock(double power) noexcept
+    {
+        if (power <= 0) {
+            return;
+        }
+        const auto loudness = toLoudness(power);
+        if (loudness < histogramMinimum) {
+            return; // absolute gate
+        }
+        const auto bin = static_cast<std::size_t>((loudness - histogramMinimum) / histogramResolution);
+        ++histogram[std::min(bin, histogramBins - 1)];
+    }
+
+    auto LoudnessMeter::getIntegratedLoudness() const -> std::optional<float>
+    {
+        const auto binLoudness = [](std::size_t bin) {
+            return histogramMinimum + (static_cast<double>(bin) + 0.5) * histogramResolution;
+        };
+        const auto meanPower = [&](std::size_t firstBin) -> std::optional<double> {
+            double sum         = 0;
+            std::uint64_t count = 0;
+            for (auto bin = firstBin; bin < histogramBins; ++bin) {
+                sum += histogram[bin] * toPower(binLoudness(bin));
+                count += histogram[bin];
+            }
+            if (count == 0) {
+                return std::nullopt;
+            }
+            return sum / count;
+        };
+
+        const auto absoluteGated = meanPower(0);
+        if (!absoluteGated.has_value()) {
+            return std::nullopt;
+        }
+
+        const auto threshold = toLoudness(*absoluteGated) + relativeGate;
+        auto firstBin        = static_cast<std::size_t>(
+            std::clamp((threshold - histogramMinimum) / histogramResolution, 0.0, histogramBins - 1.0));
+        if (binLoudness(firstBin) < threshold) {
+            ++firstBin;
+        }
+
+        const auto relativeGated = meanPower(firstBin);
+        if (!relativeGated.has_value()) {
+            return std::nullopt;
+        }
+        return static_cast<float>(toLoudness(*relativeGated));
+    }
+
+    auto LoudnessMeter::getSamplePeak() const noexcept -> float
+    {
+        return static_cast<float>(20.0 * std::log10(std::max(peak, std::int32_t{1}) / fullScale));
+    }
+
+    auto LoudnessMeter::getMeasurement() const -> Measurement
+    {
+        return Measurement{.integrated = getIntegratedLoudness().value_or(silenceLoudness), .peak = getSamplePeak()};
+    }
+
+    void LoudnessMeter::reset() noexcept
+    {
+        states     = {};
+        stepPower  = 0;
+        stepFill   = 0;
+        steps      = {};
+        stepsCount = 0;
+        peak       = 0;
+        std::fill(histogram.begin(), histogram.end(), 0);
+    }
+} // namespace audio::loudness
@@ -0,0 +1,91 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace audio::loudness
+{
+    /// ReplayGain 2.0 reference level in LUFS
+    inline constexpr float referenceLoudness = -18.0f;
+    /// Highest gain applied to quiet tracks in dB
+    inline constexpr float maxBoost = 6.0f;
+    /// Loudness reported for files too short or too quiet to be measured, the absolute gate of EBU R128
+    inline constexpr float silenceLoudness = -70.0f;
+
+    struct Measurement
+    {
+        float integrated{}; /// integrated loudness in LUFS
+        float peak{};       /// sample peak in dBFS
+    };
+
+    /// @brief Gain in dB bringing the measured track to the reference loudness without clipping its peak.
+    auto playbackGain(const Measurement &measurement) noexcept -> float;
+
+    /**
+     * @brief Integrated loudness meter following EBU R128 / ITU-R BS.1770-4 for mono and stereo 16-bit PCM.
+     *
+     * The signal is K-weighted, its power is summed in 100 ms steps forming 400 ms blocks overlapping by 75%.
+     * Block loudnesses are kept in a histogram of 0.1 LU bins rather than a list, so that the memory use does not
+     * depend on the track length. The absolute (-70 LUFS) and relative (-10 LU) gates are applied when the result is
+     * read. The meter can be fed in chunks of any size.
+     */
+    class LoudnessMeter
+    {
+      public:
+        /// @throws std::invalid_argument if the sample rate or the channel count is not supported
+        LoudnessMeter(std::uint32_t sampleRate, std::uint32_t channels);
+
+        /// @param samples - interleaved samples
+        /// @param frames - number of frames in the buffer
+        void process(const std::int16_t *samples, std::size_t frames) noexcept;
+
+        /// @return integrated loudness in LUFS or nothing if no block passed the gates
+        [[nodiscard]] auto getIntegratedLoudness() const -> std::optional<float>;
+        /// @return sample peak in dBFS
+        [[nodiscard]] auto getSamplePeak() const noexcept -> float;
+        [[nodiscard]] auto getMeasurement() const -> Measurement;
+
+        void reset() noexcept;
+
+      private:
+        static constexpr std::uint32_t maxChannels = 2;
+        static constexpr std::size_t stepsPerBlock = 4;
+        static constexpr float histogramMinimum    = silenceLoudness;
+        static constexpr float histogramMaximum    = 10.0f;
+        static constexpr float histogramResolution = 0.1f;
+        static constexpr std::size_t histogramBins = 800;
+
+        struct Biquad
+        {
+            double b0, b1, b2, a1, a2;
+        };
+
+        struct State
+        {
+            double x1, x2, y1, y2;
+        };
+
+        auto weight(const Biquad &filter, State &state, double x) noexcept -> double;
+        void finishStep() noexcept;
+        void addBlock(double power) noexcept;
+
+        const std::uint32_t channels;
+        const std::uint32_t samplesPerStep;
+        Biquad shelving;
+        Biquad highpass;
+        std::array<std::array<State, 2>, maxChannels> states;
+
+        double stepPower       = 0;
+        std::uint32_t stepFill = 0;
+        std::array<double, stepsPerBlock> steps;
+        std::size_t stepsCount = 0;
+        std::int32_t peak      = 0;
+
+        std::vector<std::uint32_t> histogram;
+    };
+} // namespace audio::loudness
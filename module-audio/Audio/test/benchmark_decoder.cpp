@@ -0,0 +1,386 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <Audio/decoder/Decoder.hpp>
+#include <Audio/encoder/Encoder.hpp>
+#include <Audio/PcmKernels.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+
+/* Heap usage of the decoders, including the C libraries, is counted by wrapping the allocator of the C library */
+namespace
+{
+    std::atomic<std::int64_t> heapInUse{0};
+    std::atomic<std::int64_t> heapPeak{0};
+    std::atomic<std::uint64_t> allocations{0};
+
+    void *countAllocation(void *ptr) noexcept
+    {
+        if (ptr != nullptr) {
+            const auto inUse = heapInUse += static_cast<std::int64_t>(malloc_usable_size(ptr));
+            auto peak        = heapPeak.load(std::memory_order_relaxed);
+            while (inUse > peak && !heapPeak.compare_exchange_weak(peak, inUse, std::memory_order_relaxed)) {}
+            ++allocations;
+        }
+        return ptr;
+    }
+
+    void countRelease(void *ptr) noexcept
+    {
+        if (ptr != nullptr) {
+            heapInUse -= static_cast<std::int64_t>(malloc_usable_size(ptr));
+        }
+    }
+} // namespace
+
+extern "C"
+{
+    void *__libc_malloc(std::size_t size);
+    void *__libc_calloc(std::size_t count, std::size_t size);
+    void *__libc_realloc(void *ptr, std::size_t size);
+    void __libc_free(void *ptr);
+
+    void *malloc(std::size_t size) noexcept
+    {
+        return countAllocation(__libc_malloc(size));
+    }
+
+    void *calloc(std::size_t count, std::size_t size) noexcept
+    {
+        return countAllocation(__libc_calloc(count, size));
+    }
+
+    void *realloc(void *ptr, std::size_t size) noexcept
+    {
+        countRelease(ptr);
+        return countAllocation(__libc_realloc(ptr, size));
+    }
+
+    void free(void *ptr) noexcept
+    {
+        countRelease(ptr);
+        __libc_free(ptr);
+    }
+}
+#endif
+
+namespace
+{
+    /// Samples requested from the decoder at once, a stream block of the playback
+    constexpr std::uint32_t samplesPerDecode = 1024;
+    /// Audio decoded per measurement, short files are decoded again from the beginning
+    constexpr double secondsPerMeasurement = 60.0;
+
+    struct HeapUsage
+    {
+        std::int64_t peakBytes    = 0;
+        std::uint64_t allocations = 0;
+    };
+
+    class HeapMeter
+    {
+      public:
+        HeapMeter()
+        {
+#if defined(__GLIBC__)
+            baseline = heapInUse.load();
+            heapPeak.store(baseline);
+            allocationsAtStart = allocations.load();
+#endif
+        }
+
+        auto usage() const -> HeapUsage
+        {
+#if defined(__GLIBC__)
+            return {heapPeak.load() - baseline, allocations.load() - allocationsAtStart};
+#else
+            return {};
+#endif
+        }
+
+      private:
+        std::int64_t baseline            = 0;
+        std::uint64_t allocationsAtStart = 0;
+    };
+
+    struct Result
+    {
+        std::string name;
+        std::string file;
+        std::uint32_t sampleRate = 0;
+        std::uint32_t channels   = 0;
+        double bitrate           = 0; ///< kbit/s
+        double audioSeconds      = 0;
+        double processSeconds    = 0;
+        HeapUsage heap;
+        std::uint64_t steadyAllocations = 0; ///< Made after the decoder was opened
+
+        /// Processing time per second of audio, the fraction of a core needed for real-time playback
+        auto realTimeFactor() const -> double
+        {
+            return processSeconds / audioSeconds;
+        }
+    };
+
+    auto secondsSince(std::chrono::steady_clock::time_point start) -> double
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /// Decodes a file into a null sink, rewinding it until enough audio is decoded
+    class DecoderWorkload
+    {
+      public:
+        explicit DecoderWorkload(std::string path) : path(std::move(path))
+        {}
+
+        /// Decodes one second of audio with the decoder kept open between the runs
+        auto run() -> std::uint64_t
+        {
+            if (decoder == nullptr) {
+                decoder = audio::Decoder::Create(path);
+                REQUIRE(decoder != nullptr);
+            }
+            return decode(decoder->getSampleRate() * decoder->getChannelCount());
+        }
+
+        auto measure() -> Result
+        {
+            const auto file = std::filesystem::path(path);
+            Result result{.name = file.extension().string().erase(0, 1), .file = file.filename().string()};
+
+            const HeapMeter meter;
+            decoder = audio::Decoder::Create(path);
+            if (decoder == nullptr) {
+                return result;
+            }
+            const auto opened = meter.usage();
+
+            result.sampleRate      = decoder->getSampleRate();
+            result.channels        = decoder->getChannelCount();
+            const auto samplesRate = result.sampleRate * result.channels;
+
+            const auto start   = std::chrono::steady_clock::now();
+            const auto samples = decode(static_cast<std::uint64_t>(samplesRate * secondsPerMeasurement));
+
+            result.processSeconds    = secondsSince(start);
+            result.heap              = meter.usage();
+            result.steadyAllocations = result.heap.allocations - opened.allocations;
+            result.audioSeconds      = static_cast<double>(samples) / samplesRate;
+
+            const auto fileSeconds = static_cast<double>(fileSamples) / samplesRate;
+            result.bitrate         = fileSeconds > 0 ? std::filesystem::file_size(path) * 8 / fileSeconds / 1000 : 0;
+            return result;
+        }
+
+      private:
+        auto decode(std::uint64_t samplesToDecode) -> std::uint64_t
+        {
+            std::uint64_t decoded = 0;
+            bool atStart          = true;
+            while (decoded < samplesToDecode) {
+                decoder->prefetchInput();
+                const auto samplesRead = decoder->decode(samplesPerDecode, sink.data());
+                if (samplesRead <= 0 && atStart) {
+                    break;
+                }
+                decoded += std::max(samplesRead, 0);
+                atStart = false;
+
+                if (samplesRead < static_cast<std::int32_t>(samplesPerDecode)) {
+                    fileSamples = fileSamples == 0 ? decoded : fileSamples;
+                    decoder->rewind();
+                    atStart = true;
+                }
+            }
+            return decoded;
+        }
+
+        std::string path;
+        std::unique_ptr<audio::Decoder> decoder;
+        std::vector<std::int16_t> sink = std::vector<std::int16_t>(samplesPerDecode);
+        std::uint64_t fileSamples      = 0; ///< Samples of the whole file, known after the first pass
+    };
+
+    /// The mono to stereo conversion of the decoding worker, applied to every decoded block of a mono file
+    class UpmixWorkload
+    {
+      public:
+        explicit UpmixWorkload(std::uint32_t rate) : rate(rate), buffer(samplesPerDecode)
+        {
+            for (std::size_t i = 0; i < buffer.size(); ++i) {
+                buffer[i] = static_cast<std::int16_t>(i * 37);
+            }
+        }
+
+        auto run() -> std::int16_t
+        {
+            audio::pcm::monoToStereo(buffer.data(), buffer.data(), buffer.size() / 2);
+            return buffer[1];
+        }
+
+        auto measure() -> Result
+        {
+            const auto blocks = static_cast<std::uint64_t>(rate * secondsPerMeasurement / (samplesPerDecode / 2));
+
+            Result result{.name = "upmix", .file = "-", .sampleRate = rate, .channels = 1};
+            const HeapMeter meter;
+            const auto start = std::chrono::steady_clock::now();
+            for (std::uint64_t block = 0; block < blocks; ++block) {
+                run();
+            }
+            result.processSeconds    = secondsSince(start);
+            result.heap              = meter.usage();
+            result.steadyAllocations = result.heap.allocations;
+            result.audioSeconds      = static_cast<double>(blocks * (samplesPerDecode / 2)) / rate;
+            return result;
+        }
+
+      private:
+        std::uint32_t rate;
+        std::vector<std::int16_t> buffer;
+    };
+
+    /// WAV files of the rates and channel counts the phone plays, written with the recording encoder
+    class GeneratedFiles
+    {
+      public:
+        GeneratedFiles()
+        {
+            constexpr std::pair<std::uint32_t, std::uint32_t> formats[] = {
+                {8000, 1}, {16000, 1}, {44100, 1}, {44100, 2}, {48000, 2}};
+            for (const auto &[rate, channels] : formats) {
+                const auto name =
+                    "decoder_benchmark_" + std::to_string(rate) + "_" + std::to_string(channels) + "ch.wav";
+                const auto path = (std::filesystem::temp_directory_path() / name).string();
+                write(path, rate, channels);
+                paths.push_back(path);
+            }
+        }
+
+        ~GeneratedFiles()
+        {
+            for (const auto &path : paths) {
+                std::filesystem::remove(path);
+            }
+        }
+
+        std::vector<std::string> paths;
+
+      private:
+        static void write(const std::string &path, std::uint32_t rate, std::uint32_t channels)
+        {
+            constexpr double pi = 3.14159265358979;
+            auto encoder = audio::Encoder::Create(path, audio::Encoder::Format{.chanNr = channels, .sampleRate = rate});
+            std::vector<std::int16_t> block(samplesPerDecode);
+            const auto frames = rate * 10;
+            for (std::uint32_t frame = 0; frame < frames; frame += block.size() / channels) {
+                for (std::size_t i = 0; i < block.size(); ++i) {
+                    const auto t = static_cast<double>(frame + i / channels) / rate;
+                    block[i]     = static_cast<std::int16_t>(8000 * std::sin(2 * pi * 440 * t) +
+                                                         3000 * std::sin(2 * pi * 3100 * t));
+                }
+                encoder->Encode(block.size(), block.data());
+            }
+        }
+    };
+
+    /// Reference files shipped with the tests, along with the files of the directory given in the environment
+    auto referenceFiles() -> std::vector<std::string>
+    {
+        std::vector<std::string> files{"testfiles/audio.mp3", "testfiles/audio.flac", "testfiles/audio.wav"};
+        if (const auto directory = std::getenv("DECODER_BENCHMARK_FILES"); directory != nullptr) {
+            std::vector<std::string> extra;
+            for (const auto &entry : std::filesystem::directory_iterator(directory)) {
+                if (entry.is_regular_file()) {
+                    extra.push_back(entry.path().string());
+                }
+            }
+            std::sort(extra.begin(), extra.end());
+            files.insert(files.end(), extra.begin(), extra.end());
+        }
+        return files;
+    }
+
+    /// Results as CSV, written to the file given in the environment for the comparison between commits
+    void report(const std::vector<Result> &results)
+    {
+        const auto reportPath = std::getenv("DECODER_BENCHMARK_REPORT");
+        auto out              = reportPath != nullptr ? std::fopen(reportPath, "w") : nullptr;
+
+        constexpr auto header = "name,file,sample_rate,channels,bitrate_kbps,audio_s,process_s,real_time_factor,"
+                                "peak_heap_bytes,allocations_per_audio_s\n";
+        std::printf("%s", header);
+        if (out != nullptr) {
+            std::fprintf(out, "%s", header);
+        }
+        for (const auto &result : results) {
+            char line[256];
+            std::snprintf(line,
+                          sizeof(line),
+                          "%s,%s,%u,%u,%.1f,%.2f,%.6f,%.6f,%lld,%.2f\n",
+                          result.name.c_str(),
+                          result.file.c_str(),
+                          static_cast<unsigned>(result.sampleRate),
+                          static_cast<unsigned>(result.channels),
+                          result.bitrate,
+                          result.audioSeconds,
+                          result.processSeconds,
+                          result.realTimeFactor(),
+                          static_cast<long long>(result.heap.peakBytes),
+                          result.steadyAllocations / result.audioSeconds);
+            std::printf("%s", line);
+            if (out != nullptr) {
+                std::fprintf(out, "%s", line);
+            }
+        }
+        if (out != nullptr) {
+            std::fclose(out);
+        }
+    }
+} // namespace
+
+TEST_CASE("Decoder throughput", "[!benchmark]")
+{
+    const GeneratedFiles generated;
+    auto files = referenceFiles();
+    files.insert(files.end(), generated.paths.begin(), generated.paths.end());
+
+    std::vector<Result> results;
+    for (const auto &file : files) {
+        DecoderWorkload workload{file};
+        auto result = workload.measure();
+        REQUIRE(result.audioSeconds > 0);
+        results.push_back(result);
+    }
+    UpmixWorkload upmix{44100};
+    results.push_back(upmix.measure());
+    report(results);
+
+    for (const auto &file : files) {
+        DecoderWorkload workload{file};
+        BENCHMARK("Decode one second of " + std::filesystem::path(file).filename().string())
+        {
+            return workload.run();
+        };
+    }
+
+    BENCHMARK("Upmix one block to stereo")
+    {
+        return upmix.run();
+    };
+}
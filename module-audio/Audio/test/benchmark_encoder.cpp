@@ -0,0 +1,104 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <Audio/encoder/Encoder.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <vector>
+
+using audio::Encoder;
+using audio::RecordingFormat;
+
+namespace
+{
+    constexpr std::size_t framesPerBuffer = 1024;
+    constexpr double megabyte             = 1024.0 * 1024.0;
+
+    /// Ten seconds of speech-like signal from the built-in microphone, recorded in audio buffers
+    class Workload
+    {
+      public:
+        Workload(std::uint32_t rate, RecordingFormat recordingFormat)
+            : rate(rate), recordingFormat(recordingFormat), input(rate * 10),
+              path((std::filesystem::temp_directory_path() / "encoder_benchmark.wav").string())
+        {
+            constexpr double pi = 3.14159265358979;
+            for (std::size_t i = 0; i < input.size(); ++i) {
+                const auto t = static_cast<double>(i) / rate;
+                input[i]     = static_cast<std::int16_t>(6000 * std::sin(2 * pi * 180 * t) * std::sin(2 * pi * 3 * t) +
+                                                     2000 * std::sin(2 * pi * 1100 * t));
+            }
+        }
+
+        ~Workload()
+        {
+            std::filesystem::remove(path);
+        }
+
+        auto run() -> Encoder::Format
+        {
+            auto encoder = Encoder::Create(path, Encoder::Format{.chanNr = 1, .sampleRate = rate}, recordingFormat);
+            for (std::size_t frame = 0; frame < input.size(); frame += framesPerBuffer) {
+                encoder->Encode(std::min(framesPerBuffer, input.size() - frame), &input[frame]);
+            }
+            statistics = encoder->getOutputStatistics();
+            return encoder->format;
+        }
+
+        void report(const char *name)
+        {
+            run();
+            const auto seconds  = static_cast<double>(input.size()) / rate;
+            const auto fileSize = std::filesystem::file_size(path);
+            // the encoders used to write every audio buffer to the file
+            const auto buffersPerMegabyte = megabyte / (framesPerBuffer * sizeof(std::int16_t));
+            std::printf("%s: %.1f s of recording per MB, %.1f writes per MB (%.1f before buffering PCM), "
+                        "%u header updates in %.0f s\n",
+                        name,
+                        seconds * megabyte / fileSize,
+                        statistics.fileWrites * megabyte / statistics.bytesWritten,
+                        buffersPerMegabyte,
+                        static_cast<unsigned>(statistics.headerUpdates),
+                        seconds);
+        }
+
+      private:
+        std::uint32_t rate;
+        RecordingFormat recordingFormat;
+        std::vector<std::int16_t> input;
+        std::string path;
+        audio::EncoderOutput::Statistics statistics;
+    };
+} // namespace
+
+TEST_CASE("Recording encoders, ten seconds of audio", "[!benchmark]")
+{
+    Workload pcm{44100, RecordingFormat::Pcm};
+    Workload adpcm{44100, RecordingFormat::ImaAdpcm};
+    Workload adpcmVoice{16000, RecordingFormat::ImaAdpcm};
+
+    pcm.report("PCM 44.1 kHz");
+    adpcm.report("IMA ADPCM 44.1 kHz");
+    adpcmVoice.report("IMA ADPCM 16 kHz");
+
+    BENCHMARK("PCM 44.1 kHz mono")
+    {
+        return pcm.run();
+    };
+
+    BENCHMARK("IMA ADPCM 44.1 kHz mono")
+    {
+        return adpcm.run();
+    };
+
+    BENCHMARK("IMA ADPCM 16 kHz mono")
+    {
+        return adpcmVoice.run();
+    };
+}
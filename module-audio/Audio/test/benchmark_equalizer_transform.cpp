@@ -0,0 +1,110 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <Audio/transcode/EqualizerTransform.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+using audio::equalizer::FilterType;
+using audio::equalizer::qfilter_CalculateCoeffs;
+using audio::transcode::EqualizerTransform;
+
+namespace
+{
+    constexpr auto rate = 44100U;
+
+    auto makeBands() -> audio::equalizer::Equalizer
+    {
+        return {qfilter_CalculateCoeffs(FilterType::HighPass, 40, rate, 0.701f, 0),
+                qfilter_CalculateCoeffs(FilterType::LowShelf, 150, rate, 0.701f, 6),
+                qfilter_CalculateCoeffs(FilterType::Parametric, 1000, rate, 1.0f, -4),
+                qfilter_CalculateCoeffs(FilterType::Parametric, 3000, rate, 2.0f, 2),
+                qfilter_CalculateCoeffs(FilterType::HighShelf, 8000, rate, 0.701f, 3)};
+    }
+
+    /// One second of stereo music-like signal processed in blocks of 512 frames, as streamed to A2DP
+    class Workload
+    {
+      public:
+        explicit Workload(std::optional<EqualizerTransform::LimiterSettings> limiter)
+            : equalizer(audio::AudioFormat{rate, 16, 2}, makeBands(), limiter), samples(rate * 2)
+        {
+            for (std::size_t i = 0; i < samples.size(); ++i) {
+                const auto t = static_cast<double>(i / 2) / rate;
+                samples[i]   = static_cast<std::int16_t>(12000 * std::sin(2 * 3.14159265 * 110 * t) +
+                                                       6000 * std::sin(2 * 3.14159265 * 2500 * t));
+            }
+        }
+
+        auto run() -> std::int16_t
+        {
+            constexpr auto block = 512 * 2 * sizeof(std::int16_t);
+            auto data            = reinterpret_cast<std::uint8_t *>(samples.data());
+            for (std::size_t offset = 0; offset + block <= samples.size() * sizeof(std::int16_t); offset += block) {
+                auto span = EqualizerTransform::Span{.data = data + offset, .dataSize = block};
+                equalizer.transform(span, span);
+            }
+            return samples[0];
+        }
+
+        auto samplesCount() const noexcept -> std::size_t
+        {
+            return samples.size();
+        }
+
+      private:
+        EqualizerTransform equalizer;
+        std::vector<std::int16_t> samples;
+    };
+
+    /// Time stamp counter where available, nanoseconds otherwise
+    auto ticks() -> std::uint64_t
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+#endif
+    }
+
+    auto ticksPerSample(Workload &workload) -> double
+    {
+        constexpr auto runs = 20;
+        workload.run();
+        const auto start = ticks();
+        for (auto i = 0; i < runs; ++i) {
+            workload.run();
+        }
+        return static_cast<double>(ticks() - start) / (runs * workload.samplesCount());
+    }
+} // namespace
+
+TEST_CASE("Equalizer transform, one second of 44.1 kHz stereo", "[!benchmark]")
+{
+    Workload equalizer{std::nullopt};
+    Workload limited{EqualizerTransform::LimiterSettings{}};
+
+    BENCHMARK("5 bands")
+    {
+        return equalizer.run();
+    };
+
+    BENCHMARK("5 bands and limiter")
+    {
+        return limited.run();
+    };
+
+    WARN("Cycles per sample, 5 bands: " << ticksPerSample(equalizer));
+    WARN("Cycles per sample, 5 bands and limiter: " << ticksPerSample(limited));
+}
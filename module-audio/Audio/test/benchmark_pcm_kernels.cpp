@@ -0,0 +1,143 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <Audio/PcmKernels.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace pcm = audio::pcm;
+
+namespace
+{
+    constexpr std::size_t rate           = 44100;
+    constexpr std::size_t framesPerBlock = 512;
+
+    /// One second of stereo audio processed in stream blocks of 512 frames
+    class Workload
+    {
+      public:
+        Workload() : stereo(rate * 2), mono(rate), wide(rate * 2), floats(rate * 2)
+        {
+            for (std::size_t i = 0; i < stereo.size(); ++i) {
+                const auto t = static_cast<double>(i / 2) / rate;
+                stereo[i]    = static_cast<std::int16_t>(12000 * std::sin(2 * 3.14159265 * 110 * t) +
+                                                      6000 * std::sin(2 * 3.14159265 * 2500 * t));
+            }
+            std::copy_n(stereo.begin(), mono.size(), mono.begin());
+            pcm::toFloat(floats.data(), stereo.data(), stereo.size());
+        }
+
+        /// Calls the kernel for every block of samples with the offset of the block
+        template <typename Kernel>
+        auto forEachBlock(std::size_t samples, std::size_t samplesPerBlock, Kernel kernel) -> std::int16_t
+        {
+            for (std::size_t offset = 0; offset + samplesPerBlock <= samples; offset += samplesPerBlock) {
+                kernel(offset);
+            }
+            return stereo[1];
+        }
+
+        std::vector<std::int16_t> stereo;
+        std::vector<std::int16_t> mono;
+        std::vector<std::int32_t> wide;
+        std::vector<float> floats;
+    };
+} // namespace
+
+TEST_CASE("PCM kernels, one second of 44.1 kHz audio", "[!benchmark]")
+{
+    Workload w;
+    auto &stereo = w.stereo;
+    auto &mono   = w.mono;
+
+    BENCHMARK("Mono to stereo in place")
+    {
+        return w.forEachBlock(mono.size(), framesPerBlock, [&](std::size_t offset) {
+            // the block is converted in place, as the decoding worker does
+            std::copy_n(&mono[offset], framesPerBlock, &stereo[offset * 2]);
+            pcm::monoToStereo(&stereo[offset * 2], &stereo[offset * 2], framesPerBlock);
+        });
+    };
+
+    // reference: the scalar loop of the decoding worker the kernel replaces
+    BENCHMARK("Mono to stereo in place, scalar loop")
+    {
+        return w.forEachBlock(mono.size(), framesPerBlock, [&](std::size_t offset) {
+            auto buffer = &stereo[offset * 2];
+            std::copy_n(&mono[offset], framesPerBlock, buffer);
+            for (auto i = framesPerBlock; i > 0; i--) {
+                buffer[i * 2 - 1] = buffer[i * 2 - 2] = buffer[i - 1];
+            }
+        });
+    };
+
+    BENCHMARK("Stereo to mono")
+    {
+        return w.forEachBlock(mono.size(), framesPerBlock, [&](std::size_t offset) {
+            pcm::stereoToMono(&mono[offset], &stereo[offset * 2], framesPerBlock);
+        });
+    };
+
+    BENCHMARK("Interpolate by 2, stereo")
+    {
+        auto frames = reinterpret_cast<std::uint32_t *>(stereo.data());
+        return w.forEachBlock(mono.size(), framesPerBlock, [&](std::size_t offset) {
+            pcm::repeat<2>(&frames[offset], &frames[offset], framesPerBlock / 2);
+        });
+    };
+
+    BENCHMARK("Decimate by 2, mono")
+    {
+        return w.forEachBlock(mono.size(), framesPerBlock, [&](std::size_t offset) {
+            pcm::decimate<2>(&mono[offset], &mono[offset], framesPerBlock / 2);
+        });
+    };
+
+    BENCHMARK("Int16 to float")
+    {
+        return w.forEachBlock(stereo.size(), framesPerBlock * 2, [&](std::size_t offset) {
+            pcm::toFloat(&w.floats[offset], &stereo[offset], framesPerBlock * 2);
+        });
+    };
+
+    BENCHMARK("Float to int16")
+    {
+        return w.forEachBlock(stereo.size(), framesPerBlock * 2, [&](std::size_t offset) {
+            pcm::fromFloat(&stereo[offset], &w.floats[offset], framesPerBlock * 2);
+        });
+    };
+
+    BENCHMARK("Int16 to Q23 and back")
+    {
+        return w.forEachBlock(stereo.size(), framesPerBlock * 2, [&](std::size_t offset) {
+            pcm::toQ<8>(&w.wide[offset], &stereo[offset], framesPerBlock * 2);
+            pcm::fromQ<8>(&stereo[offset], &w.wide[offset], framesPerBlock * 2);
+        });
+    };
+
+    BENCHMARK("Gain")
+    {
+        return w.forEachBlock(stereo.size(), framesPerBlock * 2, [&](std::size_t offset) {
+            pcm::scale(&stereo[offset], framesPerBlock * 2, pcm::unityGain / 2 + 1);
+        });
+    };
+
+    BENCHMARK("Add with gain")
+    {
+        return w.forEachBlock(mono.size(), framesPerBlock, [&](std::size_t offset) {
+            pcm::addScaled(&stereo[offset], &mono[offset], framesPerBlock, pcm::unityGain / 2);
+        });
+    };
+
+    BENCHMARK("Saturating add")
+    {
+        return w.forEachBlock(mono.size(), framesPerBlock, [&](std::size_t offset) {
+            pcm::addSaturate(&stereo[offset], &mono[offset], framesPerBlock);
+        });
+    };
+}
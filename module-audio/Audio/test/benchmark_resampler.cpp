@@ -0,0 +1,95 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <Audio/transcode/BasicDecimator.hpp>
+#include <Audio/transcode/PolyphaseResampler.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using audio::transcode::PolyphaseResampler;
+
+namespace
+{
+    /// One second of a 1 kHz sine converted in 10 ms blocks
+    class Workload
+    {
+      public:
+        Workload(unsigned inputRate, unsigned outputRate, unsigned channels)
+            : resampler(audio::AudioFormat{inputRate, 16, channels}, outputRate),
+              inputBlock(inputRate / 100 * channels * sizeof(std::int16_t)),
+              input(inputRate * channels), space(resampler.transformBlockSize(inputBlock))
+        {
+            constexpr double step = 2 * 3.14159265358979 * 1000;
+            for (std::size_t i = 0; i < input.size(); ++i) {
+                input[i] = static_cast<std::int16_t>(16384 * std::sin(step * (i / channels) / inputRate));
+            }
+        }
+
+        auto run() -> std::int16_t
+        {
+            auto data = reinterpret_cast<std::uint8_t *>(input.data());
+            for (std::size_t offset = 0; offset < input.size() * sizeof(std::int16_t); offset += inputBlock) {
+                resampler.transform(PolyphaseResampler::Span{.data = data + offset, .dataSize = inputBlock},
+                                    PolyphaseResampler::Span{.data = space.data(), .dataSize = space.size()});
+            }
+            return static_cast<std::int16_t>(space[0]);
+        }
+
+      private:
+        PolyphaseResampler resampler;
+        std::size_t inputBlock;
+        std::vector<std::int16_t> input;
+        std::vector<std::uint8_t> space;
+    };
+} // namespace
+
+TEST_CASE("Polyphase resampler, one second of audio", "[!benchmark]")
+{
+    Workload musicToCodec{44100, 48000, 2};
+    Workload musicToHfp{44100, 16000, 1};
+    Workload codecToSco{48000, 8000, 1};
+    Workload scoToCodec{8000, 48000, 1};
+    Workload hfpToSco{16000, 8000, 1};
+
+    BENCHMARK("44.1 -> 48 kHz stereo")
+    {
+        return musicToCodec.run();
+    };
+
+    BENCHMARK("44.1 -> 16 kHz mono")
+    {
+        return musicToHfp.run();
+    };
+
+    BENCHMARK("48 -> 8 kHz mono")
+    {
+        return codecToSco.run();
+    };
+
+    BENCHMARK("8 -> 48 kHz mono")
+    {
+        return scoToCodec.run();
+    };
+
+    BENCHMARK("16 -> 8 kHz mono")
+    {
+        return hfpToSco.run();
+    };
+
+    // reference: the unfiltered decimator the resampler replaces
+    std::vector<std::uint16_t> samples(16000);
+    audio::transcode::BasicDecimator<std::uint16_t, 1, 2> decimator;
+    BENCHMARK("16 -> 8 kHz mono, BasicDecimator")
+    {
+        for (std::size_t offset = 0; offset < samples.size(); offset += 160) {
+            auto span = audio::transcode::Transform::Span{.data     = reinterpret_cast<std::uint8_t *>(&samples[offset]),
+                                                          .dataSize = 160 * sizeof(std::uint16_t)};
+            decimator.transform(span, span);
+        }
+        return samples[0];
+    };
+}
@@ -0,0 +1,139 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <Audio/decoder/DecoderInput.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+using audio::DecoderInput;
+
+namespace
+{
+    constexpr auto chunk    = DecoderInput::chunkSize;
+    constexpr auto fileSize = 3 * chunk + chunk / 2;
+
+    class TestFile
+    {
+      public:
+        TestFile() : fd(std::tmpfile()), content(fileSize)
+        {
+            for (std::size_t i = 0; i < content.size(); ++i) {
+                content[i] = static_cast<std::uint8_t>(i * 7 + i / 251);
+            }
+            std::fwrite(content.data(), 1, content.size(), fd);
+            std::rewind(fd);
+        }
+
+        ~TestFile()
+        {
+            std::fclose(fd);
+        }
+
+        auto read(DecoderInput &input, std::size_t size) -> bool
+        {
+            std::vector<std::uint8_t> data(size);
+            const auto from = input.tell();
+            const auto read = input.read(data.data(), size);
+            data.resize(read);
+            return std::equal(data.begin(), data.end(), content.begin() + from) &&
+                   read == std::min(size, content.size() - from);
+        }
+
+        std::FILE *fd;
+        std::vector<std::uint8_t> content;
+    };
+} // namespace
+
+TEST_CASE("Decoder input")
+{
+    TestFile file;
+    DecoderInput input{file.fd, fileSize};
+
+    SECTION("Sequential reads without prefetching wait for every chunk")
+    {
+        while (input.tell() < fileSize) {
+            REQUIRE(file.read(input, 1000));
+        }
+        const auto statistics = input.getStatistics();
+        REQUIRE(statistics.fileReads == 4);
+        REQUIRE(statistics.bytesRead == fileSize);
+        REQUIRE(statistics.underruns == 4);
+    }
+
+    SECTION("Prefetching keeps the next chunk ready")
+    {
+        input.prefetch();
+        REQUIRE(input.getStatistics().fileReads == 2);
+        while (input.tell() < fileSize) {
+            REQUIRE(file.read(input, 1000));
+            input.prefetch();
+        }
+        const auto statistics = input.getStatistics();
+        REQUIRE(statistics.fileReads == 4);
+        REQUIRE(statistics.bytesRead == fileSize);
+        REQUIRE(statistics.underruns == 0);
+    }
+
+    SECTION("Reads spanning both chunks")
+    {
+        input.prefetch();
+        REQUIRE(input.seek(chunk - 10, SEEK_SET));
+        REQUIRE(file.read(input, 20));
+        REQUIRE(input.getStatistics().underruns == 0);
+    }
+
+    SECTION("Read larger than the buffers")
+    {
+        REQUIRE(file.read(input, fileSize));
+        REQUIRE(input.tell() == fileSize);
+        std::uint8_t byte;
+        REQUIRE(input.read(&byte, 1) == 0);
+    }
+
+    SECTION("Read past the end of the file is partial")
+    {
+        REQUIRE(input.seek(fileSize - 100, SEEK_SET));
+        REQUIRE(file.read(input, 1000));
+        REQUIRE(input.tell() == fileSize);
+    }
+
+    SECTION("Seeks within the buffered chunks do not read")
+    {
+        input.prefetch();
+        REQUIRE(input.seek(chunk + 100, SEEK_SET));
+        REQUIRE(file.read(input, 100));
+        REQUIRE(input.seek(-150, SEEK_CUR));
+        REQUIRE(file.read(input, 100));
+        const auto statistics = input.getStatistics();
+        REQUIRE(statistics.fileReads == 2);
+        REQUIRE(statistics.invalidations == 0);
+    }
+
+    SECTION("Seeks elsewhere drop the buffers without reading")
+    {
+        input.prefetch();
+        REQUIRE(input.seek(3 * chunk + 10, SEEK_SET));
+        REQUIRE(input.getStatistics().fileReads == 2);
+        REQUIRE(input.getStatistics().invalidations == 1);
+        REQUIRE(file.read(input, 100));
+        REQUIRE(input.getStatistics().underruns == 1);
+
+        // rewind
+        REQUIRE(input.seek(0, SEEK_SET));
+        REQUIRE(file.read(input, 100));
+        REQUIRE(input.getStatistics().invalidations == 2);
+    }
+
+    SECTION("Seeks outside of the file fail")
+    {
+        REQUIRE_FALSE(input.seek(-1, SEEK_SET));
+        REQUIRE_FALSE(input.seek(fileSize + 1, SEEK_SET));
+        REQUIRE(input.seek(fileSize, SEEK_SET));
+        REQUIRE_FALSE(input.seek(1, SEEK_CUR));
+    }
+}
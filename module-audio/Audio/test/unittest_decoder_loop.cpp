@@ -0,0 +1,189 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <Audio/MixKernel.hpp>
+#include <Audio/decoder/Decoder.hpp>
+#include <Audio/decoder/DecoderLoop.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using audio::Decoder;
+using audio::DecoderLoop;
+using namespace std::chrono_literals;
+
+namespace
+{
+    /// Stereo file at 1 kHz, the left channel holds the frame number, the right one its negation
+    class FakeDecoder : public Decoder
+    {
+      public:
+        explicit FakeDecoder(std::uint64_t frames) : Decoder(""), frames(frames)
+        {
+            sampleRate   = 1000;
+            channelCount = 2;
+        }
+
+        static auto sample(std::uint64_t frame, std::size_t channel) -> std::int16_t
+        {
+            const auto value = static_cast<std::int16_t>(frame + 1);
+            return channel == 0 ? value : -value;
+        }
+
+        auto decode(std::uint32_t samplesToRead, std::int16_t *pcmData) -> std::int32_t override
+        {
+            if (deleted) {
+                return fileDeletedRetCode;
+            }
+            ++decodeCalls;
+            std::uint32_t samples = 0;
+            for (; samples < samplesToRead && current < frames; samples += channelCount, ++current) {
+                pcmData[samples]     = sample(current, 0);
+                pcmData[samples + 1] = sample(current, 1);
+            }
+            return static_cast<std::int32_t>(samples);
+        }
+
+        auto setPosition(float pos) -> void override
+        {
+            current = static_cast<std::uint64_t>(frames * pos);
+        }
+
+        auto rewind() -> void override
+        {
+            ++rewinds;
+            current = 0;
+        }
+
+        auto seekToFrame(std::uint64_t frame) -> bool override
+        {
+            ++seeks;
+            current = frame;
+            return frame <= frames;
+        }
+
+        std::uint64_t frames;
+        std::uint64_t current = 0;
+        bool deleted          = false;
+        unsigned decodeCalls  = 0;
+        unsigned rewinds      = 0;
+        unsigned seeks        = 0;
+    };
+
+    auto decodeAll(DecoderLoop &loop, std::size_t samples, std::size_t block) -> std::vector<std::int16_t>
+    {
+        std::vector<std::int16_t> output(samples);
+        for (std::size_t offset = 0; offset < samples; offset += block) {
+            REQUIRE(loop.decode(block, output.data() + offset) == static_cast<std::int32_t>(block));
+        }
+        return output;
+    }
+
+    /// The file played in a loop, each loop but the first starts with the crossfade and continues after the head
+    auto expectedOutput(std::uint64_t fileFrames, std::uint64_t crossfadeFrames, std::size_t samples)
+        -> std::vector<std::int16_t>
+    {
+        std::vector<std::int16_t> expected;
+        auto append = [&](std::uint64_t from, std::uint64_t to) {
+            for (auto frame = from; frame < to; ++frame) {
+                expected.push_back(FakeDecoder::sample(frame, 0));
+                expected.push_back(FakeDecoder::sample(frame, 1));
+            }
+        };
+
+        append(0, fileFrames - crossfadeFrames);
+        while (expected.size() < samples) {
+            for (std::uint64_t k = 0; k < crossfadeFrames; ++k) {
+                const auto fadeIn  = static_cast<audio::mix::Gain>(k * audio::mix::unityGain / crossfadeFrames);
+                const auto fadeOut = audio::mix::unityGain - fadeIn;
+                for (std::size_t channel = 0; channel < 2; ++channel) {
+                    const auto tail = FakeDecoder::sample(fileFrames - crossfadeFrames + k, channel);
+                    const auto head = FakeDecoder::sample(k, channel);
+                    expected.push_back(
+                        static_cast<std::int16_t>((tail * fadeOut + head * fadeIn) >> audio::mix::gainShift));
+                }
+            }
+            append(crossfadeFrames, fileFrames - crossfadeFrames);
+        }
+        expected.resize(samples);
+        return expected;
+    }
+} // namespace
+
+TEST_CASE("Gapless decoder loop")
+{
+    const auto fileFrames = GENERATE(1U, 77U, 256U);
+    const auto block      = GENERATE(64U, 512U, 1000U);
+    CAPTURE(fileFrames, block);
+
+    FakeDecoder decoder{fileFrames};
+    DecoderLoop loop{decoder, 0ms};
+
+    const auto samples = 20 * block;
+    REQUIRE(decodeAll(loop, samples, block) == expectedOutput(fileFrames, 0, samples));
+    // the decoder is rewound when the next block needs data past the end of the file
+    REQUIRE(loop.getLoopsCount() == (samples / 2 - 1) / fileFrames);
+    REQUIRE(decoder.rewinds == loop.getLoopsCount());
+    REQUIRE(decoder.seeks == 0);
+}
+
+TEST_CASE("Crossfading decoder loop")
+{
+    const auto crossfade = GENERATE(1ms, 50ms, 200ms);
+    const auto block     = GENERATE(250U, 256U, 1024U);
+    CAPTURE(crossfade.count(), block);
+
+    constexpr std::uint64_t fileFrames  = 1000;
+    const std::uint64_t crossfadeFrames = crossfade.count();
+    FakeDecoder decoder{fileFrames};
+    DecoderLoop loop{decoder, crossfade};
+
+    const auto samples = 20 * block;
+    REQUIRE(decodeAll(loop, samples, block) == expectedOutput(fileFrames, crossfadeFrames, samples));
+    // decoding is ahead of the output by the crossfade, later passes skip the head
+    const auto framesDecoded = samples / 2 + crossfadeFrames;
+    REQUIRE(loop.getLoopsCount() == 1 + (framesDecoded - fileFrames - 1) / (fileFrames - crossfadeFrames));
+    REQUIRE(decoder.rewinds == 0);
+    REQUIRE(decoder.seeks == loop.getLoopsCount());
+}
+
+TEST_CASE("Decoder loop corner cases")
+{
+    SECTION("Crossfade longer than the file falls back to the gapless loop")
+    {
+        FakeDecoder decoder{30};
+        DecoderLoop loop{decoder, 100ms};
+        const auto output   = decodeAll(loop, 1000, 100);
+        const auto expected = expectedOutput(30, 0, 1000);
+        REQUIRE(output == expected);
+        REQUIRE(decoder.seeks == 0);
+    }
+
+    SECTION("Crossfade is limited")
+    {
+        FakeDecoder decoder{2000};
+        DecoderLoop loop{decoder, 10s};
+        REQUIRE(decodeAll(loop, 6000, 200) == expectedOutput(2000, DecoderLoop::maxCrossfade.count(), 6000));
+    }
+
+    SECTION("File without samples ends the playback")
+    {
+        FakeDecoder decoder{0};
+        DecoderLoop loop{decoder, 0ms};
+        std::vector<std::int16_t> output(128);
+        REQUIRE(loop.decode(output.size(), output.data()) == 0);
+        REQUIRE(decoder.decodeCalls == 2);
+    }
+
+    SECTION("Deleted file is reported")
+    {
+        FakeDecoder decoder{100};
+        DecoderLoop loop{decoder, 20ms};
+        decodeAll(loop, 400, 100);
+        decoder.deleted = true;
+        std::vector<std::int16_t> output(100);
+        REQUIRE(loop.decode(output.size(), output.data()) == Decoder::fileDeletedRetCode);
+    }
+}
@@ -0,0 +1,317 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <Audio/encoder/EncoderADPCM.hpp>
+#include <Audio/encoder/EncoderOutput.hpp>
+#include <Audio/encoder/EncoderWAV.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using audio::Encoder;
+using audio::EncoderADPCM;
+using audio::EncoderOutput;
+
+namespace
+{
+    constexpr auto chunk = EncoderOutput::chunkSize;
+
+    auto testPath() -> std::string
+    {
+        return (std::filesystem::temp_directory_path() / "encoder_test.wav").string();
+    }
+
+    auto readFile(const std::string &path) -> std::vector<std::uint8_t>
+    {
+        std::ifstream file(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+
+    auto getLE(const std::vector<std::uint8_t> &data, std::size_t offset, std::size_t bytes) -> std::uint32_t
+    {
+        std::uint32_t value = 0;
+        for (std::size_t i = 0; i < bytes; ++i) {
+            value |= static_cast<std::uint32_t>(data[offset + i]) << (8 * i);
+        }
+        return value;
+    }
+
+    auto makeSine(std::size_t frames, std::uint32_t channels, std::uint32_t rate) -> std::vector<std::int16_t>
+    {
+        std::vector<std::int16_t> samples(frames * channels);
+        for (std::size_t i = 0; i < samples.size(); ++i) {
+            const auto channel = i % channels;
+            const auto t       = static_cast<double>(i / channels) / rate;
+            samples[i]         = static_cast<std::int16_t>(12000 * std::sin(2 * M_PI * (440 + 220 * channel) * t));
+        }
+        return samples;
+    }
+
+    /// Reference IMA ADPCM WAV decoder, as in the Microsoft multimedia standards update
+    auto decodeImaAdpcm(const std::vector<std::uint8_t> &file) -> std::vector<std::int16_t>
+    {
+        constexpr std::array<std::int16_t, 89> steps{
+            7,     8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,    25,    28,
+            31,    34,    37,    41,    45,    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+            130,   143,   157,   173,   190,   209,   230,   253,   279,   307,   337,   371,   408,   449,   494,
+            544,   598,   658,   724,   796,   876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+            2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,  5894,  6484,  7132,  7845,  8630,
+            9493,  10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+        constexpr std::array<int, 16> indexSteps{-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+
+        const auto channels        = getLE(file, 22, 2);
+        const auto blockAlign      = getLE(file, 32, 2);
+        const auto samplesPerBlock = getLE(file, 38, 2);
+        const auto length          = getLE(file, 48, 4);
+        const auto dataSize        = getLE(file, 56, 4);
+
+        std::vector<std::int16_t> samples;
+        for (std::size_t offset = EncoderADPCM::headerSize; offset + blockAlign <= EncoderADPCM::headerSize + dataSize;
+             offset += blockAlign) {
+            std::vector<std::int16_t> block(samplesPerBlock * channels);
+            std::vector<int> predictors(channels);
+            std::vector<int> indexes(channels);
+            for (std::size_t channel = 0; channel < channels; ++channel) {
+                predictors[channel] = static_cast<std::int16_t>(getLE(file, offset + 4 * channel, 2));
+                indexes[channel]    = file[offset + 4 * channel + 2];
+                block[channel]      = static_cast<std::int16_t>(predictors[channel]);
+            }
+
+            auto data = offset + 4 * channels;
+            for (std::size_t first = 1; first < samplesPerBlock; first += 8) {
+                for (std::size_t channel = 0; channel < channels; ++channel) {
+                    for (std::size_t i = 0; i < 8; ++i) {
+                        const auto nibble = (file[data + i / 2] >> (4 * (i % 2))) & 0xF;
+                        const int step    = steps[indexes[channel]];
+                        auto diff         = step >> 3;
+                        diff += (nibble & 4) ? step : 0;
+                        diff += (nibble & 2) ? step >> 1 : 0;
+                        diff += (nibble & 1) ? step >> 2 : 0;
+                        predictors[channel] += (nibble & 8) ? -diff : diff;
+                        predictors[channel] = std::clamp(predictors[channel], -32768, 32767);
+                        indexes[channel]    = std::clamp(indexes[channel] + indexSteps[nibble], 0, 88);
+                        block[(first + i) * channels + channel] = static_cast<std::int16_t>(predictors[channel]);
+                    }
+                    data += 4;
+                }
+            }
+            samples.insert(samples.end(), block.begin(), block.end());
+        }
+        samples.resize(std::min<std::size_t>(samples.size(), length * channels));
+        return samples;
+    }
+
+    auto signalToNoise(const std::vector<std::int16_t> &reference, const std::vector<std::int16_t> &decoded) -> double
+    {
+        double signal = 0;
+        double noise  = 0;
+        for (std::size_t i = 0; i < reference.size(); ++i) {
+            signal += static_cast<double>(reference[i]) * reference[i];
+            noise += std::pow(static_cast<double>(reference[i]) - decoded[i], 2);
+        }
+        return 10 * std::log10(signal / noise);
+    }
+} // namespace
+
+TEST_CASE("Encoder output")
+{
+    const auto path = testPath();
+    auto fd         = std::fopen(path.c_str(), "w+");
+    REQUIRE(fd != nullptr);
+
+    std::vector<std::uint8_t> data(chunk * (EncoderOutput::chunkCount + 2));
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<std::uint8_t>(i * 13 + i / 253);
+    }
+
+    {
+        EncoderOutput output{fd};
+
+        SECTION("Data is written in whole chunks")
+        {
+            REQUIRE(output.write(data.data(), chunk - 1) == chunk - 1);
+            REQUIRE(output.pending() == 0);
+            REQUIRE(output.flush());
+            REQUIRE(output.getFlushedSize() == 0);
+
+            REQUIRE(output.write(data.data() + chunk - 1, 2) == 2);
+            REQUIRE(output.pending() == 1);
+            REQUIRE(output.flush());
+            REQUIRE(output.getFlushedSize() == chunk);
+            REQUIRE(output.getStatistics().fileWrites == 1);
+
+            REQUIRE(output.finish());
+            REQUIRE(output.getFlushedSize() == chunk + 1);
+            REQUIRE(output.getStatistics().fileWrites == 2);
+            std::fflush(fd);
+            const auto written = readFile(path);
+            REQUIRE(std::equal(written.begin(), written.end(), data.begin(), data.begin() + chunk + 1));
+        }
+
+        SECTION("Writes stop when all chunks wait for the flush")
+        {
+            const auto capacity = chunk * EncoderOutput::chunkCount;
+            REQUIRE(output.write(data.data(), data.size()) == capacity);
+            REQUIRE(output.pending() == EncoderOutput::chunkCount);
+            REQUIRE(output.write(data.data(), 1) == 0);
+            REQUIRE(output.getStatistics().overflows == 2);
+
+            REQUIRE(output.flush());
+            REQUIRE(output.write(data.data() + capacity, data.size() - capacity) == data.size() - capacity);
+            REQUIRE(output.finish());
+            std::fflush(fd);
+            REQUIRE(readFile(path) == data);
+        }
+
+        SECTION("Header is rewritten in place")
+        {
+            const std::array<std::uint8_t, 4> header{1, 2, 3, 4};
+            REQUIRE(output.write(data.data(), 2 * chunk + 10) == 2 * chunk + 10);
+            REQUIRE(output.flush());
+            REQUIRE(output.writeHeader(header.data(), header.size()));
+            REQUIRE(output.finish());
+            REQUIRE(output.getStatistics().headerUpdates == 1);
+
+            std::fflush(fd);
+            auto expected = std::vector<std::uint8_t>(data.begin(), data.begin() + 2 * chunk + 10);
+            std::copy(header.begin(), header.end(), expected.begin());
+            REQUIRE(readFile(path) == expected);
+        }
+    }
+
+    std::fclose(fd);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("IMA ADPCM encoder")
+{
+    const auto path = testPath();
+
+    SECTION("Unsupported formats are rejected")
+    {
+        const auto channels = GENERATE(0U, 3U);
+        REQUIRE(Encoder::Create(path,
+                                Encoder::Format{.chanNr = channels, .sampleRate = 16000},
+                                audio::RecordingFormat::ImaAdpcm) == nullptr);
+    }
+
+    SECTION("Recording decodes close to the source")
+    {
+        const auto [channels, rate] = GENERATE(std::pair{1U, 16000U}, std::pair{2U, 44100U}, std::pair{1U, 8000U});
+        const auto frames           = rate * 3 + 123;
+        auto source                 = makeSine(frames, channels, rate);
+
+        std::size_t blockAlign = 0;
+        {
+            auto encoder = Encoder::Create(
+                path, Encoder::Format{.chanNr = channels, .sampleRate = rate}, audio::RecordingFormat::ImaAdpcm);
+            REQUIRE(encoder != nullptr);
+            blockAlign = static_cast<EncoderADPCM &>(*encoder).getBlockAlign();
+
+            // blocks of a typical audio buffer, 1024 frames
+            for (std::size_t frame = 0; frame < frames; frame += 1024) {
+                const auto count = std::min<std::size_t>(1024, frames - frame);
+                REQUIRE(encoder->Encode(count * channels, &source[frame * channels]) == count * channels);
+            }
+            REQUIRE(encoder->getCurrentPosition() == Approx(static_cast<float>(frames) / rate));
+        }
+
+        const auto file = readFile(path);
+        REQUIRE(std::string(file.begin(), file.begin() + 4) == "RIFF");
+        REQUIRE(getLE(file, 4, 4) == file.size() - 8);
+        REQUIRE(getLE(file, 20, 2) == 0x11);
+        REQUIRE(getLE(file, 22, 2) == channels);
+        REQUIRE(getLE(file, 24, 4) == rate);
+        REQUIRE(getLE(file, 32, 2) == blockAlign);
+        REQUIRE(getLE(file, 48, 4) == frames);
+        REQUIRE((file.size() - EncoderADPCM::headerSize) % blockAlign == 0);
+        // a quarter of PCM, plus the block headers
+        REQUIRE(file.size() < frames * channels * sizeof(std::int16_t) * 0.27);
+
+        const auto decoded = decodeImaAdpcm(file);
+        REQUIRE(decoded.size() == source.size());
+        REQUIRE(signalToNoise(source, decoded) > 25.0);
+    }
+
+    SECTION("Header is updated while recording")
+    {
+        constexpr auto rate = 16000U;
+        const auto source   = makeSine(rate * 30, 1, rate);
+
+        auto encoder =
+            Encoder::Create(path, Encoder::Format{.chanNr = 1, .sampleRate = rate}, audio::RecordingFormat::ImaAdpcm);
+        REQUIRE(encoder != nullptr);
+        for (std::size_t frame = 0; frame < source.size(); frame += 1024) {
+            const auto count = std::min<std::size_t>(1024, source.size() - frame);
+            REQUIRE(encoder->Encode(count, const_cast<std::int16_t *>(&source[frame])) == count);
+        }
+
+        // what would be left after a power loss
+        const auto file = readFile(path);
+        REQUIRE(encoder->getOutputStatistics().headerUpdates > 0);
+        REQUIRE(file.size() % chunk == 0);
+        const auto dataSize = getLE(file, 56, 4);
+        REQUIRE(dataSize > 0);
+        REQUIRE(EncoderADPCM::headerSize + dataSize <= file.size());
+        const auto blockAlign = static_cast<EncoderADPCM &>(*encoder).getBlockAlign();
+        REQUIRE(file.size() - EncoderADPCM::headerSize - dataSize < Encoder::headerUpdateInterval * chunk + blockAlign);
+
+        const auto decoded = decodeImaAdpcm(file);
+        REQUIRE(decoded.size() == getLE(file, 48, 4));
+        REQUIRE(signalToNoise(std::vector<std::int16_t>(source.begin(), source.begin() + decoded.size()), decoded) >
+                25.0);
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("PCM WAV encoder")
+{
+    const auto path   = testPath();
+    const auto source = makeSine(20000, 2, 44100);
+    {
+        auto encoder = Encoder::Create(path, Encoder::Format{.chanNr = 2, .sampleRate = 44100});
+        REQUIRE(encoder != nullptr);
+        REQUIRE(encoder->Encode(source.size(), const_cast<std::int16_t *>(source.data())) == source.size());
+        REQUIRE(encoder->GetFileSize() == 44 + source.size() * sizeof(std::int16_t));
+    }
+
+    const auto file = readFile(path);
+    REQUIRE(file.size() == 44 + source.size() * sizeof(std::int16_t));
+    REQUIRE(getLE(file, 4, 4) == file.size() - 8);
+    REQUIRE(getLE(file, 22, 2) == 2);
+    REQUIRE(getLE(file, 40, 4) == source.size() * sizeof(std::int16_t));
+    REQUIRE(std::equal(source.begin(), source.end(), reinterpret_cast<const std::int16_t *>(file.data() + 44)));
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Encoder write failure")
+{
+    // /dev/full accepts opening but fails every write with ENOSPC, like a full disk
+    const auto path = (std::filesystem::temp_directory_path() / "encoder_full.wav").string();
+    std::filesystem::remove(path);
+    std::filesystem::create_symlink("/dev/full", path);
+
+    auto encoder = Encoder::Create(path, Encoder::Format{.chanNr = 1, .sampleRate = 16000});
+    REQUIRE(encoder != nullptr);
+    REQUIRE(!encoder->hasOutputFailed());
+
+    // the chunk filled by this block is flushed in place and its write fails
+    auto source = makeSine(chunk, 1, 16000);
+    encoder->Encode(source.size(), source.data());
+    REQUIRE(encoder->hasOutputFailed());
+    REQUIRE(encoder->Encode(source.size(), source.data()) == 0);
+
+    encoder = nullptr;
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,260 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <Audio/transcode/EqualizerTransform.hpp>
+#include <Audio/transcode/PeakLimiter.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using audio::equalizer::FilterType;
+using audio::equalizer::qfilter_CalculateCoeffs;
+using audio::transcode::EqualizerTransform;
+using audio::transcode::PeakLimiter;
+
+namespace
+{
+    constexpr double pi = 3.14159265358979323846;
+
+    auto noBand() -> audio::equalizer::QFilterCoefficients
+    {
+        return qfilter_CalculateCoeffs(FilterType::None, 0, 48000, 1.0f, 0);
+    }
+
+    auto flatBands() -> audio::equalizer::Equalizer
+    {
+        audio::equalizer::Equalizer bands;
+        bands.fill(noBand());
+        return bands;
+    }
+
+    auto makeBands() -> audio::equalizer::Equalizer
+    {
+        return {qfilter_CalculateCoeffs(FilterType::HighPass, 40, 48000, 0.701f, 0),
+                qfilter_CalculateCoeffs(FilterType::LowShelf, 150, 48000, 0.701f, 6),
+                qfilter_CalculateCoeffs(FilterType::Parametric, 1000, 48000, 1.0f, -4),
+                noBand(),
+                qfilter_CalculateCoeffs(FilterType::HighShelf, 8000, 48000, 0.701f, 3)};
+    }
+
+    auto makeSine(unsigned channels, double frequency, std::size_t frames, double amplitude)
+        -> std::vector<std::int16_t>
+    {
+        std::vector<std::int16_t> samples(frames * channels, 0);
+        for (std::size_t i = 0; i < frames; ++i) {
+            const auto value      = amplitude * std::sin(2 * pi * frequency * i / 48000);
+            samples[i * channels] = static_cast<std::int16_t>(std::lround(value));
+        }
+        return samples;
+    }
+
+    auto process(const EqualizerTransform &transform, std::vector<std::int16_t> samples, std::size_t block)
+        -> std::vector<std::int16_t>
+    {
+        for (std::size_t offset = 0; offset < samples.size(); offset += block) {
+            const auto size = std::min(block, samples.size() - offset) * sizeof(std::int16_t);
+            auto span       = EqualizerTransform::Span{.data     = reinterpret_cast<std::uint8_t *>(&samples[offset]),
+                                                       .dataSize = size};
+            REQUIRE(transform.transform(span, span).dataSize == size);
+        }
+        return samples;
+    }
+
+    /// Floating point cascade of the same bands
+    auto reference(const audio::equalizer::Equalizer &bands, const std::vector<std::int16_t> &input, unsigned channels)
+        -> std::vector<double>
+    {
+        std::vector<double> signal(input.begin(), input.end());
+        for (const auto &band : bands) {
+            for (unsigned channel = 0; channel < channels; ++channel) {
+                double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+                for (std::size_t i = channel; i < signal.size(); i += channels) {
+                    const auto x = signal[i];
+                    const auto y = band.b0 * x + band.b1 * x1 + band.b2 * x2 - band.a1 * y1 - band.a2 * y2;
+                    x2           = x1;
+                    x1           = x;
+                    y2           = y1;
+                    y1           = y;
+                    signal[i]    = y;
+                }
+            }
+        }
+        return signal;
+    }
+
+    auto rms(const std::vector<std::int16_t> &samples, std::size_t from, unsigned stride) -> double
+    {
+        double sum        = 0;
+        std::size_t count = 0;
+        for (auto i = from * stride; i < samples.size(); i += stride, ++count) {
+            sum += static_cast<double>(samples[i]) * samples[i];
+        }
+        return std::sqrt(sum / count);
+    }
+} // namespace
+
+TEST_CASE("Equalizer transform formats")
+{
+    const auto format = audio::AudioFormat{48000, 16, 2};
+    EqualizerTransform equalizer{format, makeBands()};
+
+    REQUIRE(equalizer.getActiveBandsCount() == 4);
+    REQUIRE(equalizer.validateInputFormat(format));
+    REQUIRE_FALSE(equalizer.validateInputFormat(audio::AudioFormat{44100, 16, 2}));
+    REQUIRE(equalizer.transformFormat(format) == format);
+    REQUIRE(equalizer.transformBlockSize(512) == 512);
+    REQUIRE(equalizer.transformBlockSizeInverted(512) == 512);
+
+    REQUIRE(EqualizerTransform::isFlat(flatBands()));
+    REQUIRE_FALSE(EqualizerTransform::isFlat(makeBands()));
+
+    REQUIRE_THROWS_AS(EqualizerTransform(audio::AudioFormat{48000, 24, 2}, makeBands()), std::invalid_argument);
+    REQUIRE_THROWS_AS(EqualizerTransform(audio::AudioFormat{48000, 16, 4}, makeBands()), std::invalid_argument);
+    auto outOfRange  = flatBands();
+    outOfRange[0].b0 = 20;
+    REQUIRE_THROWS_AS(EqualizerTransform(format, outOfRange), std::invalid_argument);
+}
+
+TEST_CASE("Equalizer transform filtering")
+{
+    SECTION("Flat bands pass the signal through")
+    {
+        EqualizerTransform equalizer{audio::AudioFormat{48000, 16, 2}, flatBands()};
+        const auto input = makeSine(2, 440, 4800, 30000);
+        REQUIRE(process(equalizer, input, 512) == input);
+    }
+
+    SECTION("Cascade follows the floating point filters")
+    {
+        const auto channels = GENERATE(1U, 2U);
+        CAPTURE(channels);
+
+        std::mt19937 generator{channels};
+        std::uniform_int_distribution<int> noise{-4000, 4000};
+        std::vector<std::int16_t> input(48000 / 4 * channels);
+        for (auto &sample : input) {
+            sample = static_cast<std::int16_t>(noise(generator));
+        }
+
+        EqualizerTransform equalizer{audio::AudioFormat{48000, 16, channels}, makeBands()};
+        const auto output   = process(equalizer, input, 1000);
+        const auto expected = reference(makeBands(), input, channels);
+        double maxError     = 0;
+        for (std::size_t i = 0; i < output.size(); ++i) {
+            maxError = std::max(maxError, std::abs(output[i] - expected[i]));
+        }
+        REQUIRE(maxError < 1);
+    }
+
+    SECTION("Blocks are filtered seamlessly and in-place")
+    {
+        const auto input = makeSine(2, 100, 4800, 12000);
+        EqualizerTransform whole{audio::AudioFormat{48000, 16, 2}, makeBands()};
+        EqualizerTransform split{audio::AudioFormat{48000, 16, 2}, makeBands()};
+        REQUIRE(process(whole, input, input.size()) == process(split, input, 94));
+
+        SECTION("Reset clears the filter states")
+        {
+            split.reset();
+            whole.reset();
+            REQUIRE(process(whole, input, input.size()) == process(split, input, 256));
+        }
+    }
+
+    SECTION("Band gain and channel separation")
+    {
+        const auto boost = qfilter_CalculateCoeffs(FilterType::Parametric, 1000, 48000, 1.0f, 6);
+        const auto bands = audio::equalizer::Equalizer{boost, noBand(), noBand(), noBand(), noBand()};
+        EqualizerTransform equalizer{audio::AudioFormat{48000, 16, 2}, bands};
+        const auto input  = makeSine(2, 1000, 9600, 8000);
+        const auto output = process(equalizer, input, 512);
+
+        const auto gain = 20 * std::log10(rms(output, 4800, 2) / rms(input, 4800, 2));
+        REQUIRE(gain == Approx(6).margin(0.1));
+        REQUIRE(rms(std::vector<std::int16_t>(output.begin() + 1, output.end()), 0, 2) == 0);
+    }
+}
+
+TEST_CASE("Equalizer transform limiter")
+{
+    const auto boost     = qfilter_CalculateCoeffs(FilterType::LowShelf, 200, 48000, 0.701f, 12);
+    const auto bands     = audio::equalizer::Equalizer{boost, noBand(), noBand(), noBand(), noBand()};
+    const auto settings  = EqualizerTransform::LimiterSettings{.threshold_dBFS = -3.0f};
+    const auto threshold = static_cast<int>(std::lround(INT16_MAX * std::pow(10.0, -3.0 / 20)));
+
+    EqualizerTransform equalizer{audio::AudioFormat{48000, 16, 2}, bands, settings};
+    // a loud bass note boosted by 12 dB would clip hard without the limiter
+    auto input       = makeSine(2, 80, 9600, 20000);
+    const auto quiet = makeSine(2, 80, 48000, 2000);
+    input.insert(input.end(), quiet.begin(), quiet.end());
+    const auto output = process(equalizer, input, 512);
+
+    for (const auto sample : output) {
+        REQUIRE(std::abs(sample) <= threshold);
+    }
+    REQUIRE(rms(std::vector<std::int16_t>(output.begin(), output.begin() + 9600 * 2), 2400, 2) > 0.6 * threshold);
+
+    // quiet part is only delayed once the gain recovers
+    EqualizerTransform unlimited{audio::AudioFormat{48000, 16, 2}, bands};
+    const auto expected = process(unlimited, input, 512);
+    const auto latency  = 72; // 1.5 ms
+    for (std::size_t i = (9600 + 24000) * 2; i < expected.size() - latency * 2; ++i) {
+        REQUIRE(output[i + latency * 2] == expected[i]);
+    }
+}
+
+TEST_CASE("Peak limiter")
+{
+    constexpr std::int32_t threshold = 1000;
+    constexpr std::size_t lookahead  = 8;
+    PeakLimiter limiter{1, threshold, lookahead, 100};
+    REQUIRE(limiter.getLatency() == lookahead);
+
+    SECTION("Signal below the threshold is only delayed")
+    {
+        std::vector<std::int32_t> samples(64);
+        for (std::size_t i = 0; i < samples.size(); ++i) {
+            samples[i] = static_cast<std::int32_t>(i * 10);
+        }
+        auto output = samples;
+        limiter.process(output.data(), output.size());
+        for (std::size_t i = lookahead; i < samples.size(); ++i) {
+            REQUIRE(output[i] == samples[i - lookahead]);
+        }
+        REQUIRE(limiter.getCurrentGain() == 1 << 15);
+    }
+
+    SECTION("Single peak is attenuated before it arrives and released afterwards")
+    {
+        std::vector<std::int32_t> samples(400, 500);
+        samples[100] = -4000;
+        auto output  = samples;
+        limiter.process(output.data(), output.size());
+
+        REQUIRE(output[100 + lookahead] == -1000);
+        for (const auto sample : output) {
+            REQUIRE(std::abs(sample) <= threshold);
+        }
+        // the gain ramps down during the look-ahead instead of jumping
+        for (std::size_t i = 100; i < 100 + lookahead; ++i) {
+            REQUIRE(output[i + 1] <= output[i]);
+        }
+        // and recovers within the release time
+        REQUIRE(output.back() == 500);
+        REQUIRE(limiter.getCurrentGain() == 1 << 15);
+    }
+
+    SECTION("Reset restores the unity gain")
+    {
+        std::vector<std::int32_t> samples(16, 30000);
+        limiter.process(samples.data(), samples.size());
+        REQUIRE(limiter.getCurrentGain() < 1 << 15);
+        limiter.reset();
+        REQUIRE(limiter.getCurrentGain() == 1 << 15);
+    }
+}
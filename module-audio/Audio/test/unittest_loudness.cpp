@@ -0,0 +1,181 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <Audio/loudness/LoudnessMeter.hpp>
+#include <Audio/transcode/GainTransform.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using audio::loudness::LoudnessMeter;
+using audio::loudness::Measurement;
+using audio::transcode::GainTransform;
+
+namespace
+{
+    constexpr double pi = 3.14159265358979323846;
+
+    /// Sine of the given level in dBFS, the same in all channels
+    auto makeSine(std::uint32_t rate, std::uint32_t channels, double frequency, double level_dBFS, double seconds)
+        -> std::vector<std::int16_t>
+    {
+        const auto frames    = static_cast<std::size_t>(rate * seconds);
+        const auto amplitude = 32768.0 * std::pow(10.0, level_dBFS / 20.0);
+        std::vector<std::int16_t> samples(frames * channels);
+        for (std::size_t i = 0; i < frames; ++i) {
+            const auto value = std::lround(amplitude * std::sin(2 * pi * frequency * i / rate));
+            for (std::uint32_t channel = 0; channel < channels; ++channel) {
+                samples[i * channels + channel] = static_cast<std::int16_t>(value);
+            }
+        }
+        return samples;
+    }
+
+    void append(std::vector<std::int16_t> &samples, const std::vector<std::int16_t> &other)
+    {
+        samples.insert(samples.end(), other.begin(), other.end());
+    }
+} // namespace
+
+TEST_CASE("Loudness meter")
+{
+    SECTION("Stereo 1 kHz sine reads its level in LUFS")
+    {
+        const auto rate = GENERATE(44100U, 48000U);
+        CAPTURE(rate);
+        LoudnessMeter meter{rate, 2};
+        const auto samples = makeSine(rate, 2, 1000, -20, 5);
+        meter.process(samples.data(), samples.size() / 2);
+
+        REQUIRE(meter.getIntegratedLoudness().has_value());
+        REQUIRE(*meter.getIntegratedLoudness() == Approx(-20.0).margin(0.1));
+        REQUIRE(meter.getSamplePeak() == Approx(-20.0).margin(0.01));
+    }
+
+    SECTION("Mono signal counts one channel")
+    {
+        LoudnessMeter meter{48000, 1};
+        const auto samples = makeSine(48000, 1, 1000, -20, 5);
+        meter.process(samples.data(), samples.size());
+        REQUIRE(*meter.getIntegratedLoudness() == Approx(-23.0).margin(0.1));
+    }
+
+    SECTION("Chunk size does not matter")
+    {
+        const auto samples = makeSine(44100, 2, 300, -12, 3);
+        LoudnessMeter whole{44100, 2};
+        LoudnessMeter chunked{44100, 2};
+        whole.process(samples.data(), samples.size() / 2);
+        for (std::size_t frame = 0; frame < samples.size() / 2; frame += 1000) {
+            chunked.process(&samples[frame * 2], std::min<std::size_t>(1000, samples.size() / 2 - frame));
+        }
+        REQUIRE(*whole.getIntegratedLoudness() == *chunked.getIntegratedLoudness());
+    }
+
+    SECTION("Gates skip silence and quiet passages")
+    {
+        auto samples = makeSine(48000, 2, 1000, -20, 10);
+        append(samples, std::vector<std::int16_t>(48000 * 2 * 10, 0));
+        append(samples, makeSine(48000, 2, 1000, -45, 10));
+        LoudnessMeter meter{48000, 2};
+        meter.process(samples.data(), samples.size() / 2);
+        REQUIRE(*meter.getIntegratedLoudness() == Approx(-20.0).margin(0.1));
+    }
+
+    SECTION("Silence and short files have no loudness")
+    {
+        LoudnessMeter meter{48000, 2};
+        const std::vector<std::int16_t> silence(48000 * 2, 0);
+        meter.process(silence.data(), silence.size() / 2);
+        REQUIRE_FALSE(meter.getIntegratedLoudness().has_value());
+        REQUIRE(meter.getMeasurement().integrated == audio::loudness::silenceLoudness);
+
+        const auto shortSine = makeSine(48000, 2, 1000, -20, 0.3);
+        meter.reset();
+        meter.process(shortSine.data(), shortSine.size() / 2);
+        REQUIRE_FALSE(meter.getIntegratedLoudness().has_value());
+        REQUIRE(meter.getSamplePeak() == Approx(-20.0).margin(0.01));
+    }
+
+    SECTION("Unsupported formats")
+    {
+        REQUIRE_THROWS_AS(LoudnessMeter(48000, 0), std::invalid_argument);
+        REQUIRE_THROWS_AS(LoudnessMeter(48000, 3), std::invalid_argument);
+        REQUIRE_THROWS_AS(LoudnessMeter(0, 2), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Loudness playback gain")
+{
+    // loud track is attenuated to the reference
+    REQUIRE(audio::loudness::playbackGain(Measurement{.integrated = -8.0f, .peak = -0.1f}) == -10.0f);
+    // quiet track is boosted as far as its peak allows
+    REQUIRE(audio::loudness::playbackGain(Measurement{.integrated = -21.0f, .peak = -2.0f}) == 2.0f);
+    REQUIRE(audio::loudness::playbackGain(Measurement{.integrated = -22.0f, .peak = -10.0f}) == 4.0f);
+    // and never above the boost limit
+    REQUIRE(audio::loudness::playbackGain(Measurement{.integrated = -40.0f, .peak = -30.0f}) ==
+            audio::loudness::maxBoost);
+}
+
+TEST_CASE("Gain transform")
+{
+    const auto format = audio::AudioFormat{44100, 16, 2};
+    std::vector<std::int16_t> samples{1000, -1000, 20000, -20000, 32767, -32768};
+    auto span = GainTransform::Span{.data     = reinterpret_cast<std::uint8_t *>(samples.data()),
+                                    .dataSize = samples.size() * sizeof(std::int16_t)};
+
+    SECTION("Attenuation")
+    {
+        GainTransform gain{format, -6.0206f};
+        REQUIRE(gain.transform(span, span).dataSize == span.dataSize);
+        REQUIRE(samples == std::vector<std::int16_t>{500, -500, 10000, -10000, 16383, -16384});
+    }
+
+    SECTION("Boost saturates")
+    {
+        GainTransform gain{format, 6.0f};
+        std::vector<std::int16_t> output(samples.size());
+        gain.transform(span, GainTransform::Span{.data     = reinterpret_cast<std::uint8_t *>(output.data()),
+                                                 .dataSize = output.size() * sizeof(std::int16_t)});
+        REQUIRE(output == std::vector<std::int16_t>{1995, -1996, 32767, -32768, 32767, -32768});
+    }
+
+    SECTION("Gain changed while running")
+    {
+        GainTransform gain{format, 0.0f};
+        gain.transform(span, span);
+        REQUIRE(samples[0] == 1000);
+
+        std::vector<std::int16_t> block(64, 16000);
+        auto blockSpan = GainTransform::Span{.data     = reinterpret_cast<std::uint8_t *>(block.data()),
+                                             .dataSize = block.size() * sizeof(std::int16_t)};
+        gain.setGain(-6.0206f);
+        gain.transform(blockSpan, blockSpan);
+        REQUIRE(block.front() == 16000);
+        REQUIRE(std::is_sorted(block.rbegin(), block.rend()));
+        REQUIRE(block.back() > 8000);
+        REQUIRE(block.back() < 8500);
+
+        std::fill(block.begin(), block.end(), 16000);
+        gain.transform(blockSpan, blockSpan);
+        REQUIRE(std::all_of(block.begin(), block.end(), [](auto sample) { return sample == 8000; }));
+        REQUIRE_THROWS_AS(gain.setGain(7.0f), std::invalid_argument);
+        REQUIRE(gain.getGain() == audio::mix::unityGain / 2);
+    }
+
+    SECTION("Formats and ranges")
+    {
+        GainTransform gain{format, 0.0f};
+        REQUIRE(gain.getGain() == audio::mix::unityGain);
+        REQUIRE(gain.validateInputFormat(format));
+        REQUIRE(gain.transformFormat(format) == format);
+        REQUIRE(gain.transformBlockSize(256) == 256);
+        REQUIRE_THROWS_AS(GainTransform(format, 7.0f), std::invalid_argument);
+        REQUIRE_FALSE(GainTransform::isSupported(audio::AudioFormat{44100, 24, 2}));
+        REQUIRE_THROWS_AS(GainTransform(audio::AudioFormat{44100, 24, 2}, 0.0f), std::invalid_argument);
+    }
+}
@@ -0,0 +1,245 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <Audio/MixerStream.hpp>
+#include <Audio/Stream.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    constexpr std::size_t samplesPerBlock = 32;
+    constexpr std::size_t blockSize       = samplesPerBlock * sizeof(std::int16_t);
+    constexpr audio::AudioFormat format{44100, 16, 2};
+
+    using Block = std::array<std::int16_t, samplesPerBlock>;
+
+    Block makeBlock(std::int16_t value)
+    {
+        Block block;
+        block.fill(value);
+        return block;
+    }
+
+    void pushBlock(audio::Stream &stream, std::int16_t value)
+    {
+        auto block = makeBlock(value);
+        REQUIRE(stream.push(block.data(), blockSize));
+    }
+
+    auto popBlock(audio::MixerStream &mixer) -> Block
+    {
+        Block block{};
+        audio::AbstractStream::Span span{.data = reinterpret_cast<std::uint8_t *>(block.data()), .dataSize = blockSize};
+        REQUIRE(mixer.pop(span));
+        return block;
+    }
+
+    class EventCounter : public audio::AbstractStream::EventListener
+    {
+      public:
+        void onEvent(audio::AbstractStream *, audio::AbstractStream::Event event) override
+        {
+            if (event == audio::AbstractStream::Event::StreamUnderFlow) {
+                ++underflows;
+            }
+        }
+
+        std::size_t underflows = 0;
+    };
+} // namespace
+
+TEST_CASE("Mix kernels saturate")
+{
+    std::array<std::int16_t, 4> out{30000, -30000, 1000, -1000};
+    const std::array<std::int16_t, 4> in{30000, -30000, 2000, 2000};
+
+    SECTION("Unity gain")
+    {
+        audio::mix::accumulate(out.data(), in.data(), out.size(), audio::mix::unityGain);
+        REQUIRE(out == std::array<std::int16_t, 4>{INT16_MAX, INT16_MIN, 3000, 1000});
+    }
+
+    SECTION("Half gain")
+    {
+        audio::mix::accumulate(out.data(), in.data(), out.size(), audio::mix::unityGain / 2);
+        REQUIRE(out == std::array<std::int16_t, 4>{INT16_MAX, INT16_MIN, 2000, 0});
+    }
+
+    SECTION("Ramp")
+    {
+        std::vector<std::int16_t> rampOut(8, 0);
+        const std::vector<std::int16_t> rampIn(8, 8000);
+        audio::mix::accumulateRamp(rampOut.data(), rampIn.data(), rampOut.size(), audio::mix::unityGain, 0);
+        REQUIRE(rampOut.front() == 8000);
+        REQUIRE(std::is_sorted(rampOut.rbegin(), rampOut.rend()));
+        REQUIRE(rampOut.back() == 1000);
+    }
+}
+
+TEST_CASE("Mixer stream")
+{
+    audio::StandardStreamAllocator allocator;
+    audio::Stream music{format, allocator, blockSize, 8};
+    audio::Stream tone{format, allocator, blockSize, 8};
+    audio::MixerStream mixer{format, allocator, blockSize};
+
+    const auto musicID = mixer.addInput(music);
+    const auto toneID  = mixer.addInput(tone);
+    REQUIRE(musicID.has_value());
+    REQUIRE(toneID.has_value());
+    REQUIRE(mixer.getInputsCount() == 2);
+
+    SECTION("Inputs are summed and consumed")
+    {
+        pushBlock(music, 1000);
+        pushBlock(tone, 500);
+        REQUIRE(popBlock(mixer) == makeBlock(1500));
+        REQUIRE(music.isEmpty());
+        REQUIRE(tone.isEmpty());
+        REQUIRE(mixer.isEmpty());
+    }
+
+    SECTION("Sum saturates")
+    {
+        pushBlock(music, 20000);
+        pushBlock(tone, 20000);
+        REQUIRE(popBlock(mixer) == makeBlock(INT16_MAX));
+    }
+
+    SECTION("Input without data contributes silence")
+    {
+        pushBlock(music, 1000);
+        pushBlock(music, 2000);
+        pushBlock(tone, 500);
+        REQUIRE(popBlock(mixer) == makeBlock(1500));
+        REQUIRE(popBlock(mixer) == makeBlock(2000));
+
+        audio::AbstractStream::Span span;
+        REQUIRE_FALSE(mixer.peek(span));
+    }
+
+    SECTION("Peek and unpeek keep the inputs intact")
+    {
+        pushBlock(music, 1000);
+        audio::AbstractStream::Span span;
+        REQUIRE(mixer.peek(span));
+        REQUIRE(span.dataSize == blockSize);
+        REQUIRE_FALSE(mixer.peek(span));
+        mixer.unpeek();
+        REQUIRE(music.getUsedBlockCount() == 1);
+        REQUIRE(popBlock(mixer) == makeBlock(1000));
+    }
+
+    SECTION("Underflow is reported only without data")
+    {
+        EventCounter events;
+        mixer.registerListener(&events);
+        audio::AbstractStream::Span span;
+
+        pushBlock(music, 1000);
+        REQUIRE(mixer.peek(span));
+        REQUIRE_FALSE(mixer.peek(span));
+        REQUIRE(events.underflows == 0);
+
+        mixer.consume();
+        REQUIRE_FALSE(mixer.peek(span));
+        REQUIRE(events.underflows == 1);
+        mixer.unregisterListeners(&events);
+    }
+
+    SECTION("Input removed while its block is peeked")
+    {
+        pushBlock(music, 1000);
+        pushBlock(tone, 500);
+        audio::AbstractStream::Span span;
+        REQUIRE(mixer.peek(span));
+        mixer.removeInput(*toneID);
+        REQUIRE(tone.getUsedBlockCount() == 1);
+        mixer.consume();
+        REQUIRE(music.isEmpty());
+        REQUIRE(tone.getUsedBlockCount() == 1);
+    }
+
+    SECTION("Gain is applied")
+    {
+        mixer.setGain(*toneID, audio::mix::unityGain / 4);
+        pushBlock(music, 1000);
+        pushBlock(tone, 4000);
+        REQUIRE(popBlock(mixer) == makeBlock(2000));
+    }
+
+    SECTION("Ducking ramps the other inputs down and back up")
+    {
+        // 1 ms takes 3 blocks of the format above
+        mixer.duck(*toneID, audio::mix::unityGain / 4, 1ms);
+
+        std::vector<std::int16_t> musicLevels;
+        for (auto i = 0; i < 6; ++i) {
+            pushBlock(music, 8000);
+            pushBlock(tone, 0);
+            musicLevels.push_back(popBlock(mixer).back());
+        }
+        REQUIRE(std::is_sorted(musicLevels.rbegin(), musicLevels.rend()));
+        REQUIRE(musicLevels.front() < 8000);
+        REQUIRE(musicLevels.back() == 2000);
+
+        pushBlock(music, 0);
+        pushBlock(tone, 1000);
+        REQUIRE(popBlock(mixer) == makeBlock(1000));
+
+        SECTION("Restored when unducked")
+        {
+            mixer.unduck(0ms);
+            pushBlock(music, 8000);
+            REQUIRE(popBlock(mixer) == makeBlock(8000));
+        }
+
+        SECTION("Restored when the ducking input is removed")
+        {
+            mixer.removeInput(*toneID);
+            REQUIRE(mixer.getInputsCount() == 1);
+            pushBlock(music, 8000);
+            REQUIRE(popBlock(mixer) == makeBlock(8000));
+        }
+    }
+
+    SECTION("Input added while ducking is ducked too")
+    {
+        audio::Stream voice{format, allocator, blockSize, 8};
+        mixer.duck(*toneID, audio::mix::unityGain / 2, 0ms);
+        REQUIRE(mixer.addInput(voice).has_value());
+        pushBlock(voice, 4000);
+        REQUIRE(popBlock(mixer) == makeBlock(2000));
+    }
+
+    SECTION("Inputs not matching the mixer or exceeding its capacity are rejected")
+    {
+        audio::Stream otherBlockSize{format, allocator, blockSize * 2, 8};
+        audio::Stream otherFormat{audio::AudioFormat{48000, 16, 2}, allocator, blockSize, 8};
+        REQUIRE_FALSE(mixer.addInput(otherBlockSize).has_value());
+        REQUIRE_FALSE(mixer.addInput(otherFormat).has_value());
+
+        std::vector<std::unique_ptr<audio::Stream>> extra;
+        for (auto i = mixer.getInputsCount(); i < audio::MixerStream::maxInputs; ++i) {
+            extra.push_back(std::make_unique<audio::Stream>(format, allocator, blockSize, 8));
+            REQUIRE(mixer.addInput(*extra.back()).has_value());
+        }
+        audio::Stream oneTooMany{format, allocator, blockSize, 8};
+        REQUIRE_FALSE(mixer.addInput(oneTooMany).has_value());
+    }
+
+    SECTION("Mixer cannot be written")
+    {
+        auto block = makeBlock(1);
+        REQUIRE_FALSE(mixer.push(block.data(), blockSize));
+        audio::AbstractStream::Span span;
+        REQUIRE_FALSE(mixer.reserve(span));
+    }
+}
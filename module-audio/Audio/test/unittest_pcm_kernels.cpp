@@ -0,0 +1,232 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+
+#include <Audio/PcmKernels.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace pcm = audio::pcm;
+
+namespace
+{
+    /// Lengths around the vector sizes, so that both the vectorized and the scalar parts are run
+    constexpr std::size_t lengths[] = {0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 31, 33, 64, 100, 257};
+
+    template <typename T>
+    auto randomSamples(std::size_t count, std::uint32_t seed) -> std::vector<T>
+    {
+        std::mt19937 generator{seed};
+        std::uniform_int_distribution<std::uint64_t> distribution;
+        std::vector<T> samples(count);
+        for (auto &sample : samples) {
+            sample = static_cast<T>(distribution(generator));
+        }
+        // full scale values catch the saturation
+        if (count > 2) {
+            samples[0] = std::numeric_limits<T>::max();
+            samples[1] = std::numeric_limits<T>::min();
+        }
+        return samples;
+    }
+
+    template <unsigned Ratio, typename Frame>
+    void checkRepeat()
+    {
+        for (const auto frames : lengths) {
+            const auto in = randomSamples<Frame>(frames, frames);
+            std::vector<Frame> expected(frames * Ratio);
+            for (std::size_t i = 0; i < expected.size(); ++i) {
+                expected[i] = in[i / Ratio];
+            }
+
+            std::vector<Frame> out(frames * Ratio);
+            pcm::repeat<Ratio>(out.data(), in.data(), frames);
+            REQUIRE(out == expected);
+
+            std::vector<Frame> inPlace(frames * Ratio);
+            std::copy(in.begin(), in.end(), inPlace.begin());
+            pcm::repeat<Ratio>(inPlace.data(), inPlace.data(), frames);
+            REQUIRE(inPlace == expected);
+        }
+    }
+
+    template <unsigned Ratio, typename Frame>
+    void checkDecimate()
+    {
+        for (const auto frames : lengths) {
+            const auto in = randomSamples<Frame>(frames * Ratio, frames);
+            std::vector<Frame> expected(frames);
+            for (std::size_t i = 0; i < frames; ++i) {
+                expected[i] = in[i * Ratio];
+            }
+
+            std::vector<Frame> out(frames);
+            pcm::decimate<Ratio>(out.data(), in.data(), frames);
+            REQUIRE(out == expected);
+
+            auto inPlace = in;
+            pcm::decimate<Ratio>(inPlace.data(), inPlace.data(), frames);
+            inPlace.resize(frames);
+            REQUIRE(inPlace == expected);
+        }
+    }
+} // namespace
+
+TEST_CASE("PCM kernels repeat frames")
+{
+    checkRepeat<2, std::int16_t>();
+    checkRepeat<2, std::uint16_t>();
+    checkRepeat<2, std::uint32_t>();
+    checkRepeat<2, std::uint64_t>();
+    checkRepeat<3, std::uint16_t>();
+    checkRepeat<4, std::uint32_t>();
+}
+
+TEST_CASE("PCM kernels decimate frames")
+{
+    checkDecimate<2, std::int16_t>();
+    checkDecimate<2, std::uint16_t>();
+    checkDecimate<2, std::uint32_t>();
+    checkDecimate<2, std::uint64_t>();
+    checkDecimate<3, std::uint16_t>();
+    checkDecimate<4, std::uint32_t>();
+}
+
+TEST_CASE("PCM kernels convert channels")
+{
+    for (const auto frames : lengths) {
+        SECTION("Mono to stereo in place, frames " + std::to_string(frames))
+        {
+            const auto mono = randomSamples<std::int16_t>(frames, 1);
+            std::vector<std::int16_t> buffer(frames * 2);
+            std::copy(mono.begin(), mono.end(), buffer.begin());
+            pcm::monoToStereo(buffer.data(), buffer.data(), frames);
+            for (std::size_t i = 0; i < frames; ++i) {
+                REQUIRE(buffer[2 * i] == mono[i]);
+                REQUIRE(buffer[2 * i + 1] == mono[i]);
+            }
+        }
+
+        SECTION("Stereo to mono, frames " + std::to_string(frames))
+        {
+            const auto stereo = randomSamples<std::int16_t>(frames * 2, 2);
+            std::vector<std::int16_t> out(frames);
+            pcm::stereoToMono(out.data(), stereo.data(), frames);
+
+            auto inPlace = stereo;
+            pcm::stereoToMono(inPlace.data(), inPlace.data(), frames);
+            for (std::size_t i = 0; i < frames; ++i) {
+                const auto expected = static_cast<std::int16_t>((stereo[2 * i] + stereo[2 * i + 1]) >> 1);
+                REQUIRE(out[i] == expected);
+                REQUIRE(inPlace[i] == expected);
+            }
+        }
+    }
+
+    SECTION("Full scale channels")
+    {
+        const std::vector<std::int16_t> stereo{INT16_MAX, INT16_MAX, INT16_MIN, INT16_MIN, INT16_MAX, INT16_MIN};
+        std::vector<std::int16_t> mono(3);
+        pcm::stereoToMono(mono.data(), stereo.data(), mono.size());
+        REQUIRE(mono == std::vector<std::int16_t>{INT16_MAX, INT16_MIN, -1});
+    }
+}
+
+TEST_CASE("PCM kernels convert formats")
+{
+    for (const auto samples : lengths) {
+        const auto in = randomSamples<std::int16_t>(samples, 3);
+
+        SECTION("Float round trip, samples " + std::to_string(samples))
+        {
+            std::vector<float> floats(samples);
+            pcm::toFloat(floats.data(), in.data(), samples);
+            for (std::size_t i = 0; i < samples; ++i) {
+                REQUIRE(floats[i] == static_cast<float>(in[i]) / 32768.0f);
+            }
+
+            std::vector<std::int16_t> out(samples);
+            pcm::fromFloat(out.data(), floats.data(), samples);
+            REQUIRE(out == in);
+        }
+
+        SECTION("Q round trip, samples " + std::to_string(samples))
+        {
+            std::vector<std::int32_t> wide(samples);
+            pcm::toQ<8>(wide.data(), in.data(), samples);
+            for (std::size_t i = 0; i < samples; ++i) {
+                REQUIRE(wide[i] == in[i] * 256);
+            }
+
+            std::vector<std::int16_t> out(samples);
+            pcm::fromQ<8>(out.data(), wide.data(), samples);
+            REQUIRE(out == in);
+        }
+    }
+
+    SECTION("Float rounding and saturation")
+    {
+        const std::vector<float> in{0.5f / 32768,
+                                    1.5f / 32768,
+                                    -1.5f / 32768,
+                                    0.4f / 32768,
+                                    1.0f,
+                                    -1.0f,
+                                    -2.0f,
+                                    100.0f,
+                                    std::numeric_limits<float>::infinity(),
+                                    -std::numeric_limits<float>::infinity(),
+                                    0.25f,
+                                    std::numeric_limits<float>::quiet_NaN()};
+        std::vector<std::int16_t> out(in.size());
+        pcm::fromFloat(out.data(), in.data(), in.size());
+        const std::vector<std::int16_t> expected{
+            0, 2, -2, 0, INT16_MAX, INT16_MIN, INT16_MIN, INT16_MAX, INT16_MAX, INT16_MIN, 8192, INT16_MIN};
+        REQUIRE(out == expected);
+    }
+
+    SECTION("Q rounding and saturation")
+    {
+        const std::vector<std::int32_t> in{127, 128, -128, -129, 40000 * 256, -40000 * 256, 255, 0, 1 << 22};
+        std::vector<std::int16_t> out(in.size());
+        pcm::fromQ<8>(out.data(), in.data(), in.size());
+        REQUIRE(out == std::vector<std::int16_t>{0, 1, 0, -1, INT16_MAX, INT16_MIN, 1, 0, 16384});
+    }
+}
+
+TEST_CASE("PCM kernels apply gain")
+{
+    constexpr pcm::Gain gains[] = {
+        0, 1, pcm::unityGain / 3, pcm::unityGain - 1, pcm::unityGain, pcm::unityGain + 1, 50000, pcm::maxScaleGain};
+
+    for (const auto samples : lengths) {
+        const auto in  = randomSamples<std::int16_t>(samples, 4);
+        const auto acc = randomSamples<std::int16_t>(samples, 5);
+
+        for (const auto gain : gains) {
+            auto scaled = in;
+            pcm::scale(scaled.data(), samples, gain);
+
+            auto added = acc;
+            pcm::addScaled(added.data(), in.data(), samples, gain);
+
+            for (std::size_t i = 0; i < samples; ++i) {
+                const auto product = (static_cast<std::int32_t>(in[i]) * gain) >> pcm::gainShift;
+                REQUIRE(scaled[i] == pcm::saturate(product));
+                REQUIRE(added[i] == pcm::saturate(acc[i] + product));
+            }
+        }
+
+        auto sum = acc;
+        pcm::addSaturate(sum.data(), in.data(), samples);
+        for (std::size_t i = 0; i < samples; ++i) {
+            REQUIRE(sum[i] == pcm::saturate(acc[i] + in[i]));
+        }
+    }
+}
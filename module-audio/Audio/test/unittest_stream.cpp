@@ -8,6 +8,8 @@
 #include <Audio/AudioFormat.hpp>
 #include <Audio/StreamProxy.hpp>
 #include <Audio/StreamFactory.hpp>
+#include <Audio/StreamMetrics.hpp>
+#include <Audio/StreamTelemetry.hpp>
 #include <Audio/transcode/BasicDecimator.hpp>
 
 #include "MockEndpoint.hpp"
@@ -361,6 +363,155 @@ TEST(Stream, spanEquality)
     EXPECT_TRUE(span != span2);
 }
 
+TEST(Stream, Metrics)
+{
+    StandardStreamAllocator a;
+    constexpr auto bufferingSize = 4U;
+    Stream s(format, a, defaultBlockSize, bufferingSize);
+    Stream::Span span;
+
+    EXPECT_FALSE(s.peek(span));
+    for (auto i = 0U; i < bufferingSize; ++i) {
+        s.push();
+    }
+    EXPECT_FALSE(s.push());
+
+    s.peek(span);
+    s.peek(span);
+    s.consume();
+    s.pop(span);
+
+    auto metrics = s.getMetrics();
+    EXPECT_EQ(metrics.blocksWritten, bufferingSize);
+    EXPECT_EQ(metrics.blocksRead, 3);
+    EXPECT_EQ(metrics.underruns, 1);
+    EXPECT_EQ(metrics.overruns, 1);
+    EXPECT_EQ(metrics.recentUnderrunsCount, 1);
+    // reads at 4, 3 and 2 blocks out of 4, underrun at 0
+    EXPECT_EQ(metrics.fillLevels[0], 1);
+    EXPECT_EQ(metrics.fillLevels[4], 1);
+    EXPECT_EQ(metrics.fillLevels[6], 1);
+    EXPECT_EQ(metrics.fillLevels[7], 1);
+
+    // statistics are kept when the data is dropped
+    s.reset();
+    metrics = s.getMetrics();
+    EXPECT_EQ(metrics.blocksRead, 3);
+    EXPECT_EQ(metrics.underruns, 1);
+}
+
+TEST(Stream, MetricsReserveCommit)
+{
+    StandardStreamAllocator a;
+    constexpr auto bufferingSize = 2U;
+    Stream s(format, a, defaultBlockSize, bufferingSize);
+    Stream::Span span;
+
+    s.reserve(span);
+    s.reserve(span);
+    s.commit();
+    EXPECT_FALSE(s.reserve(span));
+
+    const auto metrics = s.getMetrics();
+    EXPECT_EQ(metrics.blocksWritten, 2);
+    EXPECT_EQ(metrics.overruns, 1);
+}
+
+TEST(StreamMetrics, Latency)
+{
+    ::audio::StreamMetrics metrics{4};
+    metrics.reset(1000);
+
+    metrics.onWrite(1000);
+    metrics.onWrite(1010);
+    metrics.onWrite(1050);
+    metrics.onRead(3, 1020);
+    metrics.onRead(2, 1040);
+    // the third block is dropped, the next one is written after it
+    metrics.onOverrun(0);
+    metrics.onWrite(1100);
+    metrics.onRead(1, 1105);
+
+    const auto snapshot = metrics.snapshot(1200);
+    EXPECT_EQ(snapshot.duration, 200);
+    EXPECT_EQ(snapshot.latencyMin, 5);
+    EXPECT_EQ(snapshot.latencyAverage, 18);
+    EXPECT_EQ(snapshot.latencyMax, 30);
+    EXPECT_EQ(snapshot.maxWriteGap, 50);
+    EXPECT_EQ(snapshot.maxReadGap, 65);
+}
+
+TEST(StreamMetrics, Gaps)
+{
+    ::audio::StreamMetrics metrics{4};
+    metrics.reset(0);
+
+    metrics.onWrite(0);
+    metrics.onRead(1, 10);
+    // pause, the time until the next write and read is not a gap
+    metrics.flush();
+    metrics.onWrite(5000);
+    metrics.onWrite(5020);
+    metrics.onRead(2, 5010);
+    metrics.onUnderrun(5030);
+
+    const auto snapshot = metrics.snapshot(6000);
+    EXPECT_EQ(snapshot.maxWriteGap, 20);
+    EXPECT_EQ(snapshot.maxReadGap, 20);
+    EXPECT_EQ(snapshot.latencyMax, 10);
+}
+
+TEST(StreamMetrics, RecentUnderruns)
+{
+    constexpr auto capacity = ::audio::StreamMetrics::recentUnderrunsCapacity;
+    ::audio::StreamMetrics metrics{4};
+    metrics.reset(0);
+
+    for (auto i = 0U; i < capacity + 3; ++i) {
+        metrics.onUnderrun(i * 100);
+    }
+
+    const auto snapshot = metrics.snapshot(10000);
+    EXPECT_EQ(snapshot.underruns, capacity + 3);
+    ASSERT_EQ(snapshot.recentUnderrunsCount, capacity);
+    for (auto i = 0U; i < capacity; ++i) {
+        EXPECT_EQ(snapshot.recentUnderruns[i], (i + 3) * 100);
+    }
+}
+
+TEST(StreamTelemetry, Reports)
+{
+    StandardStreamAllocator a;
+    auto stream = std::make_shared<Stream>(format, a, defaultBlockSize);
+    ::audio::StreamProxy proxy{std::static_pointer_cast<::audio::AbstractStream>(stream)};
+    EXPECT_EQ(::audio::telemetry::findStream(&proxy), stream.get());
+
+    int first, second;
+    ::audio::telemetry::track(&first, "first", *stream);
+    ::audio::telemetry::track(&second, "second", *stream);
+    stream->push();
+
+    auto reports = ::audio::telemetry::getReports();
+    ASSERT_GE(reports.size(), 2);
+    EXPECT_EQ(reports[0].name, "second");
+    EXPECT_TRUE(reports[0].active);
+    EXPECT_EQ(reports[0].blockCount, defaultBuffering);
+    EXPECT_EQ(reports[0].blockDuration, format.bytesToMicroseconds(defaultBlockSize));
+    EXPECT_EQ(reports[0].metrics.blocksWritten, 1);
+
+    ::audio::telemetry::untrack(&first);
+    ::audio::telemetry::untrack(&first);
+    reports = ::audio::telemetry::getReports();
+    ASSERT_GE(reports.size(), 2);
+    EXPECT_EQ(reports[0].name, "second");
+    EXPECT_EQ(reports[1].name, "first");
+    EXPECT_FALSE(reports[1].active);
+
+    ::audio::telemetry::untrack(&second);
+    const auto csv = ::audio::telemetry::toCsv(::audio::telemetry::getReports());
+    EXPECT_NE(csv.find(",second,0,24,"), std::string::npos);
+}
+
 TEST(Proxy, Write)
 {
     auto mock  = std::make_shared<MockStream>();
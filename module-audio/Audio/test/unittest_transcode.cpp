@@ -16,6 +16,7 @@
 #include <Audio/transcode/BasicInterpolator.hpp>
 #include <Audio/transcode/BasicDecimator.hpp>
 #include <Audio/transcode/NullTransform.hpp>
+#include <Audio/transcode/PolyphaseResampler.hpp>
 #include <Audio/transcode/TransformFactory.hpp>
 
 #include <cstdlib>
@@ -392,7 +393,8 @@ TEST(Transform, FactorySampleRateInterpolator)
 
     auto transform = factory.makeTransform(sourceFormat, sinkFormat);
 
-    EXPECT_STREQ(typeid(*transform).name(), typeid(::audio::transcode::BasicInterpolator<std::uint16_t, 1, 2>).name());
+    EXPECT_STREQ(typeid(*transform).name(), typeid(::audio::transcode::PolyphaseResampler).name());
+    EXPECT_EQ(transform->transformFormat(sourceFormat), sinkFormat);
 }
 
 TEST(Transform, FactorySampleRateDecimator)
@@ -403,10 +405,34 @@ TEST(Transform, FactorySampleRateDecimator)
 
     auto transform = factory.makeTransform(sourceFormat, sinkFormat);
 
-    EXPECT_STREQ(typeid(*transform).name(), typeid(::audio::transcode::BasicDecimator<std::uint16_t, 1, 2>).name());
+    EXPECT_STREQ(typeid(*transform).name(), typeid(::audio::transcode::PolyphaseResampler).name());
     EXPECT_EQ(transform->transformFormat(sourceFormat), sinkFormat);
 }
 
+TEST(Transform, FactorySampleRateNonIntegerRatio)
+{
+    auto factory      = ::audio::transcode::TransformFactory();
+    auto sourceFormat = ::audio::AudioFormat{44100, 16, 2};
+    auto sinkFormat   = ::audio::AudioFormat{48000, 16, 2};
+
+    auto transform = factory.makeTransform(sourceFormat, sinkFormat);
+
+    EXPECT_STREQ(typeid(*transform).name(), typeid(::audio::transcode::PolyphaseResampler).name());
+    EXPECT_EQ(transform->transformFormat(sourceFormat), sinkFormat);
+}
+
+TEST(Transform, FactorySampleRateWithoutResamplerFilters)
+{
+    auto factory = ::audio::transcode::TransformFactory();
+
+    auto interpolator = factory.makeTransform(::audio::AudioFormat{16000, 16, 1}, ::audio::AudioFormat{32000, 16, 1});
+    EXPECT_STREQ(typeid(*interpolator).name(),
+                 typeid(::audio::transcode::BasicInterpolator<std::uint16_t, 1, 2>).name());
+
+    auto decimator = factory.makeTransform(::audio::AudioFormat{32000, 16, 1}, ::audio::AudioFormat{16000, 16, 1});
+    EXPECT_STREQ(typeid(*decimator).name(), typeid(::audio::transcode::BasicDecimator<std::uint16_t, 1, 2>).name());
+}
+
 TEST(Tranform, FactoryNullTransform)
 {
     auto factory      = ::audio::transcode::TransformFactory();
@@ -448,13 +474,13 @@ TEST(Transform, FactoryErrors)
     auto factory = ::audio::transcode::TransformFactory();
     EXPECT_THROW(factory.makeTransform(::audio::AudioFormat{16000, 16, 1}, ::audio::AudioFormat{16000, 24, 1}),
                  std::runtime_error);
-    EXPECT_THROW(factory.makeTransform(::audio::AudioFormat{44100, 16, 1}, ::audio::AudioFormat{48000, 16, 1}),
+    EXPECT_THROW(factory.makeTransform(::audio::AudioFormat{44100, 16, 1}, ::audio::AudioFormat{32000, 16, 1}),
                  std::invalid_argument);
     EXPECT_THROW(factory.makeTransform(::audio::AudioFormat{8000, 16, 1}, ::audio::AudioFormat{24000, 16, 1}),
                  std::invalid_argument);
     EXPECT_THROW(factory.makeTransform(::audio::AudioFormat{16000, 32, 1}, ::audio::AudioFormat{8000, 32, 1}),
                  std::invalid_argument);
-    EXPECT_THROW(factory.makeTransform(::audio::AudioFormat{8000, 16, 2}, ::audio::AudioFormat{16000, 16, 2}),
+    EXPECT_THROW(factory.makeTransform(::audio::AudioFormat{16000, 16, 2}, ::audio::AudioFormat{32000, 16, 2}),
                  std::invalid_argument);
 
     // channel conversions
@@ -5,6 +5,8 @@
 
 #include "Transform.hpp"
 
+#include <Audio/PcmKernels.hpp>
+
 #include <integer.hpp>
 
 #include <type_traits>
@@ -15,9 +17,8 @@ namespace audio::transcode
 {
     /**
      * @brief Basic decimation transformation - for every Ratio samples it drops
-     * Ratio - 1 samples. The transformation is performed using basic integer type
-     * to allow compiler to perform loop optimizations. The transformation is performed
-     * in-place.
+     * Ratio - 1 samples. Frames are copied as a single integer by pcm::decimate, which
+     * is vectorized for decimation by 2. The transformation is performed in-place.
      *
      * @tparam SampleType - type of a single PCM sample, e.g., std::uint16_t for LPCM16
      * @tparam Channels - number of channels; 1 for mono, 2 for stereo
@@ -66,9 +67,7 @@ namespace audio::transcode
             IntegerType *input  = reinterpret_cast<IntegerType *>(inputSpan.data);
             IntegerType *output = reinterpret_cast<IntegerType *>(outputSpan.data);
 
-            for (unsigned i = 0; i < inputSpan.dataSize / sizeof(IntegerType) / Ratio; i++) {
-                output[i] = input[i * Ratio];
-            }
+            pcm::decimate<Ratio>(output, input, inputSpan.dataSize / sizeof(IntegerType) / Ratio);
 
             return outputSpan;
         }
@@ -5,6 +5,8 @@
 
 #include "Transform.hpp"
 
+#include <Audio/PcmKernels.hpp>
+
 #include <integer.hpp>
 
 #include <type_traits>
@@ -16,9 +18,9 @@ namespace audio::transcode
 {
     /**
      * @brief Basic interpolation transformation - for every Ratio samples it repeats
-     * Ratio - 1 samples. The transformation is performed using basic integer type
-     * to allow compiler to perform loop optimizations. The transformation is performed
-     * in-place. The transformed signal is not filtered with a low-pass filter.
+     * Ratio - 1 samples. Frames are copied as a single integer by pcm::repeat, which
+     * is vectorized for interpolation by 2. The transformation is performed in-place.
+     * The transformed signal is not filtered with a low-pass filter.
      *
      * @tparam SampleType - type of a single PCM sample, e.g., std::uint16_t for LPCM16
      * @tparam Channels - number of channels; 1 for mono, 2 for stereo
@@ -69,11 +71,7 @@ namespace audio::transcode
 
             assert(outputSpan.dataSize <= transformSpace.dataSize);
 
-            for (unsigned i = inputSpan.dataSize / sizeof(IntegerType); i > 0; i--) {
-                for (unsigned j = 1; j <= Ratio; j++) {
-                    output[i * Ratio - j] = input[i - 1];
-                }
-            }
+            pcm::repeat<Ratio>(output, input, inputSpan.dataSize / sizeof(IntegerType));
 
             return outputSpan;
         }
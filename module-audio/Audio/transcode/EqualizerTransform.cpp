@@ -0,0 +1,171 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "EqualizerTransform.hpp"
+
+#include <Audio/AudioFormat.hpp>
+#include <Audio/PcmKernels.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using audio::transcode::EqualizerTransform;
+
+namespace
+{
+    constexpr auto supportedBitWidth = 16U;
+
+    auto isIdentity(const audio::equalizer::QFilterCoefficients &band) noexcept -> bool
+    {
+        return band.b0 == 1.0f && band.b1 == 0.0f && band.b2 == 0.0f && band.a1 == 0.0f && band.a2 == 0.0f;
+    }
+
+    auto toFixed(float coefficient, unsigned shift) -> std::int32_t
+    {
+        const auto scaled = std::llround(static_cast<double>(coefficient) * (1 << shift));
+        if (scaled >= INT32_MAX || scaled <= INT32_MIN) {
+            throw std::invalid_argument("Equalizer coefficient out of range");
+        }
+        return static_cast<std::int32_t>(scaled);
+    }
+} // namespace
+
+EqualizerTransform::EqualizerTransform(const audio::AudioFormat &format,
+                                       const equalizer::Equalizer &bands,
+                                       std::optional<LimiterSettings> limiterSettings)
+    : format(format), channels(format.getChannels())
+{
+    if (!isSupported(format)) {
+        throw std::invalid_argument("Unsupported equalizer format: " + format.toString());
+    }
+
+    for (const auto &band : bands) {
+        if (isIdentity(band)) {
+            continue;
+        }
+        biquads.push_back(Biquad{.b0 = toFixed(band.b0, coefficientShift),
+                                 .b1 = toFixed(band.b1, coefficientShift),
+                                 .b2 = toFixed(band.b2, coefficientShift),
+                                 .a1 = toFixed(band.a1, coefficientShift),
+                                 .a2 = toFixed(band.a2, coefficientShift)});
+    }
+    states.resize(biquads.size());
+
+    if (limiterSettings.has_value()) {
+        const auto level     = std::pow(10.0f, std::min(limiterSettings->threshold_dBFS, 0.0f) / 20.0f);
+        const auto threshold = static_cast<std::int32_t>(std::lround(INT16_MAX * level)) << guardShift;
+        const auto rate      = format.getSampleRate();
+        limiter.emplace(channels,
+                        threshold,
+                        rate * limiterSettings->lookahead.count() / 1000000,
+                        rate * limiterSettings->release.count() / 1000);
+    }
+
+    reset();
+}
+
+auto EqualizerTransform::isSupported(const audio::AudioFormat &format) noexcept -> bool
+{
+    return format.getBitWidth() == supportedBitWidth && format.getChannels() >= 1 &&
+           format.getChannels() <= maxChannels && format.getSampleRate() != 0;
+}
+
+auto EqualizerTransform::isFlat(const equalizer::Equalizer &bands) noexcept -> bool
+{
+    return std::all_of(bands.begin(), bands.end(), isIdentity);
+}
+
+auto EqualizerTransform::transform(const Span &inputSpan, const Span &transformSpace) const -> Span
+{
+    const auto input  = reinterpret_cast<const std::int16_t *>(inputSpan.data);
+    const auto output = reinterpret_cast<std::int16_t *>(transformSpace.data);
+    const auto frames = inputSpan.dataSize / sizeof(std::int16_t) / channels;
+
+    for (std::size_t offset = 0; offset < frames; offset += chunkFrames) {
+        const auto chunk   = std::min(chunkFrames, frames - offset);
+        const auto samples = chunk * channels;
+        const auto in      = input + offset * channels;
+        const auto out     = output + offset * channels;
+
+        pcm::toQ<guardShift>(work.data(), in, samples);
+
+        if (channels == 2) {
+            filter<2>(work.data(), chunk);
+        }
+        else {
+            filter<1>(work.data(), chunk);
+        }
+
+        if (limiter.has_value()) {
+            limiter->process(work.data(), chunk);
+        }
+
+        pcm::fromQ<guardShift>(out, work.data(), samples);
+    }
+
+    return Span{.data = transformSpace.data, .dataSize = frames * channels * sizeof(std::int16_t)};
+}
+
+template <unsigned Channels>
+void EqualizerTransform::filter(std::int32_t *samples, std::size_t frames) const noexcept
+{
+    for (std::size_t band = 0; band < biquads.size(); ++band) {
+        const auto c = biquads[band];
+        auto state   = states[band];
+
+        for (std::size_t frame = 0; frame < frames; ++frame) {
+            const auto in = samples + frame * Channels;
+            for (unsigned channel = 0; channel < Channels; ++channel) {
+                auto &s      = state[channel];
+                const auto x = in[channel];
+                const auto acc =
+                    s.error + static_cast<std::int64_t>(c.b0) * x + static_cast<std::int64_t>(c.b1) * s.x1 +
+                    static_cast<std::int64_t>(c.b2) * s.x2 - static_cast<std::int64_t>(c.a1) * s.y1 -
+                    static_cast<std::int64_t>(c.a2) * s.y2;
+                const auto y = static_cast<std::int32_t>(acc >> coefficientShift);
+                s.error      = static_cast<std::int32_t>(acc - static_cast<std::int64_t>(y) * (1 << coefficientShift));
+                s.x2         = s.x1;
+                s.x1         = x;
+                s.y2         = s.y1;
+                s.y1         = y;
+                in[channel]  = y;
+            }
+        }
+
+        states[band] = state;
+    }
+}
+
+auto EqualizerTransform::validateInputFormat(const audio::AudioFormat &inputFormat) const noexcept -> bool
+{
+    return inputFormat == format;
+}
+
+auto EqualizerTransform::transformFormat(const audio::AudioFormat &inputFormat) const noexcept -> audio::AudioFormat
+{
+    return inputFormat;
+}
+
+auto EqualizerTransform::transformBlockSize(std::size_t blockSize) const noexcept -> std::size_t
+{
+    return blockSize;
+}
+
+auto EqualizerTransform::transformBlockSizeInverted(std::size_t blockSize) const noexcept -> std::size_t
+{
+    return blockSize;
+}
+
+void EqualizerTransform::reset()
+{
+    std::fill(states.begin(), states.end(), std::array<State, maxChannels>{});
+    if (limiter.has_value()) {
+        limiter->reset();
+    }
+}
+
+auto EqualizerTransform::getActiveBandsCount() const noexcept -> std::size_t
+{
+    return biquads.size();
+}
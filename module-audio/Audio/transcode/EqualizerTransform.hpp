@@ -0,0 +1,92 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include "PeakLimiter.hpp"
+#include "Transform.hpp"
+
+#include <Audio/equalizer/Equalizer.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace audio::transcode
+{
+    /**
+     * @brief Software equalizer for 16-bit mono or stereo PCM, for outputs without a codec doing it in hardware.
+     *
+     * The bands use the codec's filter coefficients, flat bands are skipped. Each band is a direct form I biquad
+     * with Q27 coefficients and 64-bit accumulation, the signal runs between the bands with 8 extra fractional bits
+     * and the truncation error is fed back into the next output, so that low frequency bands, whose poles amplify
+     * rounding noise the most, stay accurate. The block is processed band by band with both channels of a frame
+     * filtered side by side, which keeps the coefficients and states in registers. An optional look-ahead limiter
+     * keeps boosted signals from clipping, its latency is constant. Works in-place.
+     */
+    class EqualizerTransform : public Transform
+    {
+      public:
+        struct LimiterSettings
+        {
+            float threshold_dBFS = -1.0f;
+            std::chrono::microseconds lookahead{1500};
+            std::chrono::milliseconds release{100};
+        };
+
+        /**
+         * @param format - format of the processed data
+         * @param bands - filter coefficients of the bands
+         * @param limiter - settings of the limiter, none to disable it
+         * @throws std::invalid_argument if the format is not supported or coefficients are out of range
+         */
+        EqualizerTransform(const audio::AudioFormat &format,
+                           const equalizer::Equalizer &bands,
+                           std::optional<LimiterSettings> limiter = std::nullopt);
+
+        static auto isSupported(const audio::AudioFormat &format) noexcept -> bool;
+
+        /// Checks if the coefficients change the signal at all
+        static auto isFlat(const equalizer::Equalizer &bands) noexcept -> bool;
+
+        auto transform(const Span &inputSpan, const Span &transformSpace) const -> Span override;
+        auto validateInputFormat(const audio::AudioFormat &inputFormat) const noexcept -> bool override;
+        auto transformFormat(const audio::AudioFormat &inputFormat) const noexcept -> audio::AudioFormat override;
+        auto transformBlockSize(std::size_t blockSize) const noexcept -> std::size_t override;
+        auto transformBlockSizeInverted(std::size_t blockSize) const noexcept -> std::size_t override;
+
+        /// Clears the filter states and the limiter
+        void reset();
+
+        [[nodiscard]] auto getActiveBandsCount() const noexcept -> std::size_t;
+
+      private:
+        static constexpr unsigned coefficientShift = 27;
+        static constexpr unsigned guardShift       = 8;
+        static constexpr std::size_t maxChannels   = 2;
+        static constexpr std::size_t chunkFrames   = 128;
+
+        struct Biquad
+        {
+            std::int32_t b0, b1, b2, a1, a2;
+        };
+
+        struct State
+        {
+            std::int32_t x1, x2, y1, y2;
+            std::int32_t error; ///< Truncated part of the previous output, fed back into the next one
+        };
+
+        template <unsigned Channels>
+        void filter(std::int32_t *samples, std::size_t frames) const noexcept;
+
+        audio::AudioFormat format;
+        unsigned channels;
+        std::vector<Biquad> biquads;
+        mutable std::vector<std::array<State, maxChannels>> states;
+        mutable std::optional<PeakLimiter> limiter;
+        mutable std::array<std::int32_t, chunkFrames * maxChannels> work;
+    };
+} // namespace audio::transcode
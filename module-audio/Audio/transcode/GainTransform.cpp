@@ -0,0 +1,81 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "GainTransform.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+using audio::transcode::GainTransform;
+
+GainTransform::GainTransform(const audio::AudioFormat &format, float gain_dB)
+    : format(format), gain(toGain(gain_dB)), appliedGain(gain.load(std::memory_order_relaxed))
+{
+    if (!isSupported(format)) {
+        throw std::invalid_argument("Unsupported gain format: " + format.toString());
+    }
+}
+
+auto GainTransform::isSupported(const audio::AudioFormat &format) noexcept -> bool
+{
+    return format.getBitWidth() == 16 && format.getChannels() != 0;
+}
+
+void GainTransform::setGain(float gain_dB)
+{
+    gain.store(toGain(gain_dB), std::memory_order_relaxed);
+}
+
+auto GainTransform::toGain(float gain_dB) -> mix::Gain
+{
+    if (!(gain_dB <= maxGain_dB)) {
+        throw std::invalid_argument("Gain out of range: " + std::to_string(gain_dB));
+    }
+    const auto scaled = std::lround(std::pow(10.0f, gain_dB / 20.0f) * mix::unityGain);
+    return static_cast<mix::Gain>(std::min<long>(scaled, mix::maxScaleGain));
+}
+
+auto GainTransform::transform(const Span &inputSpan, const Span &transformSpace) const -> Span
+{
+    if (transformSpace.data != inputSpan.data) {
+        std::memcpy(transformSpace.data, inputSpan.data, inputSpan.dataSize);
+    }
+    const auto samples = reinterpret_cast<std::int16_t *>(transformSpace.data);
+    const auto count   = inputSpan.dataSize / sizeof(std::int16_t);
+    // the transform stays in the stream at unity until the gain is known, so that it can be changed without a restart
+    if (const auto currentGain = gain.load(std::memory_order_relaxed); currentGain != appliedGain && count != 0) {
+        mix::scaleRamp(samples, count, appliedGain, currentGain);
+        appliedGain = currentGain;
+    }
+    else if (currentGain != mix::unityGain) {
+        mix::scale(samples, count, currentGain);
+    }
+    return Span{.data = transformSpace.data, .dataSize = inputSpan.dataSize};
+}
+
+auto GainTransform::validateInputFormat(const audio::AudioFormat &inputFormat) const noexcept -> bool
+{
+    return inputFormat == format;
+}
+
+auto GainTransform::transformFormat(const audio::AudioFormat &inputFormat) const noexcept -> audio::AudioFormat
+{
+    return inputFormat;
+}
+
+auto GainTransform::transformBlockSize(std::size_t blockSize) const noexcept -> std::size_t
+{
+    return blockSize;
+}
+
+auto GainTransform::transformBlockSizeInverted(std::size_t blockSize) const noexcept -> std::size_t
+{
+    return blockSize;
+}
+
+auto GainTransform::getGain() const noexcept -> mix::Gain
+{
+    return gain.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,56 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include "Transform.hpp"
+
+#include <Audio/AudioFormat.hpp>
+#include <Audio/MixKernel.hpp>
+
+#include <atomic>
+
+namespace audio::transcode
+{
+    /**
+     * @brief Constant gain for 16-bit PCM, e.g. the loudness normalization offset of a track. Saturates instead of
+     * wrapping around. The gain can be changed while the stream runs, the next block ramps from the previous gain
+     * to the new one, so that a gain known only after the playback started does not make the sound jump.
+     */
+    class GainTransform : public Transform
+    {
+      public:
+        /// Highest supported gain, about +6 dB
+        static constexpr float maxGain_dB = 6.0f;
+
+        /**
+         * @param format - format of the processed data
+         * @param gain_dB - gain in dB, at most maxGain_dB
+         * @throws std::invalid_argument if the format or the gain is not supported
+         */
+        GainTransform(const audio::AudioFormat &format, float gain_dB);
+
+        static auto isSupported(const audio::AudioFormat &format) noexcept -> bool;
+
+        /**
+         * @param gain_dB - gain in dB, at most maxGain_dB
+         * @throws std::invalid_argument if the gain is not supported
+         */
+        void setGain(float gain_dB);
+
+        auto transform(const Span &inputSpan, const Span &transformSpace) const -> Span override;
+        auto validateInputFormat(const audio::AudioFormat &inputFormat) const noexcept -> bool override;
+        auto transformFormat(const audio::AudioFormat &inputFormat) const noexcept -> audio::AudioFormat override;
+        auto transformBlockSize(std::size_t blockSize) const noexcept -> std::size_t override;
+        auto transformBlockSizeInverted(std::size_t blockSize) const noexcept -> std::size_t override;
+
+        [[nodiscard]] auto getGain() const noexcept -> mix::Gain;
+
+      private:
+        static auto toGain(float gain_dB) -> mix::Gain;
+
+        audio::AudioFormat format;
+        std::atomic<mix::Gain> gain;
+        mutable mix::Gain appliedGain; ///< Gain at the end of the last processed block, touched only by transform
+    };
+} // namespace audio::transcode
@@ -4,6 +4,7 @@
 #include "MonoToStereo.hpp"
 
 #include <Audio/AudioFormat.hpp>
+#include <Audio/PcmKernels.hpp>
 
 using audio::transcode::MonoToStereo;
 
@@ -13,9 +14,7 @@ auto MonoToStereo::transform(const Span &span, const Span &transformSpace) const
     auto outputBuffer = reinterpret_cast<std::uint16_t *>(transformSpace.data);
     auto inputBuffer  = reinterpret_cast<std::uint16_t *>(span.data);
 
-    for (std::size_t i = span.dataSize / sizeof(std::uint16_t); i > 0; i--) {
-        outputBuffer[i * 2 - 1] = outputBuffer[i * 2 - 2] = inputBuffer[i - 1];
-    }
+    audio::pcm::monoToStereo(outputBuffer, inputBuffer, span.dataSize / sizeof(std::uint16_t));
 
     return outputSpan;
 }
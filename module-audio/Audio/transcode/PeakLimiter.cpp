@@ -0,0 +1,103 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "PeakLimiter.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+using audio::transcode::PeakLimiter;
+
+PeakLimiter::PeakLimiter(unsigned channels,
+                         std::int32_t threshold,
+                         std::size_t lookaheadFrames,
+                         std::size_t releaseFrames)
+    : channels(channels), threshold(threshold), lookahead(std::max(lookaheadFrames, std::size_t{1})),
+      releaseStep(std::max(static_cast<Gain>(unityGain / std::max(releaseFrames, std::size_t{1})), Gain{1})),
+      delayLine(std::make_unique<std::int32_t[]>(lookahead * channels)),
+      envelope(std::make_unique<Gain[]>(lookahead)), minimumValues(std::make_unique<Gain[]>(lookahead + 1)),
+      minimumFrames(std::make_unique<std::uint32_t[]>(lookahead + 1))
+{
+    reset();
+}
+
+void PeakLimiter::process(std::int32_t *samples, std::size_t frames) noexcept
+{
+    for (std::size_t i = 0; i < frames; ++i) {
+        const auto current = samples + i * channels;
+
+        // envelope never exceeds the minimum of the window, so their average is below the gain required by
+        // every sample leaving the delay line
+        envelopeLast = std::min(windowMinimum(requiredGain(current)), envelopeLast + releaseStep);
+        envelopeSum += envelopeLast - envelope[position];
+        envelope[position] = envelopeLast;
+        gain               = static_cast<Gain>(envelopeSum / static_cast<std::int64_t>(lookahead));
+
+        const auto delayed = delayLine.get() + position * channels;
+        for (unsigned channel = 0; channel < channels; ++channel) {
+            const auto sample = delayed[channel];
+            delayed[channel]  = current[channel];
+            current[channel]  = static_cast<std::int32_t>((static_cast<std::int64_t>(sample) * gain) >> gainShift);
+        }
+
+        position = (position + 1 == lookahead) ? 0 : position + 1;
+        ++frame;
+    }
+}
+
+void PeakLimiter::reset() noexcept
+{
+    std::fill_n(delayLine.get(), lookahead * channels, 0);
+    std::fill_n(envelope.get(), lookahead, unityGain);
+    envelopeSum  = static_cast<std::int64_t>(unityGain) * lookahead;
+    envelopeLast = unityGain;
+    gain         = unityGain;
+    position     = 0;
+    minimumFirst = 0;
+    minimumCount = 0;
+    frame        = 0;
+}
+
+auto PeakLimiter::getLatency() const noexcept -> std::size_t
+{
+    return lookahead;
+}
+
+auto PeakLimiter::getCurrentGain() const noexcept -> Gain
+{
+    return gain;
+}
+
+auto PeakLimiter::requiredGain(const std::int32_t *samples) const noexcept -> Gain
+{
+    std::int32_t peak = 0;
+    for (unsigned channel = 0; channel < channels; ++channel) {
+        peak = std::max(peak, std::abs(samples[channel]));
+    }
+    if (peak <= threshold) {
+        return unityGain;
+    }
+    return static_cast<Gain>((static_cast<std::int64_t>(threshold) << gainShift) / peak);
+}
+
+auto PeakLimiter::windowMinimum(Gain required) noexcept -> Gain
+{
+    const auto window = lookahead + 1;
+
+    if (minimumCount > 0 && frame - minimumFrames[minimumFirst] >= window) {
+        minimumFirst = (minimumFirst + 1) % window;
+        --minimumCount;
+    }
+
+    // values not lower than the new one will never be the minimum again
+    while (minimumCount > 0 && minimumValues[(minimumFirst + minimumCount - 1) % window] >= required) {
+        --minimumCount;
+    }
+
+    const auto last     = (minimumFirst + minimumCount) % window;
+    minimumValues[last] = required;
+    minimumFrames[last] = frame;
+    ++minimumCount;
+
+    return minimumValues[minimumFirst];
+}
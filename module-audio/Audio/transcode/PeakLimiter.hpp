@@ -0,0 +1,68 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace audio::transcode
+{
+    /**
+     * @brief Look-ahead peak limiter working on interleaved int32 samples.
+     *
+     * The signal is delayed by the look-ahead, so the gain reaches the level required by a peak before the peak
+     * leaves the limiter. The required gain is the minimum over the look-ahead window, smoothed with a moving average
+     * of the same length, which turns the attack into a ramp that never lets a sample exceed the threshold. The gain
+     * recovers linearly over the release time. Channels share the gain to keep the stereo image.
+     */
+    class PeakLimiter
+    {
+      public:
+        using Gain = std::int32_t; ///< Q15, unity is 1 << 15
+
+        /**
+         * @param channels - number of interleaved channels
+         * @param threshold - highest absolute sample value on output
+         * @param lookaheadFrames - delay of the signal, at least 1
+         * @param releaseFrames - time of the gain recovery from 0 to unity
+         */
+        PeakLimiter(unsigned channels, std::int32_t threshold, std::size_t lookaheadFrames, std::size_t releaseFrames);
+
+        /// Limits frames in-place, the output is late by the look-ahead
+        void process(std::int32_t *samples, std::size_t frames) noexcept;
+
+        /// Clears the delayed signal and restores the unity gain
+        void reset() noexcept;
+
+        [[nodiscard]] auto getLatency() const noexcept -> std::size_t;
+        [[nodiscard]] auto getCurrentGain() const noexcept -> Gain;
+
+      private:
+        static constexpr unsigned gainShift = 15;
+        static constexpr Gain unityGain     = Gain{1} << gainShift;
+
+        auto requiredGain(const std::int32_t *frame) const noexcept -> Gain;
+        auto windowMinimum(Gain gain) noexcept -> Gain;
+
+        unsigned channels;
+        std::int32_t threshold;
+        std::size_t lookahead;
+        Gain releaseStep;
+
+        std::unique_ptr<std::int32_t[]> delayLine; ///< lookahead frames
+        std::unique_ptr<Gain[]> envelope;          ///< last lookahead envelope values, summed to average them
+        std::size_t position = 0;
+        std::int64_t envelopeSum;
+        Gain envelopeLast;
+        Gain gain;
+
+        /// Monotonic queue of the required gains in the window of lookahead + 1 frames
+        std::unique_ptr<Gain[]> minimumValues;
+        std::unique_ptr<std::uint32_t[]> minimumFrames;
+        std::size_t minimumFirst = 0;
+        std::size_t minimumCount = 0;
+        std::uint32_t frame      = 0;
+    };
+} // namespace audio::transcode
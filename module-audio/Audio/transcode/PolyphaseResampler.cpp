@@ -0,0 +1,184 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "PolyphaseResampler.hpp"
+
+#include <Audio/AudioFormat.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+using audio::transcode::PolyphaseResampler;
+
+namespace audio::transcode::resampler
+{
+    namespace
+    {
+        template <unsigned InputRate, unsigned OutputRate>
+        constexpr auto filterOf() -> Filter
+        {
+            return Filter{Bank<InputRate, OutputRate>::coefficients.data(), Bank<InputRate, OutputRate>::taps};
+        }
+
+        template <unsigned InputRate>
+        auto findFilterFrom(unsigned outputRate) -> std::optional<Filter>
+        {
+            switch (outputRate) {
+            case 8000:
+                return InputRate == 8000 ? std::nullopt : std::optional{filterOf<InputRate, 8000>()};
+            case 16000:
+                return InputRate == 16000 ? std::nullopt : std::optional{filterOf<InputRate, 16000>()};
+            case 44100:
+                return InputRate == 44100 ? std::nullopt : std::optional{filterOf<InputRate, 44100>()};
+            case 48000:
+                return InputRate == 48000 ? std::nullopt : std::optional{filterOf<InputRate, 48000>()};
+            default:
+                return std::nullopt;
+            }
+        }
+
+        /// Dot product of the window with a row of the bank, in Q15
+        inline auto convolve(const std::int16_t *__restrict window,
+                             const std::int16_t *__restrict row,
+                             unsigned taps) noexcept -> std::int32_t
+        {
+            std::int32_t acc = 0;
+            for (unsigned j = 0; j < taps; ++j) {
+                acc += static_cast<std::int32_t>(window[j]) * row[j];
+            }
+            return acc;
+        }
+    } // namespace
+
+    auto findFilter(unsigned inputRate, unsigned outputRate) -> std::optional<Filter>
+    {
+        switch (inputRate) {
+        case 8000:
+            return findFilterFrom<8000>(outputRate);
+        case 16000:
+            return findFilterFrom<16000>(outputRate);
+        case 44100:
+            return findFilterFrom<44100>(outputRate);
+        case 48000:
+            return findFilterFrom<48000>(outputRate);
+        default:
+            return std::nullopt;
+        }
+    }
+} // namespace audio::transcode::resampler
+
+PolyphaseResampler::PolyphaseResampler(const audio::AudioFormat &inputFormat, unsigned outputRate)
+    : inputFormat(inputFormat), outputRate(outputRate), channels(inputFormat.getChannels())
+{
+    if (!isSupported(inputFormat, outputRate)) {
+        throw std::invalid_argument("Sample rate conversion is not supported");
+    }
+
+    filter = resampler::findFilter(inputFormat.getSampleRate(), outputRate).value();
+    reset();
+}
+
+auto PolyphaseResampler::isSupported(const audio::AudioFormat &inputFormat, unsigned outputRate) noexcept -> bool
+{
+    return inputFormat.getBitWidth() == 16 && (inputFormat.getChannels() == 1 || inputFormat.getChannels() == 2) &&
+           resampler::findFilter(inputFormat.getSampleRate(), outputRate).has_value();
+}
+
+void PolyphaseResampler::reset()
+{
+    for (unsigned channel = 0; channel < channels; ++channel) {
+        history[channel].assign(filter.taps - 1, 0);
+    }
+}
+
+auto PolyphaseResampler::transform(const Span &inputSpan, const Span &transformSpace) const -> Span
+{
+    const auto inputFrames = inputSpan.dataSize / frameSize();
+    // the block is stretched over the whole space, a stream block is neither overrun nor left with stale samples
+    // when its size does not come back from transformBlockSizeInverted()
+    const auto outputFrames = transformSpace.dataSize / frameSize();
+    const auto input        = reinterpret_cast<const std::int16_t *>(inputSpan.data);
+    auto output             = reinterpret_cast<std::int16_t *>(transformSpace.data);
+
+    if (inputFrames == 0 || outputFrames == 0) {
+        return Span{.data = transformSpace.data, .dataSize = 0};
+    }
+
+    const auto taps = filter.taps;
+
+    // deinterleave the whole block first so that the output may overwrite the input
+    for (unsigned channel = 0; channel < channels; ++channel) {
+        auto &channelHistory = history[channel];
+        channelHistory.resize(taps - 1 + inputFrames);
+        for (std::size_t i = 0; i < inputFrames; ++i) {
+            channelHistory[taps - 1 + i] = input[i * channels + channel];
+        }
+    }
+
+    // output frame k is taken at the input position k * inputFrames / outputFrames
+    std::size_t position  = 0;
+    std::size_t remainder = 0;
+    const auto wholeStep  = inputFrames / outputFrames;
+    const auto restStep   = inputFrames % outputFrames;
+    for (std::size_t k = 0; k < outputFrames; ++k) {
+        const auto phase =
+            static_cast<std::uint64_t>(remainder) * (resampler::phases << resampler::coeffShift) / outputFrames;
+        const auto row      = filter.coefficients + (phase >> resampler::coeffShift) * taps;
+        const auto fraction = static_cast<std::int64_t>(phase & ((1U << resampler::coeffShift) - 1));
+
+        for (unsigned channel = 0; channel < channels; ++channel) {
+            const auto window = history[channel].data() + position;
+            const auto lower  = resampler::convolve(window, row, taps);
+            const auto upper  = resampler::convolve(window, row + taps, taps);
+            const auto mixed  = lower + (((upper - lower) * fraction) >> resampler::coeffShift);
+            const auto value  = std::clamp<std::int64_t>(mixed >> resampler::coeffShift, INT16_MIN, INT16_MAX);
+            output[k * channels + channel] = static_cast<std::int16_t>(value);
+        }
+
+        position += wholeStep;
+        remainder += restStep;
+        if (remainder >= outputFrames) {
+            remainder -= outputFrames;
+            ++position;
+        }
+    }
+
+    // keep the tail for the next block
+    for (unsigned channel = 0; channel < channels; ++channel) {
+        auto &channelHistory = history[channel];
+        std::copy(channelHistory.end() - (taps - 1), channelHistory.end(), channelHistory.begin());
+    }
+
+    return Span{.data = transformSpace.data, .dataSize = outputFrames * frameSize()};
+}
+
+auto PolyphaseResampler::validateInputFormat(const audio::AudioFormat &format) const noexcept -> bool
+{
+    return format == inputFormat;
+}
+
+auto PolyphaseResampler::transformFormat(const audio::AudioFormat &format) const noexcept -> audio::AudioFormat
+{
+    return audio::AudioFormat{outputRate, format.getBitWidth(), format.getChannels()};
+}
+
+auto PolyphaseResampler::transformBlockSize(std::size_t blockSize) const noexcept -> std::size_t
+{
+    return convertFrames(blockSize / frameSize(), inputFormat.getSampleRate(), outputRate) * frameSize();
+}
+
+auto PolyphaseResampler::transformBlockSizeInverted(std::size_t blockSize) const noexcept -> std::size_t
+{
+    return convertFrames(blockSize / frameSize(), outputRate, inputFormat.getSampleRate()) * frameSize();
+}
+
+auto PolyphaseResampler::convertFrames(std::size_t frames, unsigned fromRate, unsigned toRate) const noexcept
+    -> std::size_t
+{
+    return (static_cast<std::uint64_t>(frames) * toRate + fromRate / 2) / fromRate;
+}
+
+auto PolyphaseResampler::frameSize() const noexcept -> std::size_t
+{
+    return channels * sizeof(std::int16_t);
+}
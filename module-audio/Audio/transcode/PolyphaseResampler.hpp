@@ -0,0 +1,62 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include "ResamplerFilters.hpp"
+#include "Transform.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace audio::transcode
+{
+    /**
+     * @brief Sample rate conversion between any two of 8, 16, 44.1 and 48 kHz for 16-bit mono or stereo PCM.
+     *
+     * Every output sample is a dot product of the input window with a row of a polyphase low-pass filter bank,
+     * coefficients of fractional positions between two rows are interpolated linearly. Arithmetic is fixed point
+     * with Q15 coefficients. The resampler keeps the tail of the previous block, so consecutive blocks of a stream
+     * are filtered seamlessly, and it can work in-place.
+     *
+     * A block is stretched over the whole transform space, which is normally a block of the sink stream. Its input
+     * block of transformBlockSizeInverted() frames is round(N * inputRate / outputRate) for N output frames, the
+     * conversion is exact when N is a multiple of outputRate / gcd(inputRate, outputRate), e.g. any block for
+     * 8 -> 16 kHz, otherwise the rate differs by less than half an input frame per block.
+     */
+    class PolyphaseResampler : public Transform
+    {
+      public:
+        /**
+         * @brief Construct a new Polyphase Resampler object
+         *
+         * @param inputFormat - format of the data to convert
+         * @param outputRate - sample rate of the output
+         * @throws std::invalid_argument if the conversion is not supported
+         */
+        PolyphaseResampler(const audio::AudioFormat &inputFormat, unsigned outputRate);
+
+        static auto isSupported(const audio::AudioFormat &inputFormat, unsigned outputRate) noexcept -> bool;
+
+        auto transform(const Span &inputSpan, const Span &transformSpace) const -> Span override;
+        auto validateInputFormat(const audio::AudioFormat &inputFormat) const noexcept -> bool override;
+        auto transformFormat(const audio::AudioFormat &inputFormat) const noexcept -> audio::AudioFormat override;
+        auto transformBlockSize(std::size_t blockSize) const noexcept -> std::size_t override;
+        auto transformBlockSizeInverted(std::size_t blockSize) const noexcept -> std::size_t override;
+
+        /// Discards the history of the previous blocks
+        void reset();
+
+      private:
+        auto convertFrames(std::size_t frames, unsigned fromRate, unsigned toRate) const noexcept -> std::size_t;
+        auto frameSize() const noexcept -> std::size_t;
+
+        audio::AudioFormat inputFormat;
+        unsigned outputRate;
+        unsigned channels;
+        resampler::Filter filter;
+        /// per channel: taps - 1 frames of the previous blocks followed by the current block
+        mutable std::vector<std::int16_t> history[2];
+    };
+
+} // namespace audio::transcode
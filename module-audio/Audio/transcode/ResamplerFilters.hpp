@@ -0,0 +1,147 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+/**
+ * @brief Low-pass filter banks of the polyphase resampler generated at compile time.
+ *
+ * Each bank is a Kaiser windowed sinc sampled at phases + 1 fractional delays, so that the coefficients of any
+ * fractional position can be interpolated between two neighbouring rows. Rows are normalized to unity DC gain and
+ * stored as Q15. The cutoff is placed below the lower of the two Nyquist frequencies, when downsampling the filter
+ * is stretched so that its transition band stays the same in the output domain.
+ */
+namespace audio::transcode::resampler
+{
+    inline constexpr unsigned phases     = 32;
+    inline constexpr unsigned baseTaps   = 32;
+    inline constexpr unsigned coeffShift = 15;
+
+    /// Cutoff relative to the lower Nyquist frequency, the transition band ends right at it
+    inline constexpr double cutoff = 0.88;
+    inline constexpr double beta   = 6.0;
+
+    namespace math
+    {
+        inline constexpr double pi = 3.14159265358979323846;
+
+        constexpr auto abs(double x) -> double
+        {
+            return x < 0 ? -x : x;
+        }
+
+        constexpr auto sin(double x) -> double
+        {
+            // reduce to [-pi, pi] and sum the Taylor series
+            const auto turns = static_cast<long long>(x / (2 * pi) + (x < 0 ? -0.5 : 0.5));
+            x -= static_cast<double>(turns) * 2 * pi;
+            double term = x;
+            double sum  = x;
+            for (int n = 1; n < 16; ++n) {
+                term *= -x * x / ((2 * n) * (2 * n + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        constexpr auto sqrt(double x) -> double
+        {
+            if (x <= 0) {
+                return 0;
+            }
+            double root = x < 1 ? 1 : x;
+            for (int i = 0; i < 64; ++i) {
+                root = (root + x / root) / 2;
+            }
+            return root;
+        }
+
+        /// Zeroth order modified Bessel function of the first kind
+        constexpr auto besselI0(double x) -> double
+        {
+            double term = 1;
+            double sum  = 1;
+            for (int k = 1; k < 32; ++k) {
+                term *= (x / (2 * k)) * (x / (2 * k));
+                sum += term;
+            }
+            return sum;
+        }
+
+        constexpr auto sinc(double x) -> double
+        {
+            return abs(x) < 1e-12 ? 1.0 : sin(pi * x) / (pi * x);
+        }
+    } // namespace math
+
+    /// Number of taps for the rates given, a multiple of 4 to keep the dot products vectorizable
+    constexpr auto tapsFor(unsigned inputRate, unsigned outputRate) -> unsigned
+    {
+        const auto taps = inputRate > outputRate ? (baseTaps * inputRate + outputRate - 1) / outputRate : baseTaps;
+        return (taps + 3) / 4 * 4;
+    }
+
+    /**
+     * @brief Filter bank row-major by phase: row p holds coefficients for the fractional position p / phases,
+     * coefficient j of a row is applied to the j-th oldest sample of the filter window.
+     */
+    template <unsigned Taps>
+    constexpr auto makeBank(double relativeCutoff) -> std::array<std::int16_t, (phases + 1) * Taps>
+    {
+        std::array<std::int16_t, (phases + 1) * Taps> bank{};
+        constexpr double halfLength = Taps / 2.0;
+        const double windowNorm     = math::besselI0(beta);
+
+        for (unsigned p = 0; p <= phases; ++p) {
+            std::array<double, Taps> row{};
+            double sum = 0;
+            for (unsigned j = 0; j < Taps; ++j) {
+                // distance between the sample and the interpolated position, in input samples
+                const double t     = static_cast<double>(Taps / 2) - 1.0 - j + static_cast<double>(p) / phases;
+                const double ratio = t / halfLength;
+                const double window =
+                    math::abs(ratio) >= 1 ? 0 : math::besselI0(beta * math::sqrt(1 - ratio * ratio)) / windowNorm;
+                row[j] = relativeCutoff * math::sinc(relativeCutoff * t) * window;
+                sum += row[j];
+            }
+
+            // quantize so that the row sums to unity exactly, the error goes to the largest coefficient
+            std::int32_t quantizedSum = 0;
+            unsigned largest          = 0;
+            for (unsigned j = 0; j < Taps; ++j) {
+                const double scaled = row[j] / sum * (1 << coeffShift);
+                const auto value    = static_cast<std::int32_t>(scaled + (scaled < 0 ? -0.5 : 0.5));
+                bank[p * Taps + j]  = static_cast<std::int16_t>(value);
+                quantizedSum += value;
+                if (math::abs(row[j]) > math::abs(row[largest])) {
+                    largest = j;
+                }
+            }
+            bank[p * Taps + largest] =
+                static_cast<std::int16_t>(bank[p * Taps + largest] + ((1 << coeffShift) - quantizedSum));
+        }
+        return bank;
+    }
+
+    template <unsigned InputRate, unsigned OutputRate>
+    struct Bank
+    {
+        static constexpr unsigned taps = tapsFor(InputRate, OutputRate);
+        static constexpr auto coefficients =
+            makeBank<taps>(InputRate > OutputRate ? cutoff * OutputRate / InputRate : cutoff);
+    };
+
+    /// View of a bank selected at runtime
+    struct Filter
+    {
+        const std::int16_t *coefficients;
+        unsigned taps;
+    };
+
+    /// Bank for the pair of rates, nullopt if the conversion is not supported
+    auto findFilter(unsigned inputRate, unsigned outputRate) -> std::optional<Filter>;
+} // namespace audio::transcode::resampler
@@ -20,8 +20,13 @@ auto TransformComposite::transform(const Span &input, const Span &conversionSpac
 {
     auto output = input;
 
-    for (auto t : children) {
-        output = t->transform(output, conversionSpace);
+    for (std::size_t i = 0; i < children.size(); i++) {
+        // each transform gets the part of the space which the following ones turn into the whole of it
+        auto space = conversionSpace;
+        for (auto j = children.size() - 1; j > i; j--) {
+            space.dataSize = children[j]->transformBlockSizeInverted(space.dataSize);
+        }
+        output = children[i]->transform(output, space);
     }
     return output;
 }
@@ -66,8 +71,8 @@ auto TransformComposite::transformBlockSizeInverted(std::size_t blockSize) const
 {
     std::size_t transformedBlockSize = blockSize;
 
-    for (auto t : children) {
-        transformedBlockSize = t->transformBlockSizeInverted(transformedBlockSize);
+    for (auto t = children.rbegin(); t != children.rend(); t++) {
+        transformedBlockSize = (*t)->transformBlockSizeInverted(transformedBlockSize);
     }
 
     return transformedBlockSize;
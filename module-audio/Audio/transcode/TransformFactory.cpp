@@ -9,6 +9,7 @@
 #include "BasicInterpolator.hpp"
 #include "MonoToStereo.hpp"
 #include "NullTransform.hpp"
+#include "PolyphaseResampler.hpp"
 #include "Transform.hpp"
 #include "TransformComposite.hpp"
 
@@ -63,6 +64,12 @@ auto TransformFactory::getSamplerateTransform(AudioFormat sourceFormat, AudioFor
     static constexpr auto supportedBitWidth                 = 16U;
     static constexpr auto supportedChannelCount             = 1U;
 
+    // channels are converted after the sample rate, so the resampler works on the source channels
+    if (PolyphaseResampler::isSupported(sourceFormat, sinkFormat.getSampleRate())) {
+        return std::make_unique<audio::transcode::PolyphaseResampler>(sourceFormat, sinkFormat.getSampleRate());
+    }
+
+    // the resampler has no filters for the other rates, e.g. 32 kHz
     auto sourceRate = sourceFormat.getSampleRate();
     auto sinkRate   = sinkFormat.getSampleRate();
 
@@ -3,7 +3,9 @@
 
 #include "LinuxAudioDevice.hpp"
 #include <Audio/Stream.hpp>
+#include <Audio/StreamTelemetry.hpp>
 #include <log/log.hpp>
+#include <purefs/filesystem_paths.hpp>
 #include <cmath>
 #include <stdexcept>
 
@@ -121,6 +123,9 @@ namespace audio
     {
         get_context().close_stream();
         currentFormat = {};
+
+        // the simulator keeps the stream reports next to the logs, refreshed after every playback or call
+        audio::telemetry::exportCsv(purefs::dir::getLogsPath() / "audio_streams.csv");
     }
     void LinuxAudioDevice::scaleVolume(audio::AbstractStream::Span data)
     {
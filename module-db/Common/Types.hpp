@@ -7,6 +7,10 @@
 #define u32_ "%" PRIu32
 /// 32-bit unsigned integer with comma, for instance: 323,
 #define u32_c "%" PRIu32 ","
+/// 32-bit signed integer
+#define i32_ "%" PRId32
+/// 32-bit signed integer with comma, for instance: -323,
+#define i32_c "%" PRId32 ","
 /// Zero terminated string with single-quotes on both ends, for instance: 'my string'
 #define str_ "%Q"
 /// The same as above with additional comma at the end, for instance: 'my string',
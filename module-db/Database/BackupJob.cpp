@@ -0,0 +1,157 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "BackupJob.hpp"
+#include "Database.hpp"
+
+#include <log/log.hpp>
+
+namespace db
+{
+    BackupJob::BackupJob(Database &database, std::filesystem::path destination)
+        : database{database}, destination{std::move(destination)}
+    {}
+
+    BackupJob::~BackupJob()
+    {
+        cancel();
+    }
+
+    BackupJob::Status BackupJob::step(int pages)
+    {
+        if (isFinished()) {
+            return status;
+        }
+        if (sqlite3_get_autocommit(database.dbConnection) == 0) {
+            if (++transactionWaits < maxTransactionWaits) {
+                LOG_DEBUG("Backup of %s waits for an open transaction", database.getName().c_str());
+                return status;
+            }
+            if (!commitOpenTransaction()) {
+                finish(Status::Failed);
+                return status;
+            }
+        }
+        transactionWaits = 0;
+        if (status == Status::Pending && !start()) {
+            finish(Status::Failed);
+            return status;
+        }
+
+        const auto rc  = sqlite3_backup_step(backup, pages);
+        pageCount      = sqlite3_backup_pagecount(backup);
+        remainingPages = sqlite3_backup_remaining(backup);
+        switch (rc) {
+        case SQLITE_DONE:
+            finish(Status::Done);
+            break;
+        case SQLITE_OK:
+        case SQLITE_BUSY:
+        case SQLITE_LOCKED:
+            break;
+        default:
+            LOG_ERROR("Backup of %s failed, rc=%d", database.getName().c_str(), rc);
+            finish(Status::Failed);
+            break;
+        }
+        return status;
+    }
+
+    void BackupJob::cancel()
+    {
+        if (!isFinished()) {
+            LOG_INFO("Backup of %s cancelled at %u%%", database.getName().c_str(), getProgress());
+            finish(Status::Cancelled);
+        }
+    }
+
+    BackupJob::Status BackupJob::getStatus() const noexcept
+    {
+        return status;
+    }
+
+    bool BackupJob::isFinished() const noexcept
+    {
+        return status == Status::Done || status == Status::Failed || status == Status::Cancelled;
+    }
+
+    unsigned BackupJob::getProgress() const noexcept
+    {
+        if (status == Status::Done) {
+            return 100;
+        }
+        if (pageCount == 0) {
+            return 0;
+        }
+        return static_cast<unsigned>((pageCount - remainingPages) * 100 / pageCount);
+    }
+
+    const Database &BackupJob::getDatabase() const noexcept
+    {
+        return database;
+    }
+
+    const std::filesystem::path &BackupJob::getDestination() const noexcept
+    {
+        return destination;
+    }
+
+    bool BackupJob::start()
+    {
+        std::error_code errorCode;
+        std::filesystem::remove(destination, errorCode);
+
+        if (const auto rc = sqlite3_open_v2(
+                destination.c_str(), &destinationConnection, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr);
+            rc != SQLITE_OK) {
+            LOG_ERROR("Failed to create backup file %s, rc=%d", destination.c_str(), rc);
+            return false;
+        }
+        backup = sqlite3_backup_init(destinationConnection, "main", database.dbConnection, "main");
+        if (backup == nullptr) {
+            LOG_ERROR("Failed to start backup of %s: %s",
+                      database.getName().c_str(),
+                      sqlite3_errmsg(destinationConnection));
+            return false;
+        }
+        status = Status::InProgress;
+        LOG_INFO("Backup of %s into %s started", database.getName().c_str(), destination.c_str());
+        return true;
+    }
+
+    bool BackupJob::commitOpenTransaction()
+    {
+        LOG_WARN("Transaction on %s is open for %d backup steps, committing it",
+                 database.getName().c_str(),
+                 transactionWaits);
+        if (!database.execute("COMMIT;")) {
+            LOG_ERROR("Failed to commit the open transaction of %s, autocommit: %d",
+                      database.getName().c_str(),
+                      sqlite3_get_autocommit(database.dbConnection));
+            return false;
+        }
+        return true;
+    }
+
+    void BackupJob::finish(Status result)
+    {
+        const auto isStarted = destinationConnection != nullptr;
+        status               = result;
+        if (backup != nullptr) {
+            sqlite3_backup_finish(backup);
+            backup = nullptr;
+        }
+        if (destinationConnection != nullptr) {
+            sqlite3_close(destinationConnection);
+            destinationConnection = nullptr;
+        }
+        if (result == Status::Done) {
+            LOG_INFO("Backup of %s finished, %d pages", database.getName().c_str(), pageCount);
+            return;
+        }
+        if (isStarted) {
+            std::error_code errorCode;
+            std::filesystem::remove(destination, errorCode);
+        }
+    }
+} // namespace db
@@ -0,0 +1,67 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <filesystem>
+
+class Database;
+struct sqlite3;
+struct sqlite3_backup;
+
+namespace db
+{
+    /// Online copy of a database into a file, done a bounded number of pages per step with the sqlite3 backup API.
+    /// The database stays usable between steps - changes made through it are carried over to the copy, so the job
+    /// can be resumed at any point until it's done.
+    class BackupJob
+    {
+      public:
+        enum class Status
+        {
+            Pending,
+            InProgress,
+            Done,
+            Failed,
+            Cancelled
+        };
+
+        static constexpr auto defaultPagesPerStep = 32;
+        /// Steps skipped for an open transaction before it is taken as left open and committed
+        static constexpr auto maxTransactionWaits = 250;
+
+        BackupJob(Database &database, std::filesystem::path destination);
+        ~BackupJob();
+
+        BackupJob(const BackupJob &) = delete;
+        BackupJob &operator=(const BackupJob &) = delete;
+
+        /// Copies up to the given number of pages. The step is skipped while a transaction is open on the database,
+        /// so that the copy never contains uncommitted data. A transaction still open after maxTransactionWaits steps
+        /// is committed, as the blocking copy did before, and the job fails if that is not possible.
+        Status step(int pages = defaultPagesPerStep);
+        /// Stops the job and removes the incomplete copy
+        void cancel();
+
+        [[nodiscard]] Status getStatus() const noexcept;
+        [[nodiscard]] bool isFinished() const noexcept;
+        /// Progress in percent
+        [[nodiscard]] unsigned getProgress() const noexcept;
+        [[nodiscard]] const Database &getDatabase() const noexcept;
+        [[nodiscard]] const std::filesystem::path &getDestination() const noexcept;
+
+      private:
+        bool start();
+        bool commitOpenTransaction();
+        void finish(Status result);
+
+        Database &database;
+        std::filesystem::path destination;
+        sqlite3 *destinationConnection = nullptr;
+        sqlite3_backup *backup         = nullptr;
+        int pageCount                  = 0;
+        int remainingPages             = 0;
+        int transactionWaits           = 0;
+        Status status                  = Status::Pending;
+    };
+} // namespace db
@@ -2,14 +2,13 @@
 // For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
 
 #include "Database.hpp"
+#include "IntegrityCheck.hpp"
+#include "sqlite3vfs.hpp"
 
 #include <log/log.hpp>
 #include <gsl/util>
 #include <cstring>
 
-/* Declarations *********************/
-extern sqlite3_vfs *sqlite3_ecophonevfs(void);
-
 [[nodiscard]] static bool isNotPragmaRelated(const char *msg)
 {
     return nullptr == strstr(msg, "PRAGMA");
@@ -68,6 +67,21 @@ extern "C"
 constexpr auto dbApplicationId = 0x65727550; // ASCII for "Pure"
 constexpr auto enabled         = 1;
 
+namespace
+{
+    auto startupIntegrityCheck = Database::IntegrityCheck::Full;
+    auto journalMode           = Database::JournalMode::Delete;
+
+    // Upper bound of the write-ahead log between idle checkpoints, the log index kept in heap memory grows with it
+    constexpr auto walCheckpointFrames = 256;
+
+    // Integrity checks return a single "ok" row on success and a list of found problems otherwise
+    [[nodiscard]] bool isIntegrityCheckPassed(const std::unique_ptr<QueryResult> &results)
+    {
+        return results && results->getRowCount() == 1 && (*results)[0].getString() == "ok";
+    }
+} // namespace
+
 Database::Database(const char *name, bool readOnly)
     : dbConnection(nullptr), dbName(name), queryStatementBuffer{nullptr}, isInitialized_(false)
 {
@@ -79,8 +93,12 @@ Database::Database(const char *name, bool readOnly)
     }
     sqlite3_extended_result_codes(dbConnection, enabled);
     initQueryStatementBuffer();
-    pragmaQuery("PRAGMA integrity_check;");
+    // The VFS has no shared memory, the exclusive locking mode has to be set before a database in WAL mode is read
     pragmaQuery("PRAGMA locking_mode=EXCLUSIVE");
+    runStartupIntegrityCheck();
+    if (!readOnly) {
+        applyJournalMode();
+    }
 
     if (isInitialized_ = pragmaQueryForValue("PRAGMA application_id;", dbApplicationId); not isInitialized_) {
         populateDbAppId();
@@ -96,6 +114,117 @@ void Database::populateDbAppId()
     pragmaQuery(setAppIdPragma.str());
 }
 
+void Database::runStartupIntegrityCheck()
+{
+    auto mode = startupIntegrityCheck;
+    if (mode == IntegrityCheck::Auto) {
+        const auto state = db::IntegrityCheckState::load(dbName);
+        mode             = state.isCheckNeeded(std::time(nullptr)) ? IntegrityCheck::Quick : IntegrityCheck::None;
+    }
+    if (mode == IntegrityCheck::None) {
+        return;
+    }
+    if (!checkIntegrity(mode)) {
+        LOG_ERROR("Database %s failed the integrity check", dbName.c_str());
+        db::IntegrityCheckState{db::IntegrityCheckState::Result::Failed, std::time(nullptr)}.store(dbName);
+    }
+}
+
+void Database::setStartupIntegrityCheck(IntegrityCheck mode) noexcept
+{
+    startupIntegrityCheck = mode;
+}
+
+void Database::setJournalMode(JournalMode mode) noexcept
+{
+    journalMode = mode;
+}
+
+void Database::applyJournalMode()
+{
+    if (journalMode == JournalMode::Delete) {
+        pragmaQuery("PRAGMA journal_mode=DELETE;");
+        return;
+    }
+
+    const auto results = query("PRAGMA journal_mode=WAL;");
+    walEnabled         = results && results->getRowCount() == 1 && (*results)[0].getString() == "wal";
+    if (!walEnabled) {
+        LOG_ERROR("Failed to enable WAL journal for database %s", dbName.c_str());
+        return;
+    }
+    // Replaces the built-in autocheckpoint, which copies the log to the database after each commit
+    sqlite3_wal_hook(dbConnection, walHook, this);
+}
+
+int Database::walHook(void *usrPtr, sqlite3 *connection, const char *schemaName, int walFrames)
+{
+    auto self              = static_cast<Database *>(usrPtr);
+    self->pendingWalFrames = walFrames;
+    if (self->pendingWalFrames >= walCheckpointFrames) {
+        self->checkpoint();
+    }
+    if (self->walCommitCallback) {
+        self->walCommitCallback(self->pendingWalFrames);
+    }
+    return SQLITE_OK;
+}
+
+bool Database::checkpoint()
+{
+    if (!walEnabled || pendingWalFrames == 0) {
+        return true;
+    }
+    int walFrames{};
+    int checkpointedFrames{};
+    if (const auto rc = sqlite3_wal_checkpoint_v2(
+            dbConnection, nullptr, SQLITE_CHECKPOINT_PASSIVE, &walFrames, &checkpointedFrames);
+        rc != SQLITE_OK) {
+        LOG_ERROR("Checkpoint of database %s failed, rc=%d", dbName.c_str(), rc);
+        return false;
+    }
+    pendingWalFrames = walFrames - checkpointedFrames;
+    return true;
+}
+
+void Database::setWalCommitCallback(WalCommitCallback callback)
+{
+    walCommitCallback = std::move(callback);
+}
+
+bool Database::checkIntegrity(IntegrityCheck mode)
+{
+    switch (mode) {
+    case IntegrityCheck::None:
+        return true;
+    case IntegrityCheck::Quick:
+        return isIntegrityCheckPassed(query("PRAGMA quick_check;"));
+    case IntegrityCheck::Full:
+    case IntegrityCheck::Auto:
+        break;
+    }
+    return isIntegrityCheckPassed(query("PRAGMA integrity_check;"));
+}
+
+bool Database::checkTableIntegrity(const std::string &tableName)
+{
+    return isIntegrityCheckPassed(query("PRAGMA integrity_check('%q');", tableName.c_str()));
+}
+
+std::vector<std::string> Database::getTableNames()
+{
+    std::vector<std::string> tableNames;
+    const auto results =
+        query("SELECT name FROM sqlite_master WHERE type='table' AND sql NOT LIKE 'CREATE VIRTUAL%%';");
+    if (!results || results->getRowCount() == 0) {
+        return tableNames;
+    }
+    do {
+        tableNames.push_back((*results)[0].getString());
+    } while (results->nextRow());
+    return tableNames;
+}
+
 void Database::initQueryStatementBuffer()
 {
     queryStatementBuffer = static_cast<char *>(sqlite3_malloc(maxQueryLen));
@@ -241,26 +370,3 @@ void Database::pragmaQuery(const std::string &pragmaStatement)
         LOG_DEBUG("No results!");
     }
 }
-
-bool Database::storeIntoFile(const std::filesystem::path &syncPath)
-{
-    // kind of workaround-fix for creating the sync package - if somehow DB can't be properly
-    // vacuumed into file, the transaction is still outgoing (probably nested transaction)
-    // that's why we need to commit it manually
-    if (sqlite3_get_autocommit(dbConnection) == 0) {
-        if (const auto rc = execute("COMMIT;"); !rc) {
-            LOG_ERROR("Failed to execute commit; sqlite3 autocommit after commit: %d",
-                      sqlite3_get_autocommit(dbConnection));
-            return false;
-        }
-        LOG_INFO("SQLITE3 autocommit after commit: %d", sqlite3_get_autocommit(dbConnection));
-    }
-
-    LOG_INFO("Store database: %s, into file: %s - STARTED", dbName.c_str(), syncPath.c_str());
-    if (const auto rc = execute("VACUUM main INTO '%q';", syncPath.c_str()); !rc) {
-        LOG_ERROR("Store database: %s, into file: %s - FAILED", dbName.c_str(), syncPath.c_str());
-        return false;
-    }
-    LOG_INFO("Store database: %s, into file: %s - SUCCEEDED", dbName.c_str(), syncPath.c_str());
-    return true;
-}
@@ -6,9 +6,17 @@
 #include "sqlite3.h"
 #include "QueryResult.hpp"
 
+#include <functional>
 #include <memory>
 #include <stdexcept>
 #include <filesystem>
+#include <string>
+#include <vector>
+
+namespace db
+{
+    class BackupJob;
+} // namespace db
 
 class DatabaseInitialisationError : public std::runtime_error
 {
@@ -19,6 +27,23 @@ class DatabaseInitialisationError : public std::runtime_error
 class Database
 {
   public:
+    enum class IntegrityCheck
+    {
+        None,  ///< Don't check the database
+        Quick, ///< PRAGMA quick_check - skips verifying that indexes match the tables
+        Full,  ///< PRAGMA integrity_check - cost grows with the database size and its indexes
+        Auto   ///< Skip if the last full check passed recently, otherwise run a quick check
+    };
+
+    enum class JournalMode
+    {
+        Delete, ///< Rollback journal, each commit writes and syncs the journal and the database file
+        Wal     ///< Write-ahead log, commits append to the log which is copied to the database by checkpoints
+    };
+
+    /// Called after each transaction committed to the write-ahead log with the number of frames in the log
+    using WalCommitCallback = std::function<void(std::size_t walFrames)>;
+
     explicit Database(const char *name, bool readOnly = false);
     virtual ~Database();
 
@@ -32,7 +57,30 @@ class Database
     // Must be invoked before closing system in order to properly close OS layer
     static bool deinitialize();
 
-    bool storeIntoFile(const std::filesystem::path &syncPath);
+    // Kind of integrity check run by databases opened from now on
+    static void setStartupIntegrityCheck(IntegrityCheck mode) noexcept;
+
+    // Journal mode of writable databases opened from now on
+    static void setJournalMode(JournalMode mode) noexcept;
+
+    bool checkIntegrity(IntegrityCheck mode);
+    bool checkTableIntegrity(const std::string &tableName);
+    std::vector<std::string> getTableNames();
+
+    /// Copies the pages from the write-ahead log into the database file, no-op in rollback journal mode
+    bool checkpoint();
+    void setWalCommitCallback(WalCommitCallback callback);
+
+    [[nodiscard]] bool isWalEnabled() const noexcept
+    {
+        return walEnabled;
+    }
+
+    /// Number of frames in the write-ahead log that are not checkpointed yet
+    [[nodiscard]] std::size_t getPendingWalFrames() const noexcept
+    {
+        return pendingWalFrames;
+    }
 
     uint32_t getLastInsertRowId();
     void pragmaQuery(const std::string &pragmaStatement);
@@ -56,6 +104,12 @@ class Database
     void clearQueryStatementBuffer();
 
     void populateDbAppId();
+    void runStartupIntegrityCheck();
+    void applyJournalMode();
+
+    static int walHook(void *usrPtr, sqlite3 *connection, const char *schemaName, int walFrames);
+
+    friend class db::BackupJob;
 
     /*
      * Arguments:
@@ -72,4 +126,7 @@ class Database
     std::string dbName;
     char *queryStatementBuffer;
     bool isInitialized_;
+    bool walEnabled{false};
+    std::size_t pendingWalFrames{0};
+    WalCommitCallback walCommitCallback;
 };
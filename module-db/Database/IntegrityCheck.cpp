@@ -0,0 +1,374 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "IntegrityCheck.hpp"
+#include "Database.hpp"
+
+#include <log/log.hpp>
+
+#include <fstream>
+#include <limits>
+
+namespace db
+{
+    namespace
+    {
+        constexpr auto stateFileExtension = ".integrity";
+        constexpr auto passedTag          = "passed";
+        constexpr auto partialTag         = "partial";
+        constexpr auto failedTag          = "failed";
+
+        const char *toTag(IntegrityCheckState::Result result)
+        {
+            switch (result) {
+            case IntegrityCheckState::Result::Passed:
+                return passedTag;
+            case IntegrityCheckState::Result::Partial:
+                return partialTag;
+            default:
+                return failedTag;
+            }
+        }
+
+        std::string quoteIdentifier(const std::string &identifier)
+        {
+            std::string quoted{"\""};
+            for (const auto c : identifier) {
+                quoted += c;
+                if (c == '"') {
+                    quoted += c;
+                }
+            }
+            return quoted + "\"";
+        }
+    } // namespace
+
+    std::filesystem::path IntegrityCheckState::getStatePath(const std::filesystem::path &databasePath)
+    {
+        auto statePath = databasePath;
+        statePath += stateFileExtension;
+        return statePath;
+    }
+
+    IntegrityCheckState IntegrityCheckState::load(const std::filesystem::path &databasePath)
+    {
+        IntegrityCheckState state;
+        std::ifstream file{getStatePath(databasePath)};
+        if (!file.is_open()) {
+            return state;
+        }
+
+        std::string tag;
+        std::time_t checkedAt{};
+        if (!(file >> tag >> checkedAt)) {
+            return state;
+        }
+        if (tag == passedTag) {
+            state.result = Result::Passed;
+        }
+        else if (tag == partialTag) {
+            state.result = Result::Partial;
+        }
+        else if (tag == failedTag) {
+            state.result = Result::Failed;
+        }
+        state.checkedAt = checkedAt;
+        return state;
+    }
+
+    bool IntegrityCheckState::store(const std::filesystem::path &databasePath) const
+    {
+        std::ofstream file{getStatePath(databasePath), std::ios::trunc};
+        if (!file.is_open()) {
+            LOG_ERROR("Failed to store integrity check state of %s", databasePath.c_str());
+            return false;
+        }
+        file << toTag(result) << ' ' << checkedAt << '\n';
+        return file.good();
+    }
+
+    bool IntegrityCheckState::isCheckNeeded(std::time_t now) const noexcept
+    {
+        if ((result != Result::Passed && result != Result::Partial) || checkedAt == 0 || now < checkedAt) {
+            return true;
+        }
+        return std::chrono::seconds{now - checkedAt} > maxAge;
+    }
+
+    IntegrityCheckJob::IntegrityCheckJob(Database &database) : database{database}
+    {}
+
+    IntegrityCheckJob::Status IntegrityCheckJob::step(std::chrono::milliseconds budget)
+    {
+        if (isFinished()) {
+            return status;
+        }
+        if (status == Status::Pending) {
+            tables = database.getTableNames();
+            status = Status::InProgress;
+            LOG_INFO("Integrity check of %s started, %zu tables", database.getName().c_str(), tables.size());
+        }
+
+        const auto deadline = std::chrono::steady_clock::now() + budget;
+        while (checkedTables < tables.size()) {
+            if (!checkNextPart()) {
+                LOG_ERROR("Integrity check of %s failed on table %s",
+                          database.getName().c_str(),
+                          tables[checkedTables].c_str());
+                finish(Status::Failed);
+                return status;
+            }
+            if (std::chrono::steady_clock::now() >= deadline) {
+                break;
+            }
+        }
+        if (checkedTables == tables.size()) {
+            finish(Status::Passed);
+        }
+        return status;
+    }
+
+    bool IntegrityCheckJob::checkNextPart()
+    {
+        const auto &table = tables[checkedTables];
+        if (!largeTable.has_value()) {
+            largeTable = findLargeTable(table);
+            if (!largeTable.has_value()) {
+                if (!database.checkTableIntegrity(table)) {
+                    return false;
+                }
+                ++checkedTables;
+                return true;
+            }
+            LOG_DEBUG("Table %s of %s is checked in parts", table.c_str(), database.getName().c_str());
+            checkedInParts = true;
+        }
+
+        if (!largeTable->rowsRead) {
+            return checkRows(table, *largeTable);
+        }
+        if (!checkIndexSizes(table, *largeTable)) {
+            return false;
+        }
+        largeTable.reset();
+        ++checkedTables;
+        return true;
+    }
+
+    std::optional<IntegrityCheckJob::LargeTable> IntegrityCheckJob::findLargeTable(const std::string &table)
+    {
+        // tables without rowid are checked whole, as are the ones on which the queries fail
+        const auto rows =
+            database.query("SELECT count(*) FROM (SELECT 1 FROM \"%w\" LIMIT %d);", table.c_str(), largeTableRows + 1);
+        if (!rows || rows->getRowCount() == 0 || (*rows)[0].getInt32() <= largeTableRows) {
+            return std::nullopt;
+        }
+        const auto first = database.query("SELECT min(rowid) FROM \"%w\";", table.c_str());
+        if (!first || first->getRowCount() == 0 || (*first)[0].getString().empty()) {
+            return std::nullopt;
+        }
+
+        LargeTable large;
+        large.nextRow = (*first)[0].getInt64();
+        large.indexes = getIndexChecks(table);
+        return large;
+    }
+
+    std::vector<IntegrityCheckJob::IndexCheck> IntegrityCheckJob::getIndexChecks(const std::string &table)
+    {
+        std::vector<IndexCheck> checks;
+        std::vector<std::string> names;
+        if (const auto indexes = database.query("PRAGMA index_list('%q');", table.c_str());
+            indexes && indexes->getRowCount() > 0) {
+            do {
+                // partial indexes do not hold every row
+                if ((*indexes)[4].getInt32() == 0) {
+                    names.push_back((*indexes)[1].getString());
+                }
+            } while (indexes->nextRow());
+        }
+
+        for (const auto &name : names) {
+            const auto columns = database.query("PRAGMA index_info('%q');", name.c_str());
+            if (!columns || columns->getRowCount() == 0) {
+                continue;
+            }
+            std::string condition;
+            auto isPlain = true;
+            do {
+                const auto column = (*columns)[2].getString();
+                // indexes on expressions cannot be matched with the row
+                if (column.empty()) {
+                    isPlain = false;
+                    break;
+                }
+                const auto quoted = quoteIdentifier(column);
+                condition += quoted + " IS r." + quoted + " AND ";
+            } while (columns->nextRow());
+            if (!isPlain) {
+                LOG_WARN("Index %s of %s is checked by the sizes only", name.c_str(), database.getName().c_str());
+                continue;
+            }
+            condition += "rowid = r.rowid";
+
+            // an index which can't be used for the lookup, e.g. of another collation, fails already on an empty range
+            if (!database.query("SELECT 1 FROM \"%w\" AS r WHERE 0 AND EXISTS (SELECT 1 FROM \"%w\" INDEXED BY "
+                                "\"%w\" WHERE %s);",
+                                table.c_str(),
+                                table.c_str(),
+                                name.c_str(),
+                                condition.c_str())) {
+                LOG_WARN("Index %s of %s is checked by the sizes only", name.c_str(), database.getName().c_str());
+                continue;
+            }
+            checks.push_back(IndexCheck{name, std::move(condition)});
+        }
+        return checks;
+    }
+
+    bool IntegrityCheckJob::checkRows(const std::string &table, LargeTable &large)
+    {
+        const auto last = database.query(
+            "SELECT max(rowid) FROM (SELECT rowid FROM \"%w\" WHERE rowid >= %lld ORDER BY rowid LIMIT %d);",
+            table.c_str(),
+            static_cast<long long>(large.nextRow),
+            rowsPerStep);
+        if (!last || last->getRowCount() == 0) {
+            return false;
+        }
+        if ((*last)[0].getString().empty()) {
+            large.rowsRead = true;
+            return true;
+        }
+        const auto lastRow = (*last)[0].getInt64();
+
+        // reading the length of every column walks all pages of the rows, including the overflow ones
+        const auto columns = database.query("PRAGMA table_info('%q');", table.c_str());
+        if (!columns || columns->getRowCount() == 0) {
+            return false;
+        }
+        std::string lengths;
+        do {
+            lengths += "coalesce(length(" + quoteIdentifier((*columns)[1].getString()) + "), 0) + ";
+        } while (columns->nextRow());
+        lengths += "0";
+
+        const auto rows = database.query("SELECT count(*) FROM \"%w\" WHERE rowid BETWEEN %lld AND %lld AND %s >= 0;",
+                                         table.c_str(),
+                                         static_cast<long long>(large.nextRow),
+                                         static_cast<long long>(lastRow),
+                                         lengths.c_str());
+        if (!rows || rows->getRowCount() == 0) {
+            return false;
+        }
+        large.rows += (*rows)[0].getUInt64();
+
+        for (const auto &index : large.indexes) {
+            const auto missing = database.query("SELECT count(*) FROM \"%w\" AS r WHERE r.rowid BETWEEN %lld AND %lld "
+                                                "AND NOT EXISTS (SELECT 1 FROM \"%w\" INDEXED BY \"%w\" WHERE %s);",
+                                                table.c_str(),
+                                                static_cast<long long>(large.nextRow),
+                                                static_cast<long long>(lastRow),
+                                                table.c_str(),
+                                                index.name.c_str(),
+                                                index.condition.c_str());
+            if (!missing || missing->getRowCount() == 0 || (*missing)[0].getUInt64() != 0) {
+                LOG_ERROR("Rows of %s are missing in index %s", table.c_str(), index.name.c_str());
+                return false;
+            }
+        }
+
+        if (lastRow == std::numeric_limits<std::int64_t>::max()) {
+            large.rowsRead = true;
+        }
+        else {
+            large.nextRow = lastRow + 1;
+        }
+        return true;
+    }
+
+    bool IntegrityCheckJob::checkIndexSizes(const std::string &table, const LargeTable &large)
+    {
+        const auto indexes = database.query("PRAGMA index_list('%q');", table.c_str());
+        if (!indexes || indexes->getRowCount() == 0) {
+            return true;
+        }
+        do {
+            if ((*indexes)[4].getInt32() != 0) {
+                continue;
+            }
+            const auto &name = (*indexes)[1].getString();
+            const auto size  = database.query(
+                "SELECT count(*) FROM \"%w\" INDEXED BY \"%w\";", table.c_str(), name.c_str());
+            if (!size || size->getRowCount() == 0 || (*size)[0].getUInt64() != large.rows) {
+                LOG_ERROR("Index %s does not match the %llu rows of %s",
+                          name.c_str(),
+                          static_cast<unsigned long long>(large.rows),
+                          table.c_str());
+                return false;
+            }
+        } while (indexes->nextRow());
+        return true;
+    }
+
+    void IntegrityCheckJob::cancel()
+    {
+        if (!isFinished()) {
+            LOG_INFO("Integrity check of %s cancelled at %u%%", database.getName().c_str(), getProgress());
+            status = Status::Cancelled;
+        }
+    }
+
+    IntegrityCheckJob::Status IntegrityCheckJob::getStatus() const noexcept
+    {
+        return status;
+    }
+
+    bool IntegrityCheckJob::isFinished() const noexcept
+    {
+        return status == Status::Passed || status == Status::Failed || status == Status::Cancelled;
+    }
+
+    unsigned IntegrityCheckJob::getProgress() const noexcept
+    {
+        if (status == Status::Passed || status == Status::Failed) {
+            return 100;
+        }
+        if (tables.empty()) {
+            return 0;
+        }
+        return static_cast<unsigned>(checkedTables * 100 / tables.size());
+    }
+
+    const Database &IntegrityCheckJob::getDatabase() const noexcept
+    {
+        return database;
+    }
+
+    void IntegrityCheckJob::finish(Status result)
+    {
+        status = result;
+        LOG_INFO("Integrity check of %s %s%s",
+                 database.getName().c_str(),
+                 result == Status::Passed ? "passed" : "failed",
+                 result == Status::Passed && checkedInParts ? ", large tables checked in parts" : "");
+
+        IntegrityCheckState state;
+        state.checkedAt = std::time(nullptr);
+        if (result != Status::Passed) {
+            state.result = IntegrityCheckState::Result::Failed;
+        }
+        else if (!checkedInParts) {
+            state.result = IntegrityCheckState::Result::Passed;
+        }
+        else {
+            // the age of the last full check is kept, so that the startup check still runs when it is due
+            const auto previous     = IntegrityCheckState::load(database.getName());
+            const auto hasFullCheck = previous.result == IntegrityCheckState::Result::Passed ||
+                                      previous.result == IntegrityCheckState::Result::Partial;
+            state.result    = IntegrityCheckState::Result::Partial;
+            state.checkedAt = hasFullCheck ? previous.checkedAt : 0;
+        }
+        state.store(database.getName());
+    }
+} // namespace db
@@ -0,0 +1,109 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+class Database;
+
+namespace db
+{
+    /// Outcome of the last full integrity check, persisted next to the database file so that the next boot can
+    /// decide whether the database has to be checked again
+    struct IntegrityCheckState
+    {
+        enum class Result
+        {
+            Unknown,
+            Passed,
+            /// No errors found, but large tables were checked in parts instead of with PRAGMA integrity_check
+            Partial,
+            Failed
+        };
+
+        static constexpr auto maxAge = std::chrono::hours{24 * 7};
+
+        Result result = Result::Unknown;
+        /// Time of the check, for Partial the time of the last full check which passed, 0 if there was none
+        std::time_t checkedAt = 0;
+
+        [[nodiscard]] static IntegrityCheckState load(const std::filesystem::path &databasePath);
+        [[nodiscard]] static std::filesystem::path getStatePath(const std::filesystem::path &databasePath);
+        bool store(const std::filesystem::path &databasePath) const;
+
+        /// True when the database hasn't passed a full check recently, a partial check does not count
+        [[nodiscard]] bool isCheckNeeded(std::time_t now) const noexcept;
+    };
+
+    /// Full integrity check split into steps, so that it can be run in the background within a time budget and
+    /// cancelled at any point. Small tables are checked whole with PRAGMA integrity_check. Tables of more than
+    /// largeTableRows rows are checked rowsPerStep rows at a time instead: every column of the rows is read, so that
+    /// damaged pages are reported, and each row is looked up in every index of the table. Once all rows are read,
+    /// each index has to hold exactly one entry per row. Such a check is weaker than PRAGMA integrity_check, so it
+    /// is stored as a partial result, which does not postpone the startup check.
+    class IntegrityCheckJob
+    {
+      public:
+        enum class Status
+        {
+            Pending,
+            InProgress,
+            Passed,
+            Failed,
+            Cancelled
+        };
+
+        static constexpr auto largeTableRows = 1000;
+        static constexpr auto rowsPerStep    = 250;
+
+        explicit IntegrityCheckJob(Database &database);
+
+        /// Checks consecutive tables or parts of a large table until the budget is used up - at least one table or
+        /// part is checked per step
+        Status step(std::chrono::milliseconds budget);
+        void cancel();
+
+        [[nodiscard]] Status getStatus() const noexcept;
+        [[nodiscard]] bool isFinished() const noexcept;
+        /// Progress in percent
+        [[nodiscard]] unsigned getProgress() const noexcept;
+        [[nodiscard]] const Database &getDatabase() const noexcept;
+
+      private:
+        struct IndexCheck
+        {
+            std::string name;
+            /// Matches the index entry of the row aliased as r
+            std::string condition;
+        };
+
+        struct LargeTable
+        {
+            std::int64_t nextRow = 0;
+            std::uint64_t rows   = 0;
+            bool rowsRead        = false;
+            std::vector<IndexCheck> indexes;
+        };
+
+        bool checkNextPart();
+        [[nodiscard]] std::optional<LargeTable> findLargeTable(const std::string &table);
+        [[nodiscard]] std::vector<IndexCheck> getIndexChecks(const std::string &table);
+        bool checkRows(const std::string &table, LargeTable &largeTable);
+        bool checkIndexSizes(const std::string &table, const LargeTable &largeTable);
+        void finish(Status result);
+
+        Database &database;
+        std::vector<std::string> tables;
+        std::size_t checkedTables = 0;
+        std::optional<LargeTable> largeTable;
+        bool checkedInParts = false;
+        Status status       = Status::Pending;
+    };
+} // namespace db
@@ -34,10 +34,9 @@
  **
  **          -DSQLITE_TEMP_STORE=3
  **
- **     4. File truncation. As of version 3.6.24, SQLite may run without
- **        a working xTruncate() call, providing the user does not configure
- **        SQLite to use "journal_mode=truncate", or use both
- **        "journal_mode=persist" and ATTACHed databases.
+ **     4. Shared memory. Databases in WAL mode keep the WAL index in heap
+ **        memory, which SQLite supports only with "locking_mode=exclusive"
+ **        set before the first access to the database.
  **
  **   It is assumed that the system uses UNIX-like path-names. Specifically,
  **   that '/' characters are used to separate path components and that
@@ -104,6 +103,32 @@
  **
  **   Much more efficient if the underlying OS is not caching write
  **   operations.
+ **
+ ** DATABASE BLOCK CACHE
+ **
+ **   Database files get a small write-back cache of SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ
+ **   blocks instead of a stdio stream buffer. Blocks are aligned to their size
+ **   in the file, so every read and write issued to the file system is a whole,
+ **   aligned block (except the last block of the file). Writes only modify the
+ **   cached blocks - dirty blocks are written back in file order when SQLite
+ **   invokes xSync(), when the block is evicted, or when the file is closed.
+ **   Dirty blocks that are adjacent in the file are written back with a single
+ **   write, e.g. the database header page together with the first table page.
+ **
+ **   SQLite writes database pages only after the rollback journal has been
+ **   synced, so delaying them until the database xSync() (or writing evicted
+ **   blocks earlier) never breaks the journal ordering guarantees. Journals
+ **   keep the sequential write buffer described above.
+ **
+ **   I/O counters of all files are available through
+ **   sqlite3_ecophonevfs_statistics().
+ **
+ ** WRITE-AHEAD LOG
+ **
+ **   The WAL file is appended to sequentially, so it uses the same write
+ **   buffer as the rollback journal. A commit in WAL mode appends the
+ **   modified pages to the WAL and syncs it once, the database file is
+ **   written and synced only when the WAL is checkpointed.
  */
 
 #if !defined(SQLITE_TEST) || SQLITE_OS_UNIX
@@ -115,6 +140,8 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <errno.h>
+#include <algorithm>
+#include <atomic>
 #include <memory>
 #include <cstring>
 #include <filesystem>
@@ -122,6 +149,7 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "config.h"
+#include "sqlite3vfs.hpp"
 
 #include <Utils.hpp>
 #include <dirent.h>
@@ -140,6 +168,37 @@
 
 #define UNUSED(x) ((void)(x))
 
+static constexpr auto SECTOR_SIZE = 512;
+
+static int ecophoneCacheBlocks = SQLITE_ECOPHONEVFS_CACHE_BLOCKS;
+
+/*
+ ** I/O counters of all files. Database connections of different services
+ ** run in their own threads, so the counters are updated atomically.
+ */
+struct EcophoneCounters
+{
+    std::atomic<std::size_t> cacheHits{0};
+    std::atomic<std::size_t> cacheMisses{0};
+    std::atomic<std::size_t> cacheFlushes{0};
+    std::atomic<std::size_t> writes{0};
+    std::atomic<std::size_t> bytesWritten{0};
+    std::atomic<std::size_t> bytesRead{0};
+    std::atomic<std::size_t> syncs{0};
+};
+static EcophoneCounters ecophoneStatistics;
+
+/*
+ ** A single block of a database file held in the cache.
+ */
+struct EcophoneCacheBlock
+{
+    sqlite3_int64 iOfst; /* Offset of the block in file, -1 if the block is unused */
+    unsigned iLastUse;   /* Value of EcophoneFile.iCacheTick at the last access */
+    bool bDirty;         /* Block modified since it was read or written back */
+    char *aData;         /* SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ bytes of data */
+};
+
 /*
  ** When using this VFS, the sqlite3_file* handles that SQLite uses are
  ** actually pointers to instances of type EcophoneFile.
@@ -155,6 +214,14 @@ struct EcophoneFile
     int nBuffer;               /* Valid bytes of data in zBuffer */
     sqlite3_int64 iBufferOfst; /* Offset in file of zBuffer[0] */
 
+    EcophoneCacheBlock *aCache; /* Cached blocks of a database file, NULL for other files */
+    char *aCacheData;           /* Memory of all cached blocks */
+    int nCache;                 /* Number of entries in aCache */
+    unsigned iCacheTick;        /* Incremented on each access to the cache */
+    sqlite3_int64 iSize;        /* Size of the file including data held in the cache */
+    sqlite3_int64 iDiskSize;    /* Size of the file in the file system */
+    bool bWritePending;         /* Data written to the stream, fflush required before reading */
+
     /* Current state */
     long _pos  = -1;
 
@@ -202,12 +269,17 @@ struct EcophoneFile
 
     ssize_t read(void *buf, size_t size)
     {
+        if (bWritePending) {
+            std::fflush(fd);
+            bWritePending = false;
+        }
         auto s = std::fread(buf, 1, size, fd);
         if (std::ferror(fd)) {
             _pos = -1;
             return -1;
         }
         _pos += s;
+        ecophoneStatistics.bytesRead += s;
         return s;
     }
 
@@ -219,6 +291,9 @@ struct EcophoneFile
             return -1;
         }
         _pos += s;
+        bWritePending = true;
+        ecophoneStatistics.writes++;
+        ecophoneStatistics.bytesWritten += s;
         return s;
     }
 
@@ -255,11 +330,14 @@ struct EcophoneFile
                 return SQLITE_IOERR_SEEK;
             }
 
-            auto bytesLeft = off - currentSize;
-            auto zero_buf  = std::make_unique<char[]>(bytesLeft);
-            auto ret       = std::fwrite(zero_buf.get(), 1, bytesLeft, fd);
-            if (ret != bytesLeft) {
-                return SQLITE_IOERR_WRITE;
+            static const char zeroSector[SECTOR_SIZE] = {};
+            auto bytesLeft                            = off - currentSize;
+            while (bytesLeft > 0) {
+                const auto chunk = std::min<long>(bytesLeft, sizeof(zeroSector));
+                if (write(zeroSector, chunk) != chunk) {
+                    return SQLITE_IOERR_WRITE;
+                }
+                bytesLeft -= chunk;
             }
         }
         return SQLITE_OK;
@@ -288,8 +366,8 @@ static int ecophoneDirectWrite(EcophoneFile *p,   /* File handle */
     if (nWrite != iAmt) {
         return SQLITE_IOERR_WRITE;
     }
-    if (std::fflush(p->fd) != 0) {
-        return SQLITE_IOERR_WRITE;
+    if (iOfst + iAmt > p->iDiskSize) {
+        p->iDiskSize = iOfst + iAmt;
     }
     return SQLITE_OK;
 }
@@ -309,6 +387,223 @@ static int ecophoneFlushBuffer(EcophoneFile *p)
     return rc;
 }
 
+/*
+ ** Write nBlocks dirty cached blocks back to the file with a single write. The
+ ** blocks have to be adjacent both in the file and in EcophoneFile.aCacheData.
+ ** The last block of the file is written only up to the end of the file.
+ */
+static int ecophoneCacheWriteBack(EcophoneFile *p, EcophoneCacheBlock *pFirst, int nBlocks)
+{
+    const auto nData = std::min<sqlite3_int64>(nBlocks * SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ, p->iSize - pFirst->iOfst);
+    if (nData > 0) {
+        const auto rc = ecophoneDirectWrite(p, pFirst->aData, static_cast<int>(nData), pFirst->iOfst);
+        if (rc != SQLITE_OK) {
+            return rc;
+        }
+        ecophoneStatistics.cacheFlushes += nBlocks;
+    }
+    for (int i = 0; i < nBlocks; i++) {
+        pFirst[i].bDirty = false;
+    }
+    return SQLITE_OK;
+}
+
+/*
+ ** Exchange two entries of the cache together with their data. The memory
+ ** of an entry stays at its place in EcophoneFile.aCacheData.
+ */
+static void ecophoneCacheSwap(EcophoneCacheBlock *pA, EcophoneCacheBlock *pB)
+{
+    std::swap_ranges(pA->aData, pA->aData + SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ, pB->aData);
+    std::swap(pA->iOfst, pB->iOfst);
+    std::swap(pA->iLastUse, pB->iLastUse);
+    std::swap(pA->bDirty, pB->bDirty);
+}
+
+/*
+ ** Return the index of the dirty cached block starting at iOfst, or -1.
+ */
+static int ecophoneCacheFindDirty(EcophoneFile *p, sqlite3_int64 iOfst)
+{
+    for (int i = 0; i < p->nCache; i++) {
+        if (p->aCache[i].bDirty && p->aCache[i].iOfst == iOfst) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/*
+ ** Write all dirty cached blocks back to the file in the order of their
+ ** offsets. Dirty blocks that follow each other in the file are moved next to
+ ** each other in the cache memory first, so that each run of them is written
+ ** with a single call.
+ */
+static int ecophoneCacheFlush(EcophoneFile *p)
+{
+    for (;;) {
+        int iFirst = -1;
+        for (int i = 0; i < p->nCache; i++) {
+            if (p->aCache[i].bDirty && (iFirst < 0 || p->aCache[i].iOfst < p->aCache[iFirst].iOfst)) {
+                iFirst = i;
+            }
+        }
+        if (iFirst < 0) {
+            return SQLITE_OK;
+        }
+
+        int nRun = 1;
+        for (;;) {
+            const auto iNextOfst = p->aCache[iFirst].iOfst + nRun * SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ;
+            auto iNext           = ecophoneCacheFindDirty(p, iNextOfst);
+            if (iNext < 0) {
+                break;
+            }
+            if (iFirst + nRun == p->nCache) {
+                /* No room behind the run, move it to the beginning of the cache */
+                for (int i = 0; i < nRun; i++) {
+                    ecophoneCacheSwap(&p->aCache[i], &p->aCache[iFirst + i]);
+                }
+                iFirst = 0;
+                iNext  = ecophoneCacheFindDirty(p, iNextOfst);
+            }
+            if (iNext != iFirst + nRun) {
+                ecophoneCacheSwap(&p->aCache[iFirst + nRun], &p->aCache[iNext]);
+            }
+            nRun++;
+        }
+
+        if (const auto rc = ecophoneCacheWriteBack(p, &p->aCache[iFirst], nRun); rc != SQLITE_OK) {
+            return rc;
+        }
+    }
+}
+
+/*
+ ** Find the cached block starting at iBlockOfst or make room for it, evicting
+ ** the least recently used block. If bLoad is set, a newly cached block is
+ ** filled with the file content, otherwise with zeros.
+ */
+static int ecophoneCacheGet(EcophoneFile *p, sqlite3_int64 iBlockOfst, bool bLoad, EcophoneCacheBlock **ppBlock)
+{
+    EcophoneCacheBlock *pVictim = &p->aCache[0];
+    for (int i = 0; i < p->nCache; i++) {
+        auto pBlock = &p->aCache[i];
+        if (pBlock->iOfst == iBlockOfst) {
+            pBlock->iLastUse = ++p->iCacheTick;
+            ecophoneStatistics.cacheHits++;
+            *ppBlock = pBlock;
+            return SQLITE_OK;
+        }
+        if (pVictim->iOfst >= 0 && (pBlock->iOfst < 0 || pBlock->iLastUse < pVictim->iLastUse)) {
+            pVictim = pBlock;
+        }
+    }
+    ecophoneStatistics.cacheMisses++;
+
+    if (pVictim->bDirty) {
+        if (const auto rc = ecophoneCacheWriteBack(p, pVictim, 1); rc != SQLITE_OK) {
+            return rc;
+        }
+    }
+    pVictim->iOfst = -1;
+
+    sqlite3_int64 nLoaded = 0;
+    if (bLoad && iBlockOfst < p->iDiskSize) {
+        nLoaded = std::min<sqlite3_int64>(SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ, p->iDiskSize - iBlockOfst);
+        if (p->seekOrEnd(iBlockOfst) != SQLITE_OK || p->read(pVictim->aData, nLoaded) != nLoaded) {
+            return SQLITE_IOERR_READ;
+        }
+    }
+    memset(&pVictim->aData[nLoaded], 0, SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ - nLoaded);
+
+    pVictim->iOfst    = iBlockOfst;
+    pVictim->iLastUse = ++p->iCacheTick;
+    *ppBlock          = pVictim;
+    return SQLITE_OK;
+}
+
+/*
+ ** Read data of a database file through the cache.
+ */
+static int ecophoneCacheRead(EcophoneFile *p, char *z, int iAmt, sqlite_int64 iOfst)
+{
+    const auto nAvailable = std::max<sqlite3_int64>(0, std::min<sqlite3_int64>(iAmt, p->iSize - iOfst));
+    sqlite3_int64 i       = iOfst;
+    sqlite3_int64 n       = nAvailable;
+
+    while (n > 0) {
+        const auto iBlockOfst = i - (i % SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ);
+        EcophoneCacheBlock *pBlock;
+        if (const auto rc = ecophoneCacheGet(p, iBlockOfst, true, &pBlock); rc != SQLITE_OK) {
+            return rc;
+        }
+        const auto nCopy = std::min<sqlite3_int64>(n, iBlockOfst + SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ - i);
+        memcpy(z, &pBlock->aData[i - iBlockOfst], nCopy);
+        z += nCopy;
+        i += nCopy;
+        n -= nCopy;
+    }
+
+    if (nAvailable < iAmt) {
+        /* SQLite requires the missing part of a short read to be zero-filled */
+        memset(z, 0, iAmt - nAvailable);
+        return SQLITE_IOERR_SHORT_READ;
+    }
+    return SQLITE_OK;
+}
+
+/*
+ ** Write data of a database file to the cache. Blocks that are overwritten
+ ** completely or lie past the end of the file are not read from the file.
+ */
+static int ecophoneCacheWrite(EcophoneFile *p, const char *z, int iAmt, sqlite_int64 iOfst)
+{
+    sqlite3_int64 i = iOfst;
+    sqlite3_int64 n = iAmt;
+
+    while (n > 0) {
+        const auto iBlockOfst = i - (i % SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ);
+        const auto nCopy      = std::min<sqlite3_int64>(n, iBlockOfst + SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ - i);
+        const auto bWhole     = nCopy == SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ;
+        EcophoneCacheBlock *pBlock;
+        if (const auto rc = ecophoneCacheGet(p, iBlockOfst, !bWhole, &pBlock); rc != SQLITE_OK) {
+            return rc;
+        }
+        memcpy(&pBlock->aData[i - iBlockOfst], z, nCopy);
+        pBlock->bDirty = true;
+        z += nCopy;
+        i += nCopy;
+        n -= nCopy;
+    }
+
+    if (i > p->iSize) {
+        p->iSize = i;
+    }
+    return SQLITE_OK;
+}
+
+/*
+ ** Allocate the block cache of a database file.
+ */
+static int ecophoneCacheInit(EcophoneFile *p, int nBlocks)
+{
+    p->aCache     = (EcophoneCacheBlock *)sqlite3_malloc(nBlocks * sizeof(EcophoneCacheBlock));
+    p->aCacheData = (char *)sqlite3_malloc(nBlocks * SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ);
+    if (p->aCache == nullptr || p->aCacheData == nullptr) {
+        sqlite3_free(p->aCache);
+        sqlite3_free(p->aCacheData);
+        p->aCache     = nullptr;
+        p->aCacheData = nullptr;
+        return SQLITE_NOMEM;
+    }
+    for (int i = 0; i < nBlocks; i++) {
+        p->aCache[i] = {-1, 0, false, &p->aCacheData[i * SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ]};
+    }
+    p->nCache = nBlocks;
+    return SQLITE_OK;
+}
+
 /*
  ** Close a file.
  */
@@ -317,7 +612,12 @@ static int ecophoneClose(sqlite3_file *pFile)
     int rc;
     EcophoneFile *p = (EcophoneFile *)pFile;
     rc              = ecophoneFlushBuffer(p);
+    if (const auto rcCache = ecophoneCacheFlush(p); rc == SQLITE_OK) {
+        rc = rcCache;
+    }
     sqlite3_free(p->aBuffer);
+    sqlite3_free(p->aCache);
+    sqlite3_free(p->aCacheData);
     p->streamBuffer.reset();
 
     std::fclose(p->fd);
@@ -333,6 +633,10 @@ static int ecophoneRead(sqlite3_file *pFile, void *zBuf, int iAmt, sqlite_int64
 
     EcophoneFile *p = (EcophoneFile *)pFile;
 
+    if (p->aCache) {
+        return ecophoneCacheRead(p, (char *)zBuf, iAmt, iOfst);
+    }
+
     /* Flush any data in the write buffer to disk in case this operation
      ** is trying to read data the file-region currently cached in the buffer.
      ** It would be possible to detect this case and possibly save an
@@ -364,6 +668,9 @@ static int ecophoneWrite(sqlite3_file *pFile, const void *zBuf, int iAmt, sqlite
 {
     EcophoneFile *p = (EcophoneFile *)pFile;
 
+    if (p->aCache) {
+        return ecophoneCacheWrite(p, (const char *)zBuf, iAmt, iOfst);
+    }
     if (p->aBuffer) {
         char *z         = (char *)zBuf; /* Pointer to remaining data to write */
         int n           = iAmt;         /* Number of bytes at z */
@@ -406,18 +713,47 @@ static int ecophoneWrite(sqlite3_file *pFile, const void *zBuf, int iAmt, sqlite
 }
 
 /*
- ** Truncate a file. This is a no-op for this VFS (see header comments at
- ** the top of the file).
+ ** Truncate a file. Used by WAL checkpoints to trim the database file to
+ ** the number of pages it holds.
  */
 static int ecophoneTruncate(sqlite3_file *pFile, sqlite_int64 size)
 {
-#if 0
-    if( ftruncate(((EcophoneFile *)pFile)->fd, size) ) return SQLITE_IOERR_TRUNCATE;
-#else
-    UNUSED(pFile);
-    UNUSED(size);
-#endif
-    return SQLITE_IOERR_TRUNCATE;
+    EcophoneFile *p = (EcophoneFile *)pFile;
+
+    auto rc = ecophoneFlushBuffer(p);
+    if (rc != SQLITE_OK) {
+        return rc;
+    }
+
+    /* Cached blocks past the new end of the file are dropped, the block
+     ** containing the new end keeps zeros past it in case the file grows again.
+     */
+    for (int i = 0; i < p->nCache; i++) {
+        auto pBlock = &p->aCache[i];
+        if (pBlock->iOfst >= size) {
+            pBlock->iOfst  = -1;
+            pBlock->bDirty = false;
+        }
+        else if (pBlock->iOfst >= 0 && pBlock->iOfst + SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ > size) {
+            const auto nKeep = size - pBlock->iOfst;
+            memset(&pBlock->aData[nKeep], 0, SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ - nKeep);
+        }
+    }
+    if (p->aCache && size > p->iDiskSize) {
+        /* The file grows only in the cache, the blocks are written back on sync */
+        p->iSize = size;
+        return SQLITE_OK;
+    }
+
+    if (std::fflush(p->fd) != 0 || ftruncate(fileno(p->fd), size) != 0) {
+        p->_pos = -1;
+        return SQLITE_IOERR_TRUNCATE;
+    }
+    p->_pos          = -1;
+    p->bWritePending = false;
+    p->iDiskSize     = size;
+    p->iSize         = size;
+    return SQLITE_OK;
 }
 
 /*
@@ -434,6 +770,15 @@ static int ecophoneSync(sqlite3_file *pFile, int flags)
     if (rc != SQLITE_OK) {
         return rc;
     }
+    rc = ecophoneCacheFlush(p);
+    if (rc != SQLITE_OK) {
+        return rc;
+    }
+    if (std::fflush(p->fd) != 0) {
+        return SQLITE_IOERR_FSYNC;
+    }
+    p->bWritePending = false;
+    ecophoneStatistics.syncs++;
     rc = fileno(p->fd);
     if (rc > 0) {
         rc = fsync(rc);
@@ -449,6 +794,11 @@ static int ecophoneFileSize(sqlite3_file *pFile, sqlite_int64 *pSize)
     EcophoneFile *p = (EcophoneFile *)pFile;
     int rc; /* Return code from fstat() call */
 
+    if (p->aCache) {
+        *pSize = p->iSize;
+        return SQLITE_OK;
+    }
+
     /* Flush the contents of the buffer to disk. As with the flush in the
      ** ecophoneRead() method, it would be possible to avoid this and save a write
      ** here and there. But in practice this comes up so infrequently it is
@@ -509,7 +859,6 @@ static int ecophoneFileControl(sqlite3_file *pFile, int op, void *pArg)
 static int ecophoneSectorSize(sqlite3_file *pFile)
 {
     UNUSED(pFile);
-    static constexpr auto SECTOR_SIZE = 512;
     return SECTOR_SIZE;
 }
 
@@ -581,7 +930,7 @@ static int ecophoneOpen(sqlite3_vfs *pVfs,   /* VFS */
         return SQLITE_IOERR;
     }
 
-    if (flags & SQLITE_OPEN_MAIN_JOURNAL) {
+    if (flags & (SQLITE_OPEN_MAIN_JOURNAL | SQLITE_OPEN_WAL)) {
         aBuf = (char *)sqlite3_malloc(SQLITE_ECOPHONEVFS_BUFFERSZ);
         if (!aBuf) {
             return SQLITE_NOMEM;
@@ -618,12 +967,26 @@ static int ecophoneOpen(sqlite3_vfs *pVfs,   /* VFS */
         sqlite3_free(aBuf);
         return SQLITE_CANTOPEN;
     }
-    // set as 16 kB instead 64kB as it is allocated for each open db file
-    constexpr size_t streamBufferSize = 16 * 1024;
-    p->streamBuffer                   = std::make_unique<char[]>(streamBufferSize);
-    setvbuf(p->fd, p->streamBuffer.get(), _IOFBF, streamBufferSize);
     p->aBuffer = aBuf;
 
+    if ((flags & SQLITE_OPEN_MAIN_DB) && ecophoneCacheBlocks > 0) {
+        // The block cache takes over the role of the stream buffer, all I/O is done in whole blocks
+        if (ecophoneCacheInit(p, ecophoneCacheBlocks) != SQLITE_OK) {
+            std::fclose(p->fd);
+            sqlite3_free(aBuf);
+            return SQLITE_NOMEM;
+        }
+        setvbuf(p->fd, nullptr, _IONBF, 0);
+    }
+    else {
+        // set as 16 kB instead 64kB as it is allocated for each open db file
+        constexpr size_t streamBufferSize = 16 * 1024;
+        p->streamBuffer                   = std::make_unique<char[]>(streamBufferSize);
+        setvbuf(p->fd, p->streamBuffer.get(), _IOFBF, streamBufferSize);
+    }
+    p->iDiskSize = p->size();
+    p->iSize     = p->iDiskSize;
+
     if (pOutFlags) {
         *pOutFlags = flags;
     }
@@ -822,4 +1185,33 @@ sqlite3_vfs *sqlite3_ecophonevfs(void)
     return &ecophonevfs;
 }
 
+void sqlite3_ecophonevfs_set_cache_size(int blocks)
+{
+    ecophoneCacheBlocks = std::max(blocks, 0);
+}
+
+EcophoneVfsStatistics sqlite3_ecophonevfs_statistics(void)
+{
+    EcophoneVfsStatistics statistics;
+    statistics.cacheHits    = ecophoneStatistics.cacheHits;
+    statistics.cacheMisses  = ecophoneStatistics.cacheMisses;
+    statistics.cacheFlushes = ecophoneStatistics.cacheFlushes;
+    statistics.writes       = ecophoneStatistics.writes;
+    statistics.bytesWritten = ecophoneStatistics.bytesWritten;
+    statistics.bytesRead    = ecophoneStatistics.bytesRead;
+    statistics.syncs        = ecophoneStatistics.syncs;
+    return statistics;
+}
+
+void sqlite3_ecophonevfs_reset_statistics(void)
+{
+    ecophoneStatistics.cacheHits    = 0;
+    ecophoneStatistics.cacheMisses  = 0;
+    ecophoneStatistics.cacheFlushes = 0;
+    ecophoneStatistics.writes       = 0;
+    ecophoneStatistics.bytesWritten = 0;
+    ecophoneStatistics.bytesRead    = 0;
+    ecophoneStatistics.syncs        = 0;
+}
+
 #endif /* !defined(SQLITE_TEST) || SQLITE_OS_UNIX */
@@ -0,0 +1,37 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include "sqlite3.h"
+
+#include <cstdint>
+
+/// Size of the blocks cached for database files in bytes, has to be a multiple of the sector size
+#ifndef SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ
+#define SQLITE_ECOPHONEVFS_CACHE_BLOCKSZ 4096
+#endif
+
+/// Default number of blocks cached for each database file
+#ifndef SQLITE_ECOPHONEVFS_CACHE_BLOCKS
+#define SQLITE_ECOPHONEVFS_CACHE_BLOCKS 4
+#endif
+
+/// Cumulative I/O counters of all files opened through the ecophone VFS, counted in the connections of all threads
+struct EcophoneVfsStatistics
+{
+    std::uint64_t cacheHits    = 0; ///< Database blocks found in the cache
+    std::uint64_t cacheMisses  = 0; ///< Database blocks that had to be read from (or prepared for) the file
+    std::uint64_t cacheFlushes = 0; ///< Dirty database blocks written back to the file
+    std::uint64_t writes       = 0; ///< Write calls issued to the file system
+    std::uint64_t bytesWritten = 0;
+    std::uint64_t bytesRead    = 0;
+    std::uint64_t syncs        = 0; ///< fsync calls issued to the file system
+};
+
+sqlite3_vfs *sqlite3_ecophonevfs(void);
+
+/// Sets the number of blocks cached for each database file opened afterwards, 0 disables the cache
+void sqlite3_ecophonevfs_set_cache_size(int blocks);
+EcophoneVfsStatistics sqlite3_ecophonevfs_statistics(void);
+void sqlite3_ecophonevfs_reset_statistics(void);
@@ -88,6 +88,15 @@ namespace db::multimedia_files
         if (typeid(*query) == typeid(query::GetOffsetByPath)) {
             return runQueryImplGetOffsetByPath(std::static_pointer_cast<query::GetOffsetByPath>(query));
         }
+        if (typeid(*query) == typeid(query::GetNextWithoutLoudness)) {
+            return runQueryImplGetNextWithoutLoudness(std::static_pointer_cast<query::GetNextWithoutLoudness>(query));
+        }
+        if (typeid(*query) == typeid(query::SetLoudness)) {
+            return runQueryImplSetLoudness(std::static_pointer_cast<query::SetLoudness>(query));
+        }
+        if (typeid(*query) == typeid(query::SetLoudnessFailed)) {
+            return runQueryImplSetLoudnessFailed(std::static_pointer_cast<query::SetLoudnessFailed>(query));
+        }
         return nullptr;
     }
 
@@ -296,4 +305,32 @@ namespace db::multimedia_files
         response->setRequestQuery(query);
         return response;
     }
+
+    std::unique_ptr<db::multimedia_files::query::GetResult> MultimediaFilesRecordInterface::
+        runQueryImplGetNextWithoutLoudness(
+            const std::shared_ptr<db::multimedia_files::query::GetNextWithoutLoudness> &query)
+    {
+        const auto record = database->files.getNextWithoutLoudness(query->afterId);
+        auto response     = std::make_unique<query::GetResult>(record);
+        response->setRequestQuery(query);
+        return response;
+    }
+
+    std::unique_ptr<db::multimedia_files::query::EditResult> MultimediaFilesRecordInterface::runQueryImplSetLoudness(
+        const std::shared_ptr<db::multimedia_files::query::SetLoudness> &query)
+    {
+        const auto result = database->files.setLoudness(query->getPath(), query->getLoudness());
+        auto response     = std::make_unique<query::EditResult>(result);
+        response->setRequestQuery(query);
+        return response;
+    }
+
+    std::unique_ptr<db::multimedia_files::query::EditResult> MultimediaFilesRecordInterface::
+        runQueryImplSetLoudnessFailed(const std::shared_ptr<db::multimedia_files::query::SetLoudnessFailed> &query)
+    {
+        const auto result = database->files.setLoudnessFailed(query->getPath());
+        auto response     = std::make_unique<query::EditResult>(result);
+        response->setRequestQuery(query);
+        return response;
+    }
 } // namespace db::multimedia_files
@@ -47,6 +47,9 @@ namespace db::multimedia_files::query
     class GetCountForPath;
     class GetOffsetByPath;
     class GetOffsetResult;
+    class GetNextWithoutLoudness;
+    class SetLoudness;
+    class SetLoudnessFailed;
 
 } // namespace db::multimedia_files::query
 
@@ -107,6 +110,12 @@ namespace db::multimedia_files
             const std::shared_ptr<db::multimedia_files::query::GetCountForPath> &query);
         std::unique_ptr<db::multimedia_files::query::GetOffsetResult> runQueryImplGetOffsetByPath(
             const std::shared_ptr<db::multimedia_files::query::GetOffsetByPath> &query);
+        std::unique_ptr<db::multimedia_files::query::GetResult> runQueryImplGetNextWithoutLoudness(
+            const std::shared_ptr<db::multimedia_files::query::GetNextWithoutLoudness> &query);
+        std::unique_ptr<db::multimedia_files::query::EditResult> runQueryImplSetLoudness(
+            const std::shared_ptr<db::multimedia_files::query::SetLoudness> &query);
+        std::unique_ptr<db::multimedia_files::query::EditResult> runQueryImplSetLoudnessFailed(
+            const std::shared_ptr<db::multimedia_files::query::SetLoudnessFailed> &query);
 
         MultimediaFilesDB *database = nullptr;
     };
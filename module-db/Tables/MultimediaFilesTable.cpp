@@ -30,6 +30,13 @@ namespace db::multimedia_files
             return TableRow{};
         }
 
+        std::optional<Loudness> loudness;
+        // NULL until the file is analyzed
+        if (!result[15].getString().empty() && result[15].getInt32() != Loudness::analysisFailed) {
+            loudness = Loudness{result[15].getInt32(),  // loudness
+                                result[16].getInt32()}; // peak
+        }
+
         return TableRow{
             result[0].getUInt32(),    // ID
             {result[1].getString(),   // path
@@ -46,6 +53,7 @@ namespace db::multimedia_files
              result[12].getUInt32(),  // bitrate
              result[13].getUInt32(),  // sample rate
              result[14].getUInt32()}, // channels
+            loudness,
         };
     }
 
@@ -95,7 +103,9 @@ namespace db::multimedia_files
                            "song_length = excluded.song_length, "
                            "bitrate = excluded.bitrate, "
                            "sample_rate = excluded.sample_rate, "
-                           "channels = excluded.channels;",
+                           "channels = excluded.channels, "
+                           "loudness = NULL, "
+                           "peak = NULL;",
                            entry.fileInfo.path.c_str(),
                            entry.fileInfo.mediaType.c_str(),
                            entry.fileInfo.size,
@@ -185,6 +195,32 @@ namespace db::multimedia_files
                            path.c_str());
     }
 
+    bool MultimediaFilesTable::setLoudness(const std::string &path, const Loudness &loudness)
+    {
+        return db->execute("UPDATE files SET loudness=" i32_c "peak=" i32_ " WHERE path=" str_ ";",
+                           loudness.integrated,
+                           loudness.peak,
+                           path.c_str());
+    }
+
+    bool MultimediaFilesTable::setLoudnessFailed(const std::string &path)
+    {
+        return db->execute(
+            "UPDATE files SET loudness=" i32_c "peak=NULL WHERE path=" str_ ";", Loudness::analysisFailed, path.c_str());
+    }
+
+    auto MultimediaFilesTable::getNextWithoutLoudness(std::uint32_t afterId) -> TableRow
+    {
+        auto retQuery = db->query(
+            "SELECT * FROM files WHERE loudness IS NULL AND _id>" u32_ " ORDER BY _id ASC LIMIT 1;", afterId);
+
+        if ((retQuery == nullptr) || (retQuery->getRowCount() == 0)) {
+            return TableRow();
+        }
+
+        return CreateTableRow(*retQuery);
+    }
+
     TableRow MultimediaFilesTable::getById(uint32_t id)
     {
         auto retQuery = db->query("SELECT * FROM files WHERE _id=" u32_ ";", id);
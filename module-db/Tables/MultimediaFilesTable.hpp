@@ -7,6 +7,8 @@
 #include "Table.hpp"
 #include <Database/Database.hpp>
 
+#include <limits>
+#include <optional>
 #include <string>
 
 namespace db::multimedia_files
@@ -36,6 +38,15 @@ namespace db::multimedia_files
         std::uint32_t channels{};   /// 1 - mono, 2 - stereo
     };
 
+    struct Loudness
+    {
+        /// stored as the integrated loudness of a file that could not be analyzed
+        static constexpr std::int32_t analysisFailed = std::numeric_limits<std::int32_t>::min();
+
+        std::int32_t integrated{}; /// integrated loudness (EBU R128) in 0.01 LUFS
+        std::int32_t peak{};       /// sample peak in 0.01 dBFS
+    };
+
     struct FileInfo
     {
         std::string path{};
@@ -48,6 +59,7 @@ namespace db::multimedia_files
         FileInfo fileInfo{};
         Tags tags{};
         AudioProperties audioProperties{};
+        std::optional<Loudness> loudness{}; /// empty until the file is analyzed or if the analysis failed
 
         auto isValid() const -> bool;
     };
@@ -73,7 +85,9 @@ namespace db::multimedia_files
         song_length,
         bitrate,
         sample_rate,
-        channels
+        channels,
+        loudness,
+        peak
     };
 
     enum class SortingBy
@@ -123,6 +137,14 @@ namespace db::multimedia_files
         /// @note entry.ID is skipped
         bool addOrUpdate(TableRow entry, std::string oldPath = "");
 
+        /// @note Loudness is not stored by add() and update(), the analysis sets it for the given path. Adding a file
+        /// again clears it, as the content may have changed.
+        bool setLoudness(const std::string &path, const Loudness &loudness);
+        /// Marks the file as not analyzable, so that the analysis is not retried until the file is added again
+        bool setLoudnessFailed(const std::string &path);
+        /// @return first file with _id greater than the given one that has not been analyzed, invalid row if none
+        auto getNextWithoutLoudness(std::uint32_t afterId) -> TableRow;
+
         auto getOffsetOfSortedRecordByPath(const std::string &folderPath,
                                            const std::string &recordPath,
                                            SortingBy sorting = SortingBy::TitleAscending) -> SortedRecord;
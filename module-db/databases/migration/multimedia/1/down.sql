@@ -0,0 +1,10 @@
+-- Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+-- For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+-- Message: Add loudness analysis results
+-- Revision: b0e37346-2a06-4ec8-b3f0-09a0b5a45514
+-- Create Date: 2025-06-16 10:12:41
+
+-- Insert SQL here
+ALTER TABLE files DROP COLUMN peak;
+ALTER TABLE files DROP COLUMN loudness;
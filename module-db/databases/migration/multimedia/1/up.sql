@@ -0,0 +1,12 @@
+-- Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+-- For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+-- Message: Add loudness analysis results
+-- Revision: b0e37346-2a06-4ec8-b3f0-09a0b5a45514
+-- Create Date: 2025-06-16 10:12:41
+
+-- Insert SQL here
+-- integrated loudness in 0.01 LUFS and sample peak in 0.01 dBFS, NULL until the file is analyzed,
+-- loudness -2147483648 with NULL peak if the file can't be analyzed
+ALTER TABLE files ADD COLUMN loudness INTEGER;
+ALTER TABLE files ADD COLUMN peak INTEGER;
@@ -18,6 +18,38 @@ namespace db::multimedia_files::query
         return std::string{"Edit"};
     }
 
+    SetLoudness::SetLoudness(const std::string &path, const Loudness &loudness)
+        : Query(Query::Type::Update), path(path), loudness(loudness)
+    {}
+
+    auto SetLoudness::getPath() const -> std::string
+    {
+        return path;
+    }
+
+    auto SetLoudness::getLoudness() const -> Loudness
+    {
+        return loudness;
+    }
+
+    auto SetLoudness::debugInfo() const -> std::string
+    {
+        return std::string{"SetLoudness"};
+    }
+
+    SetLoudnessFailed::SetLoudnessFailed(const std::string &path) : Query(Query::Type::Update), path(path)
+    {}
+
+    auto SetLoudnessFailed::getPath() const -> std::string
+    {
+        return path;
+    }
+
+    auto SetLoudnessFailed::debugInfo() const -> std::string
+    {
+        return std::string{"SetLoudnessFailed"};
+    }
+
     EditResult::EditResult(bool ret) : ret(ret)
     {}
 
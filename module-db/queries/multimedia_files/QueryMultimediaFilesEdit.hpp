@@ -22,6 +22,31 @@ namespace db::multimedia_files::query
         [[nodiscard]] auto debugInfo() const -> std::string override;
     };
 
+    class SetLoudness : public Query
+    {
+        const std::string path;
+        const Loudness loudness;
+
+      public:
+        SetLoudness(const std::string &path, const Loudness &loudness);
+
+        [[nodiscard]] auto getPath() const -> std::string;
+        [[nodiscard]] auto getLoudness() const -> Loudness;
+        [[nodiscard]] auto debugInfo() const -> std::string override;
+    };
+
+    /// Marks a file that could not be analyzed, see MultimediaFilesTable::setLoudnessFailed
+    class SetLoudnessFailed : public Query
+    {
+        const std::string path;
+
+      public:
+        explicit SetLoudnessFailed(const std::string &path);
+
+        [[nodiscard]] auto getPath() const -> std::string;
+        [[nodiscard]] auto debugInfo() const -> std::string override;
+    };
+
     class EditResult : public QueryResult
     {
         const bool ret = true;
@@ -21,6 +21,14 @@ namespace db::multimedia_files::query
         return std::string{"GetByPath"};
     }
 
+    GetNextWithoutLoudness::GetNextWithoutLoudness(uint32_t afterId) : Query(Query::Type::Read), afterId(afterId)
+    {}
+
+    auto GetNextWithoutLoudness::debugInfo() const -> std::string
+    {
+        return std::string{"GetNextWithoutLoudness"};
+    }
+
     GetResult::GetResult(const MultimediaFilesRecord &record) : record(record)
     {}
 
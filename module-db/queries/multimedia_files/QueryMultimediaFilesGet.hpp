@@ -40,4 +40,14 @@ namespace db::multimedia_files::query
         [[nodiscard]] auto debugInfo() const -> std::string override;
     };
 
+    /// Next file waiting for the loudness analysis, ordered by ID
+    class GetNextWithoutLoudness : public Query
+    {
+      public:
+        const uint32_t afterId;
+        explicit GetNextWithoutLoudness(uint32_t afterId);
+
+        [[nodiscard]] auto debugInfo() const -> std::string override;
+    };
+
 } // namespace db::multimedia_files::query
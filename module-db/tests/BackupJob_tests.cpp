@@ -0,0 +1,111 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include "Helpers.hpp"
+
+#include <Database/BackupJob.hpp>
+
+namespace
+{
+    constexpr auto records = 500;
+
+    std::uint32_t countRecords(Database &database)
+    {
+        const auto result = database.query("SELECT COUNT(*) FROM records;");
+        REQUIRE(result);
+        return (*result)[0].getUInt32();
+    }
+} // namespace
+
+TEST_CASE("Online database backup")
+{
+    const std::filesystem::path backupPath{"backup_copy.db"};
+    std::filesystem::remove(backupPath);
+
+    db::tests::DatabaseUnderTest<Database> database{"backup.db"};
+    auto &testDb = database.get();
+    REQUIRE(testDb.execute("CREATE TABLE records(_id INTEGER PRIMARY KEY, value TEXT);"));
+    REQUIRE(testDb.execute("BEGIN TRANSACTION;"));
+    for (auto i = 0; i < records; i++) {
+        REQUIRE(testDb.execute("INSERT INTO records(value) VALUES('%q');", std::string(100, 'a' + i % 26).c_str()));
+    }
+    REQUIRE(testDb.execute("COMMIT;"));
+
+    db::BackupJob job{testDb, backupPath};
+    REQUIRE(job.getStatus() == db::BackupJob::Status::Pending);
+    REQUIRE(job.getProgress() == 0);
+
+    SECTION("Copy in steps")
+    {
+        auto steps        = 0;
+        unsigned progress = 0;
+        while (!job.isFinished()) {
+            job.step(2);
+            REQUIRE(job.getProgress() >= progress);
+            progress = job.getProgress();
+            ++steps;
+        }
+        REQUIRE(steps > 1);
+        REQUIRE(job.getStatus() == db::BackupJob::Status::Done);
+        REQUIRE(job.getProgress() == 100);
+
+        Database copy{backupPath.c_str()};
+        REQUIRE(countRecords(copy) == records);
+    }
+
+    SECTION("Changes made between steps are carried over")
+    {
+        REQUIRE(job.step(2) == db::BackupJob::Status::InProgress);
+        REQUIRE(testDb.execute("INSERT INTO records(value) VALUES('late');"));
+        while (!job.isFinished()) {
+            job.step(2);
+        }
+        REQUIRE(job.getStatus() == db::BackupJob::Status::Done);
+
+        Database copy{backupPath.c_str()};
+        REQUIRE(countRecords(copy) == records + 1);
+    }
+
+    SECTION("Open transaction postpones the step")
+    {
+        REQUIRE(testDb.execute("BEGIN TRANSACTION;"));
+        REQUIRE(testDb.execute("INSERT INTO records(value) VALUES('uncommitted');"));
+        REQUIRE(job.step() == db::BackupJob::Status::Pending);
+        REQUIRE(testDb.execute("ROLLBACK;"));
+
+        while (!job.isFinished()) {
+            job.step();
+        }
+        Database copy{backupPath.c_str()};
+        REQUIRE(countRecords(copy) == records);
+    }
+
+    SECTION("Transaction left open is committed after the maximum wait")
+    {
+        REQUIRE(testDb.execute("BEGIN TRANSACTION;"));
+        REQUIRE(testDb.execute("INSERT INTO records(value) VALUES('left open');"));
+        for (auto i = 1; i < db::BackupJob::maxTransactionWaits; i++) {
+            REQUIRE(job.step() == db::BackupJob::Status::Pending);
+        }
+
+        auto steps = 0;
+        while (!job.isFinished() && steps++ < records) {
+            job.step();
+        }
+        REQUIRE(job.getStatus() == db::BackupJob::Status::Done);
+        Database copy{backupPath.c_str()};
+        REQUIRE(countRecords(copy) == records + 1);
+    }
+
+    SECTION("Cancel")
+    {
+        REQUIRE(job.step(2) == db::BackupJob::Status::InProgress);
+        job.cancel();
+        REQUIRE(job.getStatus() == db::BackupJob::Status::Cancelled);
+        REQUIRE(job.step() == db::BackupJob::Status::Cancelled);
+        REQUIRE(!std::filesystem::exists(backupPath));
+    }
+
+    std::filesystem::remove(backupPath);
+}
@@ -0,0 +1,133 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include "Helpers.hpp"
+
+#include <Database/sqlite3vfs.hpp>
+
+namespace
+{
+    constexpr auto transactions = 20;
+
+    EcophoneVfsStatistics runTransactions(Database &testDb, std::size_t valueSize = 0)
+    {
+        sqlite3_ecophonevfs_reset_statistics();
+        for (auto i = 0; i < transactions; i++) {
+            auto value = std::to_string(i);
+            value.resize(std::max(value.size(), valueSize), 'x');
+            REQUIRE(testDb.execute("INSERT INTO records(value) VALUES('%q');", value.c_str()));
+        }
+        return sqlite3_ecophonevfs_statistics();
+    }
+} // namespace
+
+TEST_CASE("Ecophone VFS block cache")
+{
+    REQUIRE(sqlite3_vfs_find(nullptr) == sqlite3_ecophonevfs());
+
+    SECTION("Data consistency")
+    {
+        db::tests::DatabaseUnderTest<Database> database{"vfs.db"};
+        auto &testDb = database.get();
+        REQUIRE(testDb.execute("CREATE TABLE records(_id INTEGER PRIMARY KEY, value TEXT);"));
+        runTransactions(testDb);
+
+        const auto statistics = sqlite3_ecophonevfs_statistics();
+        REQUIRE(statistics.cacheHits > 0);
+        REQUIRE(statistics.cacheFlushes > 0);
+        REQUIRE(statistics.bytesWritten > 0);
+
+        const auto result = testDb.query("SELECT COUNT(*) FROM records;");
+        REQUIRE(result);
+        REQUIRE((*result)[0].getUInt32() == transactions);
+        REQUIRE(testDb.checkIntegrity(Database::IntegrityCheck::Full));
+    }
+
+    SECTION("Write amplification")
+    {
+        // Records larger than a page grow the file in every transaction, so the header page, the table page and
+        // the new overflow pages are written together
+        const std::size_t valueSizes[] = {0, 6000};
+        EcophoneVfsStatistics uncached[std::size(valueSizes)];
+        EcophoneVfsStatistics cached[std::size(valueSizes)];
+
+        for (std::size_t i = 0; i < std::size(valueSizes); i++) {
+            std::filesystem::remove("vfs_nocache.db");
+            sqlite3_ecophonevfs_set_cache_size(0);
+            {
+                Database testDb{"vfs_nocache.db"};
+                REQUIRE(testDb.execute("CREATE TABLE records(_id INTEGER PRIMARY KEY, value TEXT);"));
+                uncached[i] = runTransactions(testDb, valueSizes[i]);
+                REQUIRE(uncached[i].cacheHits == 0);
+            }
+            std::filesystem::remove("vfs_nocache.db");
+
+            sqlite3_ecophonevfs_set_cache_size(SQLITE_ECOPHONEVFS_CACHE_BLOCKS);
+            std::filesystem::remove("vfs_cache.db");
+            {
+                Database testDb{"vfs_cache.db"};
+                REQUIRE(testDb.execute("CREATE TABLE records(_id INTEGER PRIMARY KEY, value TEXT);"));
+                cached[i] = runTransactions(testDb, valueSizes[i]);
+            }
+            std::filesystem::remove("vfs_cache.db");
+
+            WARN("Per transaction of " << valueSizes[i] << " B records without cache: "
+                                       << uncached[i].writes / transactions << " writes, "
+                                       << uncached[i].bytesWritten / transactions << " bytes, "
+                                       << uncached[i].syncs / transactions << " syncs");
+            WARN("Per transaction of " << valueSizes[i] << " B records with cache: "
+                                       << cached[i].writes / transactions << " writes, "
+                                       << cached[i].bytesWritten / transactions << " bytes, "
+                                       << cached[i].syncs / transactions << " syncs");
+            REQUIRE(cached[i].syncs == uncached[i].syncs);
+            REQUIRE(cached[i].writes <= uncached[i].writes);
+        }
+        REQUIRE(cached[1].writes < uncached[1].writes);
+    }
+}
+
+TEST_CASE("Ecophone VFS WAL journal")
+{
+    Database::setJournalMode(Database::JournalMode::Wal);
+    std::filesystem::remove("vfs_wal.db");
+    {
+        Database testDb{"vfs_wal.db"};
+        REQUIRE(testDb.isWalEnabled());
+        REQUIRE(testDb.execute("CREATE TABLE records(_id INTEGER PRIMARY KEY, value TEXT);"));
+
+        std::size_t committedFrames{};
+        testDb.setWalCommitCallback([&committedFrames](std::size_t walFrames) { committedFrames = walFrames; });
+        const auto statistics = runTransactions(testDb);
+        WARN("Per transaction in WAL mode: " << statistics.writes / transactions << " writes, "
+                                             << statistics.bytesWritten / transactions << " bytes, "
+                                             << statistics.syncs / transactions << " syncs");
+        REQUIRE(statistics.syncs == transactions);
+        REQUIRE(committedFrames > 0);
+        REQUIRE(testDb.getPendingWalFrames() == committedFrames);
+
+        REQUIRE(testDb.checkpoint());
+        REQUIRE(testDb.getPendingWalFrames() == 0);
+        REQUIRE(testDb.checkIntegrity(Database::IntegrityCheck::Full));
+    }
+    REQUIRE(!std::filesystem::exists("vfs_wal.db-wal"));
+
+    SECTION("Data persists in the database file")
+    {
+        Database testDb{"vfs_wal.db"};
+        const auto result = testDb.query("SELECT COUNT(*) FROM records;");
+        REQUIRE(result);
+        REQUIRE((*result)[0].getUInt32() == transactions);
+    }
+
+    SECTION("Switching back to the rollback journal")
+    {
+        Database::setJournalMode(Database::JournalMode::Delete);
+        Database testDb{"vfs_wal.db"};
+        REQUIRE(!testDb.isWalEnabled());
+        REQUIRE(testDb.execute("INSERT INTO records(value) VALUES('rollback');"));
+    }
+
+    Database::setJournalMode(Database::JournalMode::Delete);
+    std::filesystem::remove("vfs_wal.db");
+}
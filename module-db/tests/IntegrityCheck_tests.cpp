@@ -0,0 +1,116 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include "Helpers.hpp"
+
+#include <Database/IntegrityCheck.hpp>
+#include <filesystem>
+
+TEST_CASE("Integrity check state")
+{
+    const std::filesystem::path databasePath{"integrity.db"};
+    std::filesystem::remove(db::IntegrityCheckState::getStatePath(databasePath));
+    const auto now = std::time(nullptr);
+
+    SECTION("Missing state")
+    {
+        const auto state = db::IntegrityCheckState::load(databasePath);
+        REQUIRE(state.result == db::IntegrityCheckState::Result::Unknown);
+        REQUIRE(state.isCheckNeeded(now));
+    }
+
+    SECTION("Stored state")
+    {
+        REQUIRE(db::IntegrityCheckState{db::IntegrityCheckState::Result::Passed, now}.store(databasePath));
+        const auto state = db::IntegrityCheckState::load(databasePath);
+        REQUIRE(state.result == db::IntegrityCheckState::Result::Passed);
+        REQUIRE(state.checkedAt == now);
+        REQUIRE(!state.isCheckNeeded(now));
+
+        const auto outdated = now + std::chrono::duration_cast<std::chrono::seconds>(
+                                        db::IntegrityCheckState::maxAge + std::chrono::hours{1})
+                                        .count();
+        REQUIRE(state.isCheckNeeded(outdated));
+    }
+
+    SECTION("Failed check")
+    {
+        REQUIRE(db::IntegrityCheckState{db::IntegrityCheckState::Result::Failed, now}.store(databasePath));
+        REQUIRE(db::IntegrityCheckState::load(databasePath).isCheckNeeded(now));
+    }
+
+    std::filesystem::remove(db::IntegrityCheckState::getStatePath(databasePath));
+}
+
+TEST_CASE("Incremental integrity check")
+{
+    db::tests::DatabaseUnderTest<Database> database{"integrity.db"};
+    auto &testDb = database.get();
+    REQUIRE(testDb.execute("CREATE TABLE first(_id INTEGER PRIMARY KEY, value TEXT);"));
+    REQUIRE(testDb.execute("CREATE TABLE second(_id INTEGER PRIMARY KEY, value TEXT);"));
+    REQUIRE(testDb.execute("CREATE INDEX second_value ON second(value);"));
+    REQUIRE(testDb.execute("INSERT INTO second(value) VALUES('test');"));
+
+    REQUIRE(testDb.checkIntegrity(Database::IntegrityCheck::Quick));
+    REQUIRE(testDb.checkIntegrity(Database::IntegrityCheck::Full));
+
+    SECTION("Check in steps")
+    {
+        db::IntegrityCheckJob job{testDb};
+        REQUIRE(job.getStatus() == db::IntegrityCheckJob::Status::Pending);
+
+        // Zero budget checks exactly one table per step
+        REQUIRE(job.step(std::chrono::milliseconds::zero()) == db::IntegrityCheckJob::Status::InProgress);
+        REQUIRE(job.getProgress() == 50);
+        REQUIRE(job.step(std::chrono::milliseconds::zero()) == db::IntegrityCheckJob::Status::Passed);
+        REQUIRE(job.getProgress() == 100);
+
+        const auto state = db::IntegrityCheckState::load(testDb.getName());
+        REQUIRE(state.result == db::IntegrityCheckState::Result::Passed);
+    }
+
+    SECTION("Large table in steps")
+    {
+        constexpr auto rows = db::IntegrityCheckJob::largeTableRows + db::IntegrityCheckJob::rowsPerStep;
+        REQUIRE(testDb.execute("WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < %d) "
+                               "INSERT INTO second(value) SELECT 'value ' || i FROM n;",
+                               rows));
+
+        db::IntegrityCheckJob job{testDb};
+        auto steps = 0;
+        while (job.step(std::chrono::milliseconds::zero()) == db::IntegrityCheckJob::Status::InProgress) {
+            REQUIRE(job.getProgress() < 100);
+            ++steps;
+        }
+        REQUIRE(job.getStatus() == db::IntegrityCheckJob::Status::Passed);
+        // first table, parts of the rows of second and the check of its index sizes
+        REQUIRE(steps > rows / db::IntegrityCheckJob::rowsPerStep);
+
+        // checking in parts is no PRAGMA integrity_check, so it must not postpone the startup check
+        auto state = db::IntegrityCheckState::load(testDb.getName());
+        REQUIRE(state.result == db::IntegrityCheckState::Result::Partial);
+        REQUIRE(state.isCheckNeeded(std::time(nullptr)));
+
+        // the age of the last full check is kept
+        const auto fullCheckAt = std::time(nullptr) - 3600;
+        REQUIRE(db::IntegrityCheckState{db::IntegrityCheckState::Result::Passed, fullCheckAt}.store(testDb.getName()));
+        db::IntegrityCheckJob nextJob{testDb};
+        while (nextJob.step(std::chrono::seconds{1}) == db::IntegrityCheckJob::Status::InProgress) {}
+        state = db::IntegrityCheckState::load(testDb.getName());
+        REQUIRE(state.result == db::IntegrityCheckState::Result::Partial);
+        REQUIRE(state.checkedAt == fullCheckAt);
+        REQUIRE(!state.isCheckNeeded(std::time(nullptr)));
+    }
+
+    SECTION("Cancel")
+    {
+        db::IntegrityCheckJob job{testDb};
+        job.step(std::chrono::milliseconds::zero());
+        job.cancel();
+        REQUIRE(job.isFinished());
+        REQUIRE(job.step(std::chrono::seconds{1}) == db::IntegrityCheckJob::Status::Cancelled);
+    }
+
+    std::filesystem::remove(db::IntegrityCheckState::getStatePath(testDb.getName()));
+}
@@ -161,6 +161,47 @@ TEST_CASE("Multimedia DB tests")
             REQUIRE((resultPre.ID == resultPost.ID && resultPre.fileInfo.mediaType == resultPost.fileInfo.mediaType));
         }
 
+        SECTION("Loudness")
+        {
+            REQUIRE_FALSE(db.get().files.getById(1).loudness.has_value());
+            REQUIRE(db.get().files.getNextWithoutLoudness(0).ID == 1);
+
+            const auto loudness = Loudness{.integrated = -1432, .peak = -21};
+            REQUIRE(db.get().files.setLoudness(records[0].fileInfo.path, loudness));
+            auto result = db.get().files.getById(1);
+            REQUIRE(result.loudness.has_value());
+            REQUIRE(result.loudness->integrated == loudness.integrated);
+            REQUIRE(result.loudness->peak == loudness.peak);
+
+            REQUIRE(db.get().files.getNextWithoutLoudness(0).ID == 2);
+            REQUIRE(db.get().files.getNextWithoutLoudness(5).ID == 6);
+            REQUIRE_FALSE(db.get().files.getNextWithoutLoudness(records.size()).isValid());
+
+            SECTION("Update keeps the loudness")
+            {
+                result.tags.title = "new title";
+                REQUIRE(db.get().files.update(result));
+                REQUIRE(db.get().files.getById(1).loudness.has_value());
+            }
+
+            SECTION("Adding the file again clears the loudness")
+            {
+                REQUIRE(db.get().files.add(records[0]));
+                REQUIRE_FALSE(db.get().files.getById(1).loudness.has_value());
+                REQUIRE(db.get().files.getNextWithoutLoudness(0).ID == 1);
+            }
+
+            SECTION("Failed analysis is not retried")
+            {
+                REQUIRE(db.get().files.setLoudnessFailed(records[1].fileInfo.path));
+                REQUIRE_FALSE(db.get().files.getById(2).loudness.has_value());
+                REQUIRE(db.get().files.getNextWithoutLoudness(0).ID == 3);
+
+                REQUIRE(db.get().files.add(records[1]));
+                REQUIRE(db.get().files.getNextWithoutLoudness(0).ID == 2);
+            }
+        }
+
         SECTION("Add or Update")
         {
             REQUIRE(db.get().files.removeAll());
@@ -523,6 +564,41 @@ TEST_CASE("Multimedia DB tests")
             REQUIRE((resultPre.ID == resultPost.ID && resultPre.fileInfo.mediaType == resultPost.fileInfo.mediaType));
         }
 
+        SECTION("Loudness")
+        {
+            auto setLoudnessQuery = [&](const std::string &path, const Loudness &loudness) {
+                const auto query  = std::make_shared<db::multimedia_files::query::SetLoudness>(path, loudness);
+                const auto ret    = multimediaFilesRecordInterface.runQuery(query);
+                const auto result = dynamic_cast<db::multimedia_files::query::EditResult *>(ret.get());
+                REQUIRE(result != nullptr);
+                REQUIRE(result->getResult());
+            };
+            auto getNextWithoutLoudnessQuery = [&](uint32_t afterId) {
+                const auto query  = std::make_shared<db::multimedia_files::query::GetNextWithoutLoudness>(afterId);
+                const auto ret    = multimediaFilesRecordInterface.runQuery(query);
+                const auto result = dynamic_cast<db::multimedia_files::query::GetResult *>(ret.get());
+                REQUIRE(result != nullptr);
+                return result->getResult();
+            };
+
+            auto setLoudnessFailedQuery = [&](const std::string &path) {
+                const auto query  = std::make_shared<db::multimedia_files::query::SetLoudnessFailed>(path);
+                const auto ret    = multimediaFilesRecordInterface.runQuery(query);
+                const auto result = dynamic_cast<db::multimedia_files::query::EditResult *>(ret.get());
+                REQUIRE(result != nullptr);
+                REQUIRE(result->getResult());
+            };
+
+            setLoudnessFailedQuery(records[0].fileInfo.path);
+            for (std::size_t i = 1; i < records.size(); ++i) {
+                REQUIRE(getNextWithoutLoudnessQuery(0).fileInfo.path == records[i].fileInfo.path);
+                setLoudnessQuery(records[i].fileInfo.path, Loudness{.integrated = -1800, .peak = -100});
+            }
+            REQUIRE_FALSE(getNextWithoutLoudnessQuery(0).isValid());
+            REQUIRE(getByPathQuery(records[3].fileInfo.path).loudness->integrated == -1800);
+            REQUIRE_FALSE(getByPathQuery(records[0].fileInfo.path).loudness.has_value());
+        }
+
         SECTION("Add or Update")
         {
             removeAllQuery();
@@ -28,6 +28,7 @@ task.h is included from an application file. */
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "usermem.h"
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
@@ -94,6 +95,14 @@ static void prvInsertBlockIntoFreeList( BlockLink_t *pxBlockToInsert );
  */
 static void prvHeapInit( void );
 
+#if (configUSER_HEAP_STATS == 1)
+/*
+ * Updates the memory held by the task, has to be called with the scheduler
+ * suspended.
+ */
+static void prvUpdateTaskUsage( TaskHandle_t xTask, size_t xAllocated, size_t xFreed );
+#endif
+
 /*-----------------------------------------------------------*/
 
 /* The size of the structure placed at the beginning of each allocated memory
@@ -127,6 +136,13 @@ static size_t xAllocatedMin = SIZE_MAX;
 static size_t xAllocatedMax = 0;
 static size_t xAllocatedSum = 0;
 
+#if (configUSER_HEAP_STATS == 1)
+/* Per task allocations, entries of tasks holding no memory are reused */
+#define usermemTRACKED_TASKS 64
+static UserMemTaskUsage xTaskUsage[usermemTRACKED_TASKS];
+static size_t xTrackedTasks = 0;
+#endif
+
 /* Gets set to the top bit of an size_t type.  When this bit in the xBlockSize
 member of an BlockLink_t structure is set then the block belongs to the
 application.  When the bit is free the block is still part of the free heap
@@ -273,6 +289,7 @@ void *usermalloc(size_t xWantedSize)
 #endif // configUSER_HEAP_EXTENDED_STATS
                         pxBlock->xAllocatingTask = xTaskGetCurrentTaskHandle();
                         pxBlock->xTimeAllocated  = xTaskGetTickCount();
+                        prvUpdateTaskUsage( pxBlock->xAllocatingTask, pxBlock->xBlockSize & ~xBlockAllocatedBit, 0 );
 #endif // configUSER_HEAP_STATS
 
 #if (PROJECT_CONFIG_HEAP_INTEGRITY_CHECKS != 0)
@@ -374,6 +391,9 @@ void userfree(void *pv)
 
 						/* Add this block to the list of free blocks. */
 						xUserFreeBytesRemaining += pxLink->xBlockSize;
+#if (configUSER_HEAP_STATS == 1)
+						prvUpdateTaskUsage( pxLink->xAllocatingTask, 0, pxLink->xBlockSize );
+#endif
 						traceFREE( pv, pxLink->xBlockSize );
 						prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
 #if (configUSER_HEAP_STATS == 1 && configUSER_HEAP_EXTENDED_STATS == 1)
@@ -487,6 +507,80 @@ size_t usermemGetAllocatedSum(void)
 	return xAllocatedSum;
 }
 
+size_t usermemGetTaskUsage(UserMemTaskUsage *usage, size_t count)
+{
+    size_t copied = 0;
+#if (configUSER_HEAP_STATS == 1)
+    vTaskSuspendAll();
+    {
+        for (size_t i = 0; i < xTrackedTasks && copied < count; ++i) {
+            if (xTaskUsage[i].peakAllocated != 0) {
+                usage[copied++] = xTaskUsage[i];
+            }
+        }
+    }
+    (void)xTaskResumeAll();
+#else
+    (void)usage;
+    (void)count;
+#endif
+    return copied;
+}
+
+void usermemResetTaskPeaks(void)
+{
+#if (configUSER_HEAP_STATS == 1)
+    vTaskSuspendAll();
+    {
+        for (size_t i = 0; i < xTrackedTasks; ++i) {
+            xTaskUsage[i].peakAllocated = xTaskUsage[i].allocated;
+        }
+    }
+    (void)xTaskResumeAll();
+#endif
+}
+
+#if (configUSER_HEAP_STATS == 1)
+static void prvUpdateTaskUsage( TaskHandle_t xTask, size_t xAllocated, size_t xFreed )
+{
+    UserMemTaskUsage *pxUsage = NULL;
+    UserMemTaskUsage *pxUnused = NULL;
+
+    for (size_t i = 0; i < xTrackedTasks; ++i) {
+        if (xTaskUsage[i].task == xTask) {
+            pxUsage = &xTaskUsage[i];
+            break;
+        }
+        if (pxUnused == NULL && xTaskUsage[i].peakAllocated == 0) {
+            pxUnused = &xTaskUsage[i];
+        }
+    }
+
+    if (pxUsage == NULL) {
+        if (xFreed != 0) {
+            /* Allocated while all the entries were taken, so it was not attributed */
+            return;
+        }
+        if (pxUnused == NULL && xTrackedTasks < usermemTRACKED_TASKS) {
+            pxUnused = &xTaskUsage[xTrackedTasks++];
+        }
+        if (pxUnused == NULL) {
+            /* More tasks than tracked ones hold memory, the allocation is not attributed */
+            return;
+        }
+        pxUsage = pxUnused;
+        pxUsage->task = xTask;
+        pxUsage->allocated = 0;
+    }
+
+    pxUsage->allocated += xAllocated;
+    pxUsage->allocated -= (xFreed < pxUsage->allocated) ? xFreed : pxUsage->allocated;
+    if (pxUsage->allocated > pxUsage->peakAllocated) {
+        pxUsage->peakAllocated = pxUsage->allocated;
+    }
+}
+#endif
+
 /*-----------------------------------------------------------*/
 
 static void prvHeapInit( void )
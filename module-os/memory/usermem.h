@@ -33,6 +33,19 @@ size_t usermemGetAllocatedSum(void);
 
 void *userrealloc(void *pv, size_t xWantedSize);
 
+/* Heap held by a single task, tracked when configUSER_HEAP_STATS is enabled */
+typedef struct
+{
+    void *task;           /* Handle of the allocating task, NULL before the scheduler starts */
+    size_t allocated;     /* Bytes held by the task now */
+    size_t peakAllocated; /* The most bytes held by the task since usermemResetTaskPeaks() */
+} UserMemTaskUsage;
+
+/* Copies up to count entries of the tasks holding heap or having held it, returns the number of entries copied */
+size_t usermemGetTaskUsage(UserMemTaskUsage *usage, size_t count);
+/* Starts the next high-water mark period, the peaks are set to the current allocations */
+void usermemResetTaskPeaks(void);
+
 #ifdef __cplusplus
 }
 #endif
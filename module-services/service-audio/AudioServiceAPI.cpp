@@ -7,6 +7,7 @@
 
 #include <Audio/decoder/Decoder.hpp>
 #include <log/log.hpp>
+#include <Service/MessagePool.hpp>
 #include <system/Common.hpp>
 
 #include <utility>
@@ -47,9 +48,9 @@ namespace AudioServiceAPI
         return serv->bus.sendUnicast(msg, service::name::audio);
     }
 
-    bool RecordingStart(sys::Service *serv, const std::string &fileName)
+    bool RecordingStart(sys::Service *serv, const std::string &fileName, audio::RecordingFormat recordingFormat)
     {
-        auto msg = std::make_shared<AudioStartRecorderRequest>(fileName);
+        auto msg = std::make_shared<AudioStartRecorderRequest>(fileName, recordingFormat);
         return serv->bus.sendUnicast(msg, service::name::audio);
     }
 
@@ -94,13 +95,13 @@ namespace AudioServiceAPI
 
     bool SendEvent(sys::Service *serv, std::shared_ptr<audio::Event> evt)
     {
-        auto msg = std::make_shared<AudioEventRequest>(std::move(evt));
+        auto msg = sys::makePooled<AudioEventRequest>(std::move(evt));
         return serv->bus.sendUnicast(msg, service::name::audio);
     }
 
     bool SendEvent(sys::Service *serv, audio::EventType eType, audio::Event::DeviceState state)
     {
-        auto msg = std::make_shared<AudioEventRequest>(eType, state);
+        auto msg = sys::makePooled<AudioEventRequest>(eType, state);
         return serv->bus.sendUnicast(msg, service::name::audio);
     }
 
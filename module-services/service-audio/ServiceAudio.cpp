@@ -5,12 +5,16 @@
 #include <ServiceAudio.hpp>
 
 #include <Audio/Operation/IdleOperation.hpp>
+#include <Audio/loudness/LoudnessMeter.hpp>
 #include <Bluetooth/audio/BluetoothAudioDevice.hpp>
 #include <module-audio/Audio/VolumeScaler.hpp>
 #include <system/messages/SentinelRegistrationMessage.hpp>
 #include <service-bluetooth/BluetoothMessage.hpp>
 #include <service-bluetooth/ServiceBluetoothName.hpp>
 #include <service-bluetooth/messages/AudioNotify.hpp>
+#include <module-db/queries/multimedia_files/QueryMultimediaFilesGet.hpp>
+#include <service-db/DBServiceAPI.hpp>
+#include <service-db/QueryMessage.hpp>
 #include <service-db/Settings.hpp>
 #include <service-evtmgr/EventManagerServiceAPI.hpp>
 #include <Utils.hpp>
@@ -131,6 +135,13 @@ ServiceAudio::ServiceAudio()
             [this](sys::Message *msg) -> sys::MessagePointer { return handleMultimediaAudioStart(); });
     connect(typeid(SingleVibrationStart),
             [this](sys::Message *msg) -> sys::MessagePointer { return handleSingleVibrationStart(); });
+    connect(typeid(db::QueryResponse), [](sys::Message *msg) -> sys::MessagePointer {
+        const auto result = static_cast<db::QueryResponse *>(msg)->getResult();
+        if (result != nullptr && result->hasListener()) {
+            result->handle();
+        }
+        return sys::msgHandled();
+    });
 }
 
 ServiceAudio::~ServiceAudio()
@@ -217,6 +228,29 @@ std::optional<std::string> ServiceAudio::AudioServicesCallback(const sys::Messag
     return std::nullopt;
 };
 
+void ServiceAudio::requestPlaybackGain(const Token &token, const std::string &filePath)
+{
+    auto query = std::make_unique<db::multimedia_files::query::GetByPath>(filePath);
+    query->setQueryListener(db::QueryCallback::fromFunction([this, token](auto response) {
+        const auto result = dynamic_cast<db::multimedia_files::query::GetResult *>(response);
+        if (result == nullptr) {
+            return false;
+        }
+        const auto input  = audioMux.GetInput(token);
+        const auto record = result->getResult();
+        if (!input || !record.loudness.has_value()) {
+            return true;
+        }
+
+        // stored in hundredths of LUFS and dBFS
+        const auto gain = loudness::playbackGain(loudness::Measurement{
+            .integrated = record.loudness->integrated / 100.0f, .peak = record.loudness->peak / 100.0f});
+        (*input)->audio->SetLoudnessGain(gain);
+        return true;
+    }));
+    DBServiceAPI::GetQuery(this, db::Interface::Name::MultimediaFiles, std::move(query));
+}
+
 sys::ReturnCodes ServiceAudio::SwitchPowerModeHandler(const sys::ServicePowerMode mode)
 {
     return sys::ReturnCodes::Success;
@@ -403,7 +437,8 @@ std::unique_ptr<AudioResponseMessage> ServiceAudio::HandleResume(const Token &to
 
 std::unique_ptr<AudioResponseMessage> ServiceAudio::HandleStart(const Operation::Type opType,
                                                                 const std::string fileName,
-                                                                const audio::PlaybackType &playbackType)
+                                                                const audio::PlaybackType &playbackType,
+                                                                const audio::RecordingFormat &recordingFormat)
 {
     auto retCode  = audio::RetCode::Failed;
     auto retToken = Token::MakeBadToken();
@@ -417,7 +452,8 @@ std::unique_ptr<AudioResponseMessage> ServiceAudio::HandleStart(const Operation:
 
             if (IsOperationEnabled(playbackType, opType)) {
                 try {
-                    retCode = (*input)->audio->Start(opType, retToken, fileName, playbackType);
+                    retCode = (*input)->audio->Start(
+                        opType, retToken, fileName, playbackType, audio::PlaybackMode::Single, recordingFormat);
                 }
                 catch (const AudioInitException &audioException) {
                     retCode = audio::RetCode::FailedToAllocateMemory;
@@ -443,6 +479,10 @@ std::unique_ptr<AudioResponseMessage> ServiceAudio::HandleStart(const Operation:
         }
 
         AudioStart(input);
+        // playback starts at unity gain, the loudness normalization applies once the database replies
+        if (retCode == audio::RetCode::Success && playbackType == audio::PlaybackType::Multimedia) {
+            requestPlaybackGain(retToken, fileName);
+        }
         return std::make_unique<AudioStartPlaybackResponse>(retCode, retToken);
     }
     if (opType == Operation::Type::Recorder) {
@@ -692,7 +732,8 @@ sys::MessagePointer ServiceAudio::DataReceivedHandler(sys::DataMessage *msgl, sy
     }
     else if (msgType == typeid(AudioStartRecorderRequest)) {
         auto *msg   = static_cast<AudioStartRecorderRequest *>(msgl);
-        responseMsg = HandleStart(Operation::Type::Recorder, msg->fileName);
+        responseMsg = HandleStart(
+            Operation::Type::Recorder, msg->fileName, audio::PlaybackType::None, msg->recordingFormat);
     }
     else if (msgType == typeid(AudioStartRoutingRequest)) {
         responseMsg = HandleStart(Operation::Type::Router);
@@ -195,10 +195,13 @@ class AudioRoutingNotification : public AudioMessage
 class AudioStartRecorderRequest : public AudioMessage
 {
   public:
-    AudioStartRecorderRequest(const std::string &fileName) : fileName(fileName)
+    AudioStartRecorderRequest(const std::string &fileName,
+                              audio::RecordingFormat recordingFormat = audio::RecordingFormat::Pcm)
+        : fileName(fileName), recordingFormat(recordingFormat)
     {}
 
     const std::string fileName;
+    const audio::RecordingFormat recordingFormat;
 };
 
 class AudioStartRecorderResponse : public AudioResponseMessage
@@ -296,6 +299,12 @@ class VolumeChanged : public sys::DataMessage, public app::manager::actions::Con
             std::make_unique<gui::VolumePopupRequestParams>(volume, context, source));
     }
 
+    /// Only the latest volume of a context is shown
+    [[nodiscard]] bool supersedes(const sys::Message &queued) const noexcept override
+    {
+        return static_cast<const VolumeChanged &>(queued).context == context;
+    }
+
   private:
     const audio::Volume volume;
     audio::Context context;
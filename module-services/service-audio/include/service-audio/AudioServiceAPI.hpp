@@ -45,10 +45,13 @@ namespace AudioServiceAPI
      *
      * @param serv Requesting service.
      * @param fileName Path to file where recording is to be saved.
+     * @param recordingFormat Encoding of the samples, IMA ADPCM takes a quarter of the PCM size.
      * @return True if request has been sent successfully, false otherwise
      *  Response will come as message AudioStartRecordingResponse
      */
-    bool RecordingStart(sys::Service *serv, const std::string &fileName);
+    bool RecordingStart(sys::Service *serv,
+                        const std::string &fileName,
+                        audio::RecordingFormat recordingFormat = audio::RecordingFormat::Pcm);
     /**
      * @brief Starts routing. Asynchronous call.
      *
@@ -69,10 +69,13 @@ class ServiceAudio : public sys::Service
     }
 
     auto AudioServicesCallback(const sys::Message *msg) -> std::optional<std::string>;
+    //! Looks up the loudness of an indexed file without blocking and applies the normalization gain to the playback
+    void requestPlaybackGain(const audio::Token &token, const std::string &filePath);
 
     auto HandleStart(const audio::Operation::Type opType,
-                     const std::string                       = "",
-                     const audio::PlaybackType &playbackType = audio::PlaybackType::None)
+                     const std::string                             = "",
+                     const audio::PlaybackType &playbackType       = audio::PlaybackType::None,
+                     const audio::RecordingFormat &recordingFormat = audio::RecordingFormat::Pcm)
         -> std::unique_ptr<AudioResponseMessage>;
     auto HandleStop(const std::vector<audio::PlaybackType> &stopTypes, const audio::Token &token)
         -> std::unique_ptr<AudioResponseMessage>;
@@ -1025,6 +1025,12 @@ namespace cellular
         explicit CallDurationNotification(const std::time_t duration)
             : sys::DataMessage(MessageType::MessageTypeUninitialized), callDuration(duration){};
         std::time_t callDuration;
+
+        /// Sent every second of a call, only the latest duration is shown
+        [[nodiscard]] bool supersedes([[maybe_unused]] const sys::Message &queued) const noexcept override
+        {
+            return true;
+        }
     };
     class CallerIdMessage : public CellularMessage
     {
@@ -6,6 +6,7 @@
 #include "service-db/QueryMessage.hpp"
 
 #include <BaseInterface.hpp>
+#include <Service/MessagePool.hpp>
 #include <Service/Service.hpp>
 
 #include <memory>
@@ -20,7 +21,7 @@ std::pair<bool, std::uint64_t> DBServiceAPI::GetQuery(sys::Service *serv,
                                                       db::Interface::Name database,
                                                       std::unique_ptr<db::Query> query)
 {
-    auto msg             = std::make_shared<db::QueryMessage>(database, std::move(query));
+    auto msg             = sys::makePooled<db::QueryMessage>(database, std::move(query));
     const auto isSuccess = serv->bus.sendUnicast(msg, service::name::db);
     return std::make_pair(isSuccess, msg->uniID);
 }
@@ -30,6 +31,6 @@ sys::SendResult DBServiceAPI::GetQueryWithReply(sys::Service *serv,
                                                 std::unique_ptr<db::Query> query,
                                                 std::uint32_t timeout)
 {
-    auto msg = std::make_shared<db::QueryMessage>(database, std::move(query));
+    auto msg = sys::makePooled<db::QueryMessage>(database, std::move(query));
     return serv->bus.sendUnicastSync(std::move(msg), service::name::db, timeout);
 }
@@ -0,0 +1,64 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <service-db/NotificationBatcher.hpp>
+
+#include <Service/MessagePool.hpp>
+
+#include <algorithm>
+
+namespace db
+{
+    NotificationBatcher::NotificationBatcher(std::size_t maxRecordIds) : maxRecordIds(maxRecordIds)
+    {}
+
+    bool NotificationBatcher::add(Interface::Name interface, Query::Type type, std::optional<std::uint32_t> recordId)
+    {
+        const auto isNewBatch = pending.empty();
+        auto it               = std::find_if(pending.begin(), pending.end(), [&](const Pending &entry) {
+            return entry.interface == interface && entry.type == type;
+        });
+        if (it == pending.end()) {
+            it = pending.insert(pending.end(), Pending{interface, type});
+        }
+        auto &entry = *it;
+        ++entry.changes;
+
+        if (!recordId.has_value()) {
+            // Receivers can't tell which records changed, they have to reload anyway
+            entry.allRecords = true;
+        }
+        else {
+            entry.recordIds.insert(*recordId);
+            full = full || entry.recordIds.size() >= maxRecordIds;
+        }
+        return isNewBatch;
+    }
+
+    std::vector<std::shared_ptr<NotificationMessage>> NotificationBatcher::flush()
+    {
+        std::vector<std::shared_ptr<NotificationMessage>> messages;
+        messages.reserve(pending.size());
+        for (const auto &entry : pending) {
+            messages.push_back(sys::makePooled<NotificationMessage>(
+                entry.interface,
+                entry.type,
+                std::vector<std::uint32_t>(entry.recordIds.begin(), entry.recordIds.end()),
+                entry.changes,
+                entry.allRecords));
+        }
+        pending.clear();
+        full = false;
+        return messages;
+    }
+
+    bool NotificationBatcher::empty() const noexcept
+    {
+        return pending.empty();
+    }
+
+    bool NotificationBatcher::isFull() const noexcept
+    {
+        return full;
+    }
+} // namespace db
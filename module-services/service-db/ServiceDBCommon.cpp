@@ -2,20 +2,45 @@
 // For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
 
 #include <service-db/DBNotificationMessage.hpp>
+#include <service-db/DBServiceMessage.hpp>
 #include <service-db/DBServiceName.hpp>
 #include <service-db/QueryMessage.hpp>
 #include <service-db/ServiceDBCommon.hpp>
 
 #include <purefs/filesystem_paths.hpp>
 #include <log/log.hpp>
+#include <Service/MessagePool.hpp>
+#include <Timers/TimerFactory.hpp>
 
 namespace
 {
-    constexpr auto serviceDbStackSize = 1024 * 24;
-}
+    constexpr auto serviceDbStackSize      = 1024 * 24;
+    constexpr auto notificationBatchWindow = std::chrono::milliseconds{100};
+
+    // Background integrity check is started once the boot settles down and runs in short steps, so that queries
+    // from applications are delayed by at most a single step
+    constexpr auto integrityCheckStartDelay   = std::chrono::minutes{3};
+    constexpr auto integrityCheckStepInterval = std::chrono::milliseconds{500};
+    constexpr auto integrityCheckStepBudget   = std::chrono::milliseconds{50};
+
+    // Write-ahead logs are copied into the databases once no transaction has been committed for this long
+    constexpr auto checkpointIdleTime = std::chrono::seconds{5};
+
+    // Sync package databases are copied in short steps, queries from applications are handled in between
+    constexpr auto syncPackageStepInterval = std::chrono::milliseconds{20};
+    constexpr auto syncPackagePagesPerStep = 32;
+} // namespace
 
 ServiceDBCommon::ServiceDBCommon() : sys::Service(service::name::db, "", serviceDbStackSize, sys::ServicePriority::Idle)
 {
+    notificationFlushTimer = sys::TimerFactory::createSingleShotTimer(
+        this, "DBNotificationFlush", notificationBatchWindow, [this](sys::Timer &) { flushUpdateNotifications(); });
+    integrityCheckTimer = sys::TimerFactory::createSingleShotTimer(
+        this, "DBIntegrityCheck", integrityCheckStartDelay, [this](sys::Timer &) { runIntegrityCheckStep(); });
+    checkpointTimer = sys::TimerFactory::createSingleShotTimer(
+        this, "DBCheckpoint", checkpointIdleTime, [this](sys::Timer &) { runIdleCheckpoints(); });
+    syncPackageTimer = sys::TimerFactory::createSingleShotTimer(
+        this, "DBSyncPackage", syncPackageStepInterval, [this](sys::Timer &) { runSyncPackageStep(); });
 }
 
 db::Interface *ServiceDBCommon::getInterface(db::Interface::Name interface)
@@ -63,6 +88,10 @@ sys::MessagePointer ServiceDBCommon::DataReceivedHandler(sys::DataMessage *msgl,
 
 sys::ReturnCodes ServiceDBCommon::InitHandler()
 {
+    // Full checks are run in the background, see scheduleIntegrityCheck
+    Database::setStartupIntegrityCheck(Database::IntegrityCheck::Auto);
+    // Commits only append to the log and sync it once, see enableIdleCheckpoints
+    Database::setJournalMode(Database::JournalMode::Wal);
     if (const auto isSuccess = Database::initialize(); !isSuccess) {
         LOG_ERROR("Failed to initialize");
 
@@ -74,6 +103,13 @@ sys::ReturnCodes ServiceDBCommon::InitHandler()
 
 sys::ReturnCodes ServiceDBCommon::DeinitHandler()
 {
+    flushUpdateNotifications();
+    cancelIntegrityChecks();
+    if (!syncPackageJobs.empty()) {
+        finishSyncPackage(false);
+    }
+    runIdleCheckpoints();
+
     for (auto &dbAgent : databaseAgents) {
         dbAgent->unRegisterMessages();
     }
@@ -96,6 +132,142 @@ void ServiceDBCommon::sendUpdateNotification(db::Interface::Name interface,
                                              db::Query::Type type,
                                              std::optional<std::uint32_t> recordId)
 {
-    auto notificationMessage = std::make_shared<db::NotificationMessage>(interface, type, recordId);
-    bus.sendMulticast(notificationMessage, sys::BusChannel::ServiceDBNotifications);
+    if (type == db::Query::Type::Read) {
+        auto notificationMessage = sys::makePooled<db::NotificationMessage>(interface, type, recordId);
+        bus.sendMulticast(notificationMessage, sys::BusChannel::ServiceDBNotifications);
+        return;
+    }
+
+    const auto isNewBatch = notificationBatcher.add(interface, type, recordId);
+    if (notificationBatcher.isFull()) {
+        flushUpdateNotifications();
+    }
+    else if (isNewBatch) {
+        notificationFlushTimer.start();
+    }
+}
+
+void ServiceDBCommon::flushUpdateNotifications()
+{
+    notificationFlushTimer.stop();
+    for (auto &notificationMessage : notificationBatcher.flush()) {
+        bus.sendMulticast(std::move(notificationMessage), sys::BusChannel::ServiceDBNotifications);
+    }
+}
+
+void ServiceDBCommon::scheduleIntegrityCheck(Database *database)
+{
+    if (database == nullptr) {
+        return;
+    }
+    const auto state = db::IntegrityCheckState::load(database->getName());
+    if (!state.isCheckNeeded(std::time(nullptr))) {
+        return;
+    }
+    integrityCheckQueue.push_back(database);
+    if (!integrityCheckTimer.isActive() && integrityCheckJob == nullptr) {
+        integrityCheckTimer.restart(integrityCheckStartDelay);
+    }
+}
+
+void ServiceDBCommon::runIntegrityCheckStep()
+{
+    if (integrityCheckJob == nullptr) {
+        if (integrityCheckQueue.empty()) {
+            return;
+        }
+        integrityCheckJob = std::make_unique<db::IntegrityCheckJob>(*integrityCheckQueue.front());
+        integrityCheckQueue.pop_front();
+    }
+
+    integrityCheckJob->step(integrityCheckStepBudget);
+    LOG_DEBUG("Integrity check of %s: %u%%",
+              integrityCheckJob->getDatabase().getName().c_str(),
+              integrityCheckJob->getProgress());
+    if (integrityCheckJob->isFinished()) {
+        integrityCheckJob.reset();
+        if (integrityCheckQueue.empty()) {
+            return;
+        }
+    }
+    integrityCheckTimer.restart(integrityCheckStepInterval);
+}
+
+void ServiceDBCommon::cancelIntegrityChecks()
+{
+    integrityCheckTimer.stop();
+    integrityCheckQueue.clear();
+    if (integrityCheckJob != nullptr) {
+        integrityCheckJob->cancel();
+        integrityCheckJob.reset();
+    }
+}
+
+void ServiceDBCommon::enableIdleCheckpoints(Database *database)
+{
+    if (database == nullptr || !database->isWalEnabled()) {
+        return;
+    }
+    database->setWalCommitCallback([this](std::size_t) { checkpointTimer.restart(checkpointIdleTime); });
+    checkpointDatabases.push_back(database);
+}
+
+void ServiceDBCommon::runIdleCheckpoints()
+{
+    checkpointTimer.stop();
+    for (const auto database : checkpointDatabases) {
+        if (database->getPendingWalFrames() == 0) {
+            continue;
+        }
+        LOG_DEBUG("Checkpoint of %s: %zu frames", database->getName().c_str(), database->getPendingWalFrames());
+        database->checkpoint();
+    }
+}
+
+bool ServiceDBCommon::startSyncPackage(std::initializer_list<Database *> databases,
+                                       const std::filesystem::path &path,
+                                       const std::string &requester)
+{
+    if (!syncPackageJobs.empty()) {
+        LOG_ERROR("Sync package is already being prepared");
+        return false;
+    }
+    for (const auto database : databases) {
+        syncPackageJobs.push_back(std::make_unique<db::BackupJob>(
+            *database, path / std::filesystem::path(database->getName()).filename()));
+    }
+    syncPackagePath      = path;
+    syncPackageRequester = requester;
+    syncPackageTimer.restart(syncPackageStepInterval);
+    return true;
+}
+
+void ServiceDBCommon::runSyncPackageStep()
+{
+    if (syncPackageJobs.empty()) {
+        return;
+    }
+    auto &job = *syncPackageJobs.front();
+    job.step(syncPackagePagesPerStep);
+    if (job.getStatus() == db::BackupJob::Status::Failed) {
+        LOG_ERROR("Store %s in sync package failed", job.getDatabase().getName().c_str());
+        finishSyncPackage(false);
+        return;
+    }
+    if (job.isFinished()) {
+        syncPackageJobs.pop_front();
+        if (syncPackageJobs.empty()) {
+            finishSyncPackage(true);
+            return;
+        }
+    }
+    syncPackageTimer.restart(syncPackageStepInterval);
+}
+
+void ServiceDBCommon::finishSyncPackage(bool success)
+{
+    syncPackageTimer.stop();
+    syncPackageJobs.clear();
+    bus.sendUnicast(std::make_shared<DBServiceMessageSyncPackageResult>(syncPackagePath.string(), success),
+                    syncPackageRequester);
 }
@@ -10,16 +10,36 @@
 #include <module-db/Interface/BaseInterface.hpp>
 
 #include <memory>
+#include <vector>
+
 namespace db
 {
     class NotificationMessage : public sys::DataMessage
     {
       public:
         NotificationMessage(db::Interface::Name interface, Query::Type type, std::optional<uint32_t> recordId);
+        /// Batched notification - recordIds have to be sorted and unique
+        NotificationMessage(db::Interface::Name interface,
+                            Query::Type type,
+                            std::vector<std::uint32_t> recordIds,
+                            std::uint32_t changes,
+                            bool allRecords);
+
         const db::Interface::Name interface;
         const Query::Type type;
+        /// Set only when exactly one record was changed
         const std::optional<uint32_t> recordId;
+        /// Sorted ids of all changed records, incomplete when allRecords is set
+        const std::vector<std::uint32_t> recordIds;
+        /// Number of queries folded into this notification
+        const std::uint32_t changes;
+        /// Too many or unknown records changed to list them - receivers should reload everything
+        const bool allRecords;
 
         bool dataModified();
+        [[nodiscard]] bool isBatch() const noexcept;
+        [[nodiscard]] bool contains(std::uint32_t id) const;
+        /// A queued notification of the same interface and kind is replaced if this one covers all its records
+        [[nodiscard]] bool supersedes(const sys::Message &queued) const noexcept override;
     };
 } // namespace db
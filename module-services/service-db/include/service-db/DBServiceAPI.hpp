@@ -112,6 +112,8 @@ class DBServiceAPI
     [[deprecated]] static auto CalllogRemove(sys::Service *serv, uint32_t id) -> bool;
     [[deprecated]] static auto CalllogUpdate(sys::Service *serv, const CalllogRecord &rec) -> bool;
 
+    /// Starts copying the databases into the sync package directory, returns false if the copy couldn't be started.
+    /// The outcome is sent back to the calling service in DBServiceMessageSyncPackageResult.
     static auto DBPrepareSyncPackage(sys::Service *serv, const std::string &syncPackagePath) -> bool;
 
     static auto IsContactInFavourites(sys::Service *serv, const utils::PhoneNumber::View &numberView) -> bool;
@@ -24,6 +24,14 @@ class DBServiceMessageSyncPackage : public DBMessage
     std::string syncPackagePath;
 };
 
+class DBServiceMessageSyncPackageResult : public DBMessage
+{
+  public:
+    DBServiceMessageSyncPackageResult(const std::string &syncPackagePath, bool success);
+    std::string syncPackagePath;
+    bool success;
+};
+
 class DBServiceResponseMessage : public DBResponseMessage
 {
   public:
@@ -25,6 +25,11 @@ class DatabaseAgent
     virtual void unRegisterMessages()                              = 0;
     [[nodiscard]] virtual auto getAgentName() -> const std::string = 0;
 
+    [[nodiscard]] Database *getDatabase() const noexcept
+    {
+        return database.get();
+    }
+
     static constexpr auto ZERO_ROWS_FOUND = 0;
     static constexpr auto ONE_ROW_FOUND   = 1;
 
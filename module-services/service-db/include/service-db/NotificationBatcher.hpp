@@ -0,0 +1,47 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include "DBNotificationMessage.hpp"
+
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace db
+{
+    /// Accumulates data change notifications, so that a burst of modifying queries is published as a single
+    /// NotificationMessage per interface and kind of change instead of one message per query
+    class NotificationBatcher
+    {
+      public:
+        static constexpr std::size_t defaultMaxRecordIds = 64;
+
+        explicit NotificationBatcher(std::size_t maxRecordIds = defaultMaxRecordIds);
+
+        /// Returns true if the change opened a new batch, i.e. the caller should schedule a flush
+        bool add(Interface::Name interface, Query::Type type, std::optional<std::uint32_t> recordId);
+        /// Returns the pending notifications and starts a new batch
+        [[nodiscard]] std::vector<std::shared_ptr<NotificationMessage>> flush();
+        [[nodiscard]] bool empty() const noexcept;
+        /// The batch reached its capacity and should be flushed without waiting
+        [[nodiscard]] bool isFull() const noexcept;
+
+      private:
+        struct Pending
+        {
+            Interface::Name interface;
+            Query::Type type;
+            std::set<std::uint32_t> recordIds;
+            std::uint32_t changes = 0;
+            bool allRecords       = false;
+        };
+
+        const std::size_t maxRecordIds;
+        /// Kept in order of the first change of each kind, so receivers are notified in the order the changes
+        /// happened; a batch holds only a handful of kinds, so a linear lookup is enough
+        std::vector<Pending> pending;
+        bool full = false;
+    };
+} // namespace db
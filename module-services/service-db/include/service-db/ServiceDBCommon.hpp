@@ -4,10 +4,16 @@
 #pragma once
 
 #include <module-db/Common/Query.hpp>
+#include <module-db/Database/BackupJob.hpp>
+#include <module-db/Database/IntegrityCheck.hpp>
 #include <module-db/Interface/BaseInterface.hpp>
 #include <service-db/DatabaseAgent.hpp>
+#include <service-db/NotificationBatcher.hpp>
+#include <Timers/TimerHandle.hpp>
 
+#include <deque>
 #include <set>
+#include <vector>
 
 class ServiceDBCommon : public sys::Service
 {
@@ -15,6 +21,35 @@ class ServiceDBCommon : public sys::Service
     virtual db::Interface *getInterface(db::Interface::Name interface);
     std::set<std::unique_ptr<DatabaseAgent>> databaseAgents;
 
+    /// Queues a full integrity check of the database to be run in the background, if it wasn't checked recently
+    void scheduleIntegrityCheck(Database *database);
+    /// Checkpoints the write-ahead log of the database once the service has been idle for a while
+    void enableIdleCheckpoints(Database *database);
+    /// Copies the databases into the sync package directory in the background, a few pages at a time. The requester
+    /// gets DBServiceMessageSyncPackageResult once all copies are done. Fails if a sync package is already being made.
+    bool startSyncPackage(std::initializer_list<Database *> databases,
+                          const std::filesystem::path &path,
+                          const std::string &requester);
+
+  private:
+    void runIntegrityCheckStep();
+    void cancelIntegrityChecks();
+    void runIdleCheckpoints();
+    void runSyncPackageStep();
+    void finishSyncPackage(bool success);
+
+    db::NotificationBatcher notificationBatcher;
+    sys::TimerHandle notificationFlushTimer;
+    std::deque<Database *> integrityCheckQueue;
+    std::unique_ptr<db::IntegrityCheckJob> integrityCheckJob;
+    sys::TimerHandle integrityCheckTimer;
+    std::vector<Database *> checkpointDatabases;
+    sys::TimerHandle checkpointTimer;
+    std::deque<std::unique_ptr<db::BackupJob>> syncPackageJobs;
+    std::filesystem::path syncPackagePath;
+    std::string syncPackageRequester;
+    sys::TimerHandle syncPackageTimer;
+
   public:
     ServiceDBCommon();
 
@@ -26,5 +61,8 @@ class ServiceDBCommon : public sys::Service
 
     sys::ReturnCodes SwitchPowerModeHandler(sys::ServicePowerMode mode) final;
 
+    /// Data modifications are coalesced and published after a short window, reads are published immediately
     void sendUpdateNotification(db::Interface::Name interface, db::Query::Type type, std::optional<uint32_t> recordId);
+    /// Publishes all pending data modification notifications right away, e.g. at the end of a bulk operation
+    void flushUpdateNotifications();
 };
@@ -7,16 +7,52 @@
 #include <Common/Query.hpp>
 #include <MessageType.hpp>
 
+#include <algorithm>
+
 namespace db
 {
     NotificationMessage::NotificationMessage(db::Interface::Name interface,
                                              Query::Type type,
                                              std::optional<uint32_t> recordId)
-        : sys::DataMessage(MessageType::DBServiceNotification), interface(interface), type(type), recordId(recordId)
+        : sys::DataMessage(MessageType::DBServiceNotification), interface(interface), type(type), recordId(recordId),
+          recordIds(recordId.has_value() ? std::vector<std::uint32_t>{*recordId} : std::vector<std::uint32_t>{}),
+          changes(1), allRecords(!recordId.has_value())
+    {}
+
+    NotificationMessage::NotificationMessage(db::Interface::Name interface,
+                                             Query::Type type,
+                                             std::vector<std::uint32_t> recordIds,
+                                             std::uint32_t changes,
+                                             bool allRecords)
+        : sys::DataMessage(MessageType::DBServiceNotification), interface(interface), type(type),
+          recordId(recordIds.size() == 1 && !allRecords ? std::optional<std::uint32_t>{recordIds.front()}
+                                                        : std::nullopt),
+          recordIds(std::move(recordIds)), changes(changes), allRecords(allRecords)
     {}
 
     bool NotificationMessage::dataModified()
     {
         return type == db::Query::Type::Create || type == db::Query::Type::Update || type == db::Query::Type::Delete;
     }
+
+    bool NotificationMessage::isBatch() const noexcept
+    {
+        return changes > 1;
+    }
+
+    bool NotificationMessage::contains(std::uint32_t id) const
+    {
+        return allRecords || std::binary_search(recordIds.begin(), recordIds.end(), id);
+    }
+
+    bool NotificationMessage::supersedes(const sys::Message &queued) const noexcept
+    {
+        const auto &other = static_cast<const NotificationMessage &>(queued);
+        if (other.interface != interface || other.type != type) {
+            return false;
+        }
+        return allRecords ||
+               (!other.allRecords &&
+                std::includes(recordIds.begin(), recordIds.end(), other.recordIds.begin(), other.recordIds.end()));
+    }
 } // namespace db
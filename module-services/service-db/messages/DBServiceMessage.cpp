@@ -11,5 +11,9 @@ DBServiceMessageSyncPackage::DBServiceMessageSyncPackage(MessageType messageType
     : DBMessage(messageType), syncPackagePath(syncPackagePath)
 {}
 
+DBServiceMessageSyncPackageResult::DBServiceMessageSyncPackageResult(const std::string &syncPackagePath, bool success)
+    : DBMessage(MessageType::DBSyncPackageResult), syncPackagePath(syncPackagePath), success(success)
+{}
+
 DBServiceResponseMessage::DBServiceResponseMessage(uint32_t retCode, uint32_t count, MessageType respTo)
     : DBResponseMessage(retCode, count, respTo){};
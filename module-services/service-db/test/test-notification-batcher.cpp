@@ -0,0 +1,112 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <service-db/NotificationBatcher.hpp>
+
+using db::Interface;
+using db::Query;
+
+TEST_CASE("Notification batcher - coalescing")
+{
+    db::NotificationBatcher batcher;
+    REQUIRE(batcher.empty());
+
+    SECTION("Single change")
+    {
+        REQUIRE(batcher.add(Interface::Name::Contact, Query::Type::Update, 7));
+        const auto messages = batcher.flush();
+        REQUIRE(messages.size() == 1);
+        REQUIRE(messages.front()->interface == Interface::Name::Contact);
+        REQUIRE(messages.front()->type == Query::Type::Update);
+        REQUIRE(messages.front()->recordId == 7);
+        REQUIRE(!messages.front()->isBatch());
+        REQUIRE(!messages.front()->allRecords);
+        REQUIRE(batcher.empty());
+    }
+
+    SECTION("Burst of changes of one kind")
+    {
+        REQUIRE(batcher.add(Interface::Name::Contact, Query::Type::Create, 3));
+        REQUIRE(!batcher.add(Interface::Name::Contact, Query::Type::Create, 1));
+        REQUIRE(!batcher.add(Interface::Name::Contact, Query::Type::Create, 2));
+        REQUIRE(!batcher.add(Interface::Name::Contact, Query::Type::Create, 1));
+
+        const auto messages = batcher.flush();
+        REQUIRE(messages.size() == 1);
+        const auto &message = *messages.front();
+        REQUIRE(message.isBatch());
+        REQUIRE(message.changes == 4);
+        REQUIRE(!message.recordId.has_value());
+        REQUIRE(message.recordIds == std::vector<std::uint32_t>{1, 2, 3});
+        REQUIRE(message.contains(2));
+        REQUIRE(!message.contains(4));
+    }
+
+    SECTION("Different interfaces and kinds are kept apart")
+    {
+        batcher.add(Interface::Name::SMS, Query::Type::Create, 1);
+        batcher.add(Interface::Name::SMS, Query::Type::Delete, 2);
+        batcher.add(Interface::Name::SMSThread, Query::Type::Update, 1);
+        REQUIRE(batcher.flush().size() == 3);
+    }
+
+    SECTION("Kinds are flushed in order of their first change")
+    {
+        batcher.add(Interface::Name::SMSThread, Query::Type::Update, 1);
+        batcher.add(Interface::Name::SMS, Query::Type::Delete, 2);
+        batcher.add(Interface::Name::SMS, Query::Type::Create, 3);
+        batcher.add(Interface::Name::SMSThread, Query::Type::Update, 4);
+
+        const auto messages = batcher.flush();
+        REQUIRE(messages.size() == 3);
+        REQUIRE(messages[0]->interface == Interface::Name::SMSThread);
+        REQUIRE(messages[0]->changes == 2);
+        REQUIRE(messages[1]->interface == Interface::Name::SMS);
+        REQUIRE(messages[1]->type == Query::Type::Delete);
+        REQUIRE(messages[2]->interface == Interface::Name::SMS);
+        REQUIRE(messages[2]->type == Query::Type::Create);
+    }
+
+    SECTION("Unknown record id")
+    {
+        batcher.add(Interface::Name::Calllog, Query::Type::Delete, 5);
+        batcher.add(Interface::Name::Calllog, Query::Type::Delete, std::nullopt);
+
+        const auto messages = batcher.flush();
+        REQUIRE(messages.size() == 1);
+        REQUIRE(messages.front()->allRecords);
+        REQUIRE(messages.front()->contains(100));
+        REQUIRE(messages.front()->recordIds == std::vector<std::uint32_t>{5});
+    }
+}
+
+TEST_CASE("Notification batcher - capacity")
+{
+    constexpr auto maxRecordIds = 4;
+    db::NotificationBatcher batcher{maxRecordIds};
+
+    for (std::uint32_t id = 0; id < maxRecordIds - 1; ++id) {
+        batcher.add(Interface::Name::MultimediaFiles, Query::Type::Create, id);
+        REQUIRE(!batcher.isFull());
+    }
+    batcher.add(Interface::Name::MultimediaFiles, Query::Type::Create, maxRecordIds);
+    REQUIRE(batcher.isFull());
+
+    const auto messages = batcher.flush();
+    REQUIRE(messages.size() == 1);
+    REQUIRE(messages.front()->recordIds.size() == maxRecordIds);
+    REQUIRE(!batcher.isFull());
+}
+
+TEST_CASE("Notification supersedes queued ones it covers")
+{
+    const db::NotificationMessage queued{Interface::Name::SMS, Query::Type::Update, {1, 2}, 2, false};
+
+    REQUIRE(db::NotificationMessage{Interface::Name::SMS, Query::Type::Update, {1, 2, 3}, 3, false}.supersedes(queued));
+    REQUIRE(db::NotificationMessage{Interface::Name::SMS, Query::Type::Update, std::nullopt}.supersedes(queued));
+    REQUIRE_FALSE(db::NotificationMessage{Interface::Name::SMS, Query::Type::Update, 2}.supersedes(queued));
+    REQUIRE_FALSE(db::NotificationMessage{Interface::Name::SMS, Query::Type::Delete, std::nullopt}.supersedes(queued));
+    REQUIRE_FALSE(
+        db::NotificationMessage{Interface::Name::SMSThread, Query::Type::Update, std::nullopt}.supersedes(queued));
+}
@@ -57,10 +57,11 @@ void OutboxNotifications::newNotificationHandler(db::NotificationMessage *notifi
         break;
     }
 
-    if (entryType != Outbox::EntryType::INVALID && entryChange != Outbox::EntryChange::INVALID &&
-        notificationMessage->recordId) {
-        Outbox::NotificationEntry newNotificationEntry = {
-            notificationCurrentUid++, entryType, entryChange, *notificationMessage->recordId};
+    if (entryType == Outbox::EntryType::INVALID || entryChange == Outbox::EntryChange::INVALID) {
+        return;
+    }
+    for (const auto recordId : notificationMessage->recordIds) {
+        Outbox::NotificationEntry newNotificationEntry = {notificationCurrentUid++, entryType, entryChange, recordId};
         notificationEntries.emplace_back(newNotificationEntry);
     }
 }
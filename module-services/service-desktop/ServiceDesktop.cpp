@@ -44,6 +44,7 @@ auto ServiceDesktop::InitHandler() -> sys::ReturnCodes
     connectHandler<message::bluetooth::ResponseVisibleDevices>();
     connectHandler<sdesktop::developerMode::DeveloperModeRequest>();
     connectHandler<sdesktop::SyncMessage>();
+    connectHandler<DBServiceMessageSyncPackageResult>();
     connectHandler<sdesktop::FactoryMessage>();
     connectHandler<sdesktop::usb::USBConfigured>();
     connectHandler<sdesktop::usb::USBDisconnected>();
@@ -304,7 +305,22 @@ auto ServiceDesktop::handle(sdesktop::developerMode::DeveloperModeRequest *msg)
 auto ServiceDesktop::handle([[maybe_unused]] sdesktop::SyncMessage *msg) -> std::shared_ptr<sys::Message>
 {
     syncStatus.state          = Sync::OperationState::Running;
-    syncStatus.completionCode = Sync::PrepareSyncPackage(this, syncStatus.tempDir);
+    syncStatus.completionCode = Sync::StartSyncPackage(this, syncStatus.tempDir);
+
+    if (syncStatus.completionCode != Sync::CompletionCode::Success) {
+        LOG_ERROR("Sync package preparation failed");
+        syncStatus.state = Sync::OperationState::Error;
+    }
+
+    return sys::MessageNone{};
+}
+
+auto ServiceDesktop::handle(DBServiceMessageSyncPackageResult *msg) -> std::shared_ptr<sys::Message>
+{
+    if (syncStatus.state != Sync::OperationState::Running) {
+        return sys::MessageNone{};
+    }
+    syncStatus.completionCode = Sync::FinishSyncPackage(syncStatus.tempDir, msg->success);
 
     if (syncStatus.completionCode == Sync::CompletionCode::Success) {
         LOG_INFO("Sync package preparation finished");
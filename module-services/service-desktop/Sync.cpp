@@ -20,7 +20,7 @@ static bool isValidDirentry(const std::filesystem::directory_entry &direntry)
     return direntry.path() != "." && direntry.path() != ".." && direntry.path() != "...";
 }
 
-Sync::CompletionCode Sync::PrepareSyncPackage(sys::Service *ownerService, std::filesystem::path &path)
+Sync::CompletionCode Sync::StartSyncPackage(sys::Service *ownerService, const std::filesystem::path &path)
 {
     assert(ownerService != nullptr);
     LOG_DEBUG("Sync package preparation started");
@@ -39,6 +39,17 @@ Sync::CompletionCode Sync::PrepareSyncPackage(sys::Service *ownerService, std::f
         return CompletionCode::DBError;
     }
 
+    return CompletionCode::Success;
+}
+
+Sync::CompletionCode Sync::FinishSyncPackage(const std::filesystem::path &path, bool databasesCopied)
+{
+    if (!databasesCopied) {
+        LOG_ERROR("Copying databases into sync package failed, quiting");
+        Sync::RemoveSyncDir(path);
+        return CompletionCode::DBError;
+    }
+
     LOG_DEBUG("Packing files");
     if (!Sync::PackSyncFiles(path)) {
         LOG_ERROR("Failed pack sync files");
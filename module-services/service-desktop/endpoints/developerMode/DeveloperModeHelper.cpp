@@ -23,6 +23,10 @@
 
 #include <service-db/agents/settings/SystemSettings.hpp>
 #include <service-db/DBServiceAPI.hpp>
+#include <Service/BusTrace.hpp>
+#include <Service/SystemMetrics.hpp>
+#include <Audio/StreamTelemetry.hpp>
+#include <purefs/filesystem_paths.hpp>
 #include <endpoints/developerMode/event/ATRequest.hpp>
 #include <service-appmgr/Controller.hpp>
 
@@ -208,6 +212,15 @@ namespace sdesktop::endpoints
                     return {Sent::Delayed, std::nullopt};
                 }
             }
+            else if (keyValue == json::developerMode::busTraceInfo) {
+                return dumpBusTrace();
+            }
+            else if (keyValue == json::developerMode::systemMetricsInfo) {
+                return getSystemMetrics(body);
+            }
+            else if (keyValue == json::developerMode::audioStreamsInfo) {
+                return getAudioStreams();
+            }
             else {
                 return {Sent::No, ResponseContext{.status = http::Code::BadRequest}};
             }
@@ -351,6 +364,95 @@ namespace sdesktop::endpoints
         return {Sent::Delayed, std::nullopt};
     }
 
+    auto DeveloperModeHelper::dumpBusTrace() -> ProcessResult
+    {
+        // Stored next to the logs, so that it can be listed and downloaded the same way
+        const auto path = purefs::dir::getLogsPath() / "bus_trace.bin";
+        if (!sys::trace::dumpBusTrace(path)) {
+            return {Sent::No, ResponseContext{.status = http::Code::NotAcceptable}};
+        }
+        auto response =
+            ResponseContext{.body = json11::Json::object({{json::developerMode::busTraceFilePath, path.string()}})};
+        response.status = http::Code::OK;
+        return {Sent::No, std::move(response)};
+    }
+
+    auto DeveloperModeHelper::getSystemMetrics(const json11::Json &body) -> ProcessResult
+    {
+        using namespace json::developerMode::systemMetrics;
+
+        // Whole ring unless a period in seconds is given
+        const auto period  = body[json::developerMode::period].int_value();
+        const auto summary = sys::metrics::summarize(period > 0 ? static_cast<std::uint32_t>(period) * 1000 : 0);
+
+        json11::Json::array taskList;
+        for (const auto &task : summary.tasks) {
+            taskList.push_back(json11::Json::object{{name, task.name},
+                                                    {cpuShare, static_cast<int>(task.cpuShare)},
+                                                    {heapPeak, static_cast<int>(task.heapPeak)}});
+        }
+        json11::Json::array residencyList;
+        for (const auto &level : summary.residency) {
+            residencyList.push_back(json11::Json::object{{frequency, static_cast<int>(level.frequency)},
+                                                         {time, static_cast<int>(level.time)}});
+        }
+        json11::Json::array sentinelList;
+        for (const auto &sentinel : summary.sentinels) {
+            sentinelList.push_back(json11::Json::object{{name, sentinel.name},
+                                                        {frequency, static_cast<int>(sentinel.frequency)},
+                                                        {wfiBlocked, sentinel.wfiBlocked}});
+        }
+
+        json11::Json::object metrics{{json::developerMode::period, static_cast<int>(summary.length / 1000)},
+                                     {windows, static_cast<int>(summary.windows)},
+                                     {tasks, std::move(taskList)},
+                                     {residency, std::move(residencyList)},
+                                     {sentinels, std::move(sentinelList)}};
+        auto response   = ResponseContext{.body = std::move(metrics)};
+        response.status = http::Code::OK;
+        return {Sent::No, std::move(response)};
+    }
+
+    auto DeveloperModeHelper::getAudioStreams() -> ProcessResult
+    {
+        using namespace json::developerMode::audioStreams;
+
+        const auto toArray = [](const auto &values, std::size_t count) {
+            json11::Json::array array;
+            for (std::size_t i = 0; i < count; ++i) {
+                array.push_back(static_cast<int>(values[i]));
+            }
+            return array;
+        };
+
+        json11::Json::array streamList;
+        for (const auto &report : audio::telemetry::getReports()) {
+            const auto &metrics = report.metrics;
+            streamList.push_back(json11::Json::object{
+                {name, report.name},
+                {active, report.active},
+                {timestamp, static_cast<int>(report.timestamp)},
+                {blocks, static_cast<int>(report.blockCount)},
+                {blockDuration, static_cast<int>(report.blockDuration.count())},
+                {duration, static_cast<int>(metrics.duration)},
+                {written, static_cast<int>(metrics.blocksWritten)},
+                {read, static_cast<int>(metrics.blocksRead)},
+                {underruns, static_cast<int>(metrics.underruns)},
+                {overruns, static_cast<int>(metrics.overruns)},
+                {fillLevels, toArray(metrics.fillLevels, metrics.fillLevels.size())},
+                {latencyMin, static_cast<int>(metrics.latencyMin)},
+                {latencyAverage, static_cast<int>(metrics.latencyAverage)},
+                {latencyMax, static_cast<int>(metrics.latencyMax)},
+                {maxWriteGap, static_cast<int>(metrics.maxWriteGap)},
+                {maxReadGap, static_cast<int>(metrics.maxReadGap)},
+                {recentUnderruns, toArray(metrics.recentUnderruns, metrics.recentUnderrunsCount)}});
+        }
+
+        auto response   = ResponseContext{.body = json11::Json::object{{streams, std::move(streamList)}}};
+        response.status = http::Code::OK;
+        return {Sent::No, std::move(response)};
+    }
+
     auto DeveloperModeHelper::requestServiceStateInfo(sys::Service *serv) -> bool
     {
         auto event = std::make_unique<sdesktop::developerMode::CellularStateInfoRequestEvent>();
@@ -21,6 +21,9 @@ namespace sdesktop::endpoints
         auto requestServiceStateInfo(sys::Service *serv) -> bool;
         auto requestCellularSleepModeInfo(sys::Service *serv) -> bool;
         auto prepareSMS(Context &context) -> ProcessResult;
+        auto dumpBusTrace() -> ProcessResult;
+        auto getSystemMetrics(const json11::Json &body) -> ProcessResult;
+        auto getAudioStreams() -> ProcessResult;
 
       public:
         explicit DeveloperModeHelper(sys::Service *p) : BaseHelper(p)
@@ -52,6 +55,44 @@ namespace sdesktop::endpoints
         inline constexpr auto switchApplication      = "switchApplication";
         inline constexpr auto switchWindow           = "switchWindow";
         inline constexpr auto phoneLockCodeEnabled   = "phoneLockCodeEnabled";
+        inline constexpr auto busTraceFilePath       = "busTraceFilePath";
+        inline constexpr auto period                 = "period";
+
+        namespace systemMetrics
+        {
+            inline constexpr auto windows    = "windows";
+            inline constexpr auto tasks      = "tasks";
+            inline constexpr auto residency  = "residency";
+            inline constexpr auto sentinels  = "sentinels";
+            inline constexpr auto name       = "name";
+            inline constexpr auto cpuShare   = "cpuShare";
+            inline constexpr auto heapPeak   = "heapPeak";
+            inline constexpr auto frequency  = "frequency";
+            inline constexpr auto time       = "time";
+            inline constexpr auto wfiBlocked = "wfiBlocked";
+        } // namespace systemMetrics
+
+        namespace audioStreams
+        {
+            inline constexpr auto streams         = "streams";
+            inline constexpr auto name            = "name";
+            inline constexpr auto active          = "active";
+            inline constexpr auto timestamp       = "timestamp";
+            inline constexpr auto blocks          = "blocks";
+            inline constexpr auto blockDuration   = "blockDuration";
+            inline constexpr auto duration        = "duration";
+            inline constexpr auto written         = "written";
+            inline constexpr auto read            = "read";
+            inline constexpr auto underruns       = "underruns";
+            inline constexpr auto overruns        = "overruns";
+            inline constexpr auto fillLevels      = "fillLevels";
+            inline constexpr auto latencyMin      = "latencyMin";
+            inline constexpr auto latencyAverage  = "latencyAverage";
+            inline constexpr auto latencyMax      = "latencyMax";
+            inline constexpr auto maxWriteGap     = "maxWriteGap";
+            inline constexpr auto maxReadGap      = "maxReadGap";
+            inline constexpr auto recentUnderruns = "recentUnderruns";
+        } // namespace audioStreams
 
         namespace switchData
         {
@@ -63,6 +104,9 @@ namespace sdesktop::endpoints
         inline constexpr auto simStateInfo          = "simState";
         inline constexpr auto cellularStateInfo     = "cellularState";
         inline constexpr auto cellularSleepModeInfo = "cellularSleepMode";
+        inline constexpr auto busTraceInfo          = "busTrace";
+        inline constexpr auto systemMetricsInfo     = "systemMetrics";
+        inline constexpr auto audioStreamsInfo      = "audioStreams";
 
         /// values for smsCommand
         inline constexpr auto smsAdd = "smsAdd";
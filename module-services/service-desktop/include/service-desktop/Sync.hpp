@@ -81,7 +81,10 @@ class Sync
         }
     };
 
-    static CompletionCode PrepareSyncPackage(sys::Service *ownerService, std::filesystem::path &path);
+    /// Prepares the sync directory and asks service-db to copy the databases into it in the background
+    static CompletionCode StartSyncPackage(sys::Service *ownerService, const std::filesystem::path &path);
+    /// Packs the copied databases, to be called when service-db reports the outcome of the copy
+    static CompletionCode FinishSyncPackage(const std::filesystem::path &path, bool databasesCopied);
 
   private:
     static bool RemoveSyncDir(const std::filesystem::path &path);
@@ -11,6 +11,7 @@
 
 #include <BaseInterface.hpp>
 #include <MessageType.hpp>
+#include <Service/MessagePool.hpp>
 #include <Service/Worker.hpp>
 #include <Timers/TimerFactory.hpp>
 #include <system/Constants.hpp>
@@ -129,7 +130,7 @@ sys::ReturnCodes EventManagerCommon::InitHandler()
         auto msg = static_cast<app::AppInputEventMessage *>(msgl);
         assert(msg);
 
-        auto message = std::make_shared<app::AppInputEventMessage>(msg->getEvent());
+        auto message = sys::makePooled<app::AppInputEventMessage>(msg->getEvent());
         if (!targetApplication.empty()) {
             bus.sendUnicast(std::move(message), targetApplication);
         }
@@ -228,7 +229,7 @@ bool EventManagerCommon::messageSetApplication(sys::Service *sender, const std::
 void EventManagerCommon::handleKeyEvent(sys::Message *msg)
 {
     auto kbdMessage = dynamic_cast<sevm::KbdMessage *>(msg);
-    auto message    = std::make_shared<sevm::KbdMessage>();
+    auto message    = sys::makePooled<sevm::KbdMessage>();
     message->key    = kbdMessage->key;
 
     debug_input_events("EVInput -> K:|%s|, S:|%s|, TP:|%d|, TR:|%d|, App:|%s|",
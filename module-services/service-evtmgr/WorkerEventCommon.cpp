@@ -8,6 +8,7 @@
 #include "battery/BatteryController.hpp"
 
 #include <MessageType.hpp>
+#include <Service/MessagePool.hpp>
 #include <Service/Worker.hpp>
 #include <bsp/rtc/rtc.hpp>
 #include <bsp/vibrator/vibrator.hpp>
@@ -152,7 +153,7 @@ bool WorkerEventCommon::deinit()
 
 void WorkerEventCommon::sendKeyUnicast(RawKey const &key)
 {
-    auto message = std::make_shared<sevm::KbdMessage>();
+    auto message = sys::makePooled<sevm::KbdMessage>();
     message->key = key;
     service->bus.sendUnicast(std::move(message), service::name::evt_manager);
 }
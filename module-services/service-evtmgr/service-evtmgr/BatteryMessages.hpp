@@ -9,7 +9,14 @@
 namespace sevm
 {
     class BatteryStatusChangeMessage : public sys::DataMessage
-    {};
+    {
+      public:
+        /// Receivers read the current status from the store, so the latest message is enough
+        [[nodiscard]] bool supersedes([[maybe_unused]] const sys::Message &queued) const noexcept override
+        {
+            return true;
+        }
+    };
 
     class BatteryStateChangeMessage : public sys::DataMessage
     {
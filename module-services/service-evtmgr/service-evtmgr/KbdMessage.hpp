@@ -9,10 +9,10 @@
 
 namespace sevm
 {
-    class KbdMessage : public sys::DataMessage
+    class KbdMessage : public sys::TypedMessage<KbdMessage>
     {
       public:
-        KbdMessage() : DataMessage(MessageType::KBDKeyEvent)
+        KbdMessage() : TypedMessage(MessageType::KBDKeyEvent)
         {}
         RawKey key = {};
     };
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <algorithm>
+#include <chrono>
 #include <filesystem>
 #include <array>
 
@@ -12,6 +13,10 @@ namespace service::detail
 {
     namespace fs = std::filesystem;
 
+    // Pacing of the background indexing, a single entry or slice of work is processed per interval
+    constexpr auto indexing_interval = std::chrono::milliseconds{50};
+    constexpr auto start_delay       = std::chrono::milliseconds{10000};
+
     // File extensions indexing allow list
     constexpr std::array<std::string_view, 3> allowed_exts{".wav", ".mp3", ".flac"};
 
@@ -2,6 +2,7 @@
 // For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
 
 #include <service-fileindexer/InotifyHandler.hpp>
+#include <service-fileindexer/LoudnessIndexer.hpp>
 
 #include "Common.hpp"
 
@@ -17,6 +18,9 @@
 
 namespace service::detail
 {
+    InotifyHandler::InotifyHandler(LoudnessIndexer &loudnessIndexer) : loudnessIndexer{loudnessIndexer}
+    {}
+
     InotifyHandler::~InotifyHandler()
     {
         for (const auto &path : monitoredPaths) {
@@ -156,6 +160,8 @@ namespace service::detail
         if (record.has_value()) {
             auto query = std::make_unique<db::multimedia_files::query::Add>(record.value());
             DBServiceAPI::GetQuery(svc.get(), db::Interface::Name::MultimediaFiles, std::move(query));
+            // the query is handled before the loudness indexer asks for the files to analyze
+            loudnessIndexer.rescan();
         }
         else {
             LOG_WARN("File corrupted, skipping.");
@@ -176,6 +182,7 @@ namespace service::detail
             return;
         }
 
+        loudnessIndexer.onRemove(path);
         auto query = std::make_unique<db::multimedia_files::query::RemoveByPath>(std::string(path));
         DBServiceAPI::GetQuery(svc.get(), db::Interface::Name::MultimediaFiles, std::move(query));
     }
@@ -0,0 +1,185 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "Common.hpp"
+#include <service-fileindexer/LoudnessIndexer.hpp>
+
+#include <Audio/decoder/Decoder.hpp>
+#include <Audio/loudness/LoudnessMeter.hpp>
+#include <Timers/TimerFactory.hpp>
+#include <log/log.hpp>
+#include <module-db/queries/multimedia_files/QueryMultimediaFilesEdit.hpp>
+#include <module-db/queries/multimedia_files/QueryMultimediaFilesGet.hpp>
+#include <service-db/DBServiceAPI.hpp>
+#include <service-db/QueryMessage.hpp>
+
+#include <cmath>
+
+namespace service::detail
+{
+    namespace
+    {
+        constexpr auto dbQueryTimeout = 5000U;
+
+        auto getNextWithoutLoudness(sys::Service *svc, std::uint32_t afterId)
+            -> std::optional<db::multimedia_files::MultimediaFilesRecord>
+        {
+            auto query = std::make_unique<db::multimedia_files::query::GetNextWithoutLoudness>(afterId);
+            const auto [status, response] = DBServiceAPI::GetQueryWithReply(
+                svc, db::Interface::Name::MultimediaFiles, std::move(query), dbQueryTimeout);
+            if (status != sys::ReturnCodes::Success || !response) {
+                return std::nullopt;
+            }
+            const auto queryResponse = dynamic_cast<db::QueryResponse *>(response.get());
+            if (queryResponse == nullptr) {
+                return std::nullopt;
+            }
+            const auto result    = queryResponse->getResult();
+            const auto getResult = dynamic_cast<db::multimedia_files::query::GetResult *>(result.get());
+            if (getResult == nullptr || !getResult->getResult().isValid()) {
+                return std::nullopt;
+            }
+            return getResult->getResult();
+        }
+
+        auto toHundredths(float value) -> std::int32_t
+        {
+            return static_cast<std::int32_t>(std::lround(value * 100.0f));
+        }
+    } // namespace
+
+    LoudnessIndexer::LoudnessIndexer() = default;
+
+    LoudnessIndexer::~LoudnessIndexer() = default;
+
+    auto LoudnessIndexer::start(std::shared_ptr<sys::Service> service, std::string_view svc_name) -> void
+    {
+        svc    = std::move(service);
+        mTimer = sys::TimerFactory::createSingleShotTimer(
+            svc.get(), std::string(svc_name) + "_loudness", start_delay, [this](auto &) { onTimerTimeout(); });
+        mForceStop = false;
+        mTimer.start();
+    }
+
+    void LoudnessIndexer::rescan()
+    {
+        lastId = 0;
+        if (!mForceStop && mTimer.isValid() && !mTimer.isActive()) {
+            mTimer.restart(indexing_interval);
+        }
+    }
+
+    void LoudnessIndexer::onRemove(std::string_view path)
+    {
+        if (decoder != nullptr && currentPath == path) {
+            LOG_INFO("Loudness indexer: file removed during analysis");
+            closeFile();
+        }
+    }
+
+    void LoudnessIndexer::stop()
+    {
+        mForceStop = true;
+        mTimer.stop();
+        closeFile();
+    }
+
+    auto LoudnessIndexer::onTimerTimeout() -> void
+    {
+        if (mForceStop) {
+            return;
+        }
+        if (decoder == nullptr && !openNextFile()) {
+            LOG_INFO("Loudness indexer: Finished");
+            return;
+        }
+
+        switch (analyzeSlice()) {
+        case SliceResult::InProgress:
+            break;
+        case SliceResult::Finished:
+            storeResult();
+            closeFile();
+            break;
+        case SliceResult::Failed:
+            LOG_WARN("Loudness indexer: decoding failed, skipping file");
+            storeFailure();
+            closeFile();
+            break;
+        }
+
+        mTimer.restart(indexing_interval);
+    }
+
+    auto LoudnessIndexer::openNextFile() -> bool
+    {
+        while (const auto record = getNextWithoutLoudness(svc.get(), lastId)) {
+            lastId      = record->ID;
+            currentPath = record->fileInfo.path;
+
+            decoder = audio::Decoder::Create(currentPath);
+            if (decoder == nullptr) {
+                LOG_WARN("Loudness indexer: cannot decode file, skipping");
+                storeFailure();
+                continue;
+            }
+            try {
+                meter = std::make_unique<audio::loudness::LoudnessMeter>(decoder->getSampleRate(),
+                                                                         decoder->getChannelCount());
+            }
+            catch (const std::invalid_argument &e) {
+                LOG_WARN("Loudness indexer: %s, skipping file", e.what());
+                storeFailure();
+                closeFile();
+                continue;
+            }
+            buffer.resize(framesPerRead * decoder->getChannelCount());
+            return true;
+        }
+        return false;
+    }
+
+    auto LoudnessIndexer::analyzeSlice() -> SliceResult
+    {
+        const auto channels = decoder->getChannelCount();
+        for (std::size_t frames = 0; frames < framesPerSlice;) {
+            const auto samples = decoder->decode(buffer.size(), buffer.data());
+            if (samples < 0) {
+                return SliceResult::Failed;
+            }
+            if (samples == 0) {
+                return SliceResult::Finished;
+            }
+            meter->process(buffer.data(), samples / channels);
+            frames += samples / channels;
+        }
+        return SliceResult::InProgress;
+    }
+
+    auto LoudnessIndexer::storeResult() -> void
+    {
+        const auto measurement = meter->getMeasurement();
+        LOG_DEBUG("Loudness indexer: %.2f LUFS, peak %.2f dBFS", measurement.integrated, measurement.peak);
+
+        const auto loudness = db::multimedia_files::Loudness{.integrated = toHundredths(measurement.integrated),
+                                                             .peak       = toHundredths(measurement.peak)};
+        auto query          = std::make_unique<db::multimedia_files::query::SetLoudness>(currentPath, loudness);
+        DBServiceAPI::GetQuery(svc.get(), db::Interface::Name::MultimediaFiles, std::move(query));
+    }
+
+    auto LoudnessIndexer::storeFailure() -> void
+    {
+        // skipped by the next scans too, until the file is added again
+        auto query = std::make_unique<db::multimedia_files::query::SetLoudnessFailed>(currentPath);
+        DBServiceAPI::GetQuery(svc.get(), db::Interface::Name::MultimediaFiles, std::move(query));
+    }
+
+    void LoudnessIndexer::closeFile()
+    {
+        decoder.reset();
+        meter.reset();
+        buffer.clear();
+        buffer.shrink_to_fit();
+        currentPath.clear();
+    }
+} // namespace service::detail
@@ -9,7 +9,8 @@
 
 namespace
 {
-    constexpr auto fileIndexerServiceStackSize = 1024 * 5;
+    // Loudness analysis decodes the files, which needs as much stack as the decoder worker
+    constexpr auto fileIndexerServiceStackSize = 1024 * 12;
 } // namespace
 
 namespace service
@@ -36,6 +37,7 @@ namespace service
 
             // Start the initial indexer
             mStartupIndexer.start(shared_from_this(), service::name::file_indexer);
+            mLoudnessIndexer.start(shared_from_this(), service::name::file_indexer);
             return sys::ReturnCodes::Success;
         }
 
@@ -57,6 +59,7 @@ namespace service
 
     void ServiceFileIndexer::ProcessCloseReason(sys::CloseReason closeReason)
     {
+        mLoudnessIndexer.stop();
         if (closeReason == sys::CloseReason::FactoryReset) {
             mStartupIndexer.reset();
         }
@@ -20,9 +20,7 @@ namespace service::detail
     using namespace std::literals;
     using namespace std::chrono_literals;
 
-    const auto lock_file_name        = purefs::dir::getSystemVarDirPath() / ".directory_is_indexed";
-    constexpr auto indexing_interval = 50ms;
-    constexpr auto start_delay       = 10000ms;
+    const auto lock_file_name = purefs::dir::getSystemVarDirPath() / ".directory_is_indexed";
 
     bool isDirectoryFullyTraversed(const std::filesystem::recursive_directory_iterator &directory)
     {
@@ -17,10 +17,12 @@ namespace purefs::fs
 
 namespace service::detail
 {
+    class LoudnessIndexer;
+
     class InotifyHandler
     {
       public:
-        InotifyHandler() = default;
+        explicit InotifyHandler(LoudnessIndexer &loudnessIndexer);
         ~InotifyHandler();
         InotifyHandler(const InotifyHandler &)  = delete;
         InotifyHandler(const InotifyHandler &&) = delete;
@@ -35,6 +37,7 @@ namespace service::detail
       private:
         std::shared_ptr<purefs::fs::inotify> mfsNotifier;
         std::shared_ptr<sys::Service> svc;
+        LoudnessIndexer &loudnessIndexer;
         std::vector<std::string_view> monitoredPaths;
 
         // On update or create content
@@ -0,0 +1,73 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <Service/Service.hpp>
+#include <Timers/TimerHandle.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace audio
+{
+    class Decoder;
+    namespace loudness
+    {
+        class LoudnessMeter;
+    }
+} // namespace audio
+
+namespace service::detail
+{
+    /// Measures the loudness of the indexed files which have no result yet and stores it in the multimedia DB, so
+    /// that the playback can normalize the volume without analyzing anything. Files are decoded in the background,
+    /// a slice per indexing interval, to keep the CPU load low. Files that can't be decoded are marked as failed, so
+    /// that a rescan doesn't decode them again.
+    class LoudnessIndexer
+    {
+      public:
+        LoudnessIndexer();
+        ~LoudnessIndexer();
+        LoudnessIndexer(const LoudnessIndexer &) = delete;
+        LoudnessIndexer &operator=(const LoudnessIndexer &) = delete;
+
+        auto start(std::shared_ptr<sys::Service> svc, std::string_view svc_name) -> void;
+        // Looks for files without the loudness again, to be called when a file is added or modified
+        void rescan();
+        // Abandons the file being analyzed if it was removed
+        void onRemove(std::string_view path);
+        void stop();
+
+      private:
+        enum class SliceResult
+        {
+            InProgress,
+            Finished,
+            Failed
+        };
+
+        // Number of frames decoded per timer tick, about 100 ms of audio
+        static constexpr std::size_t framesPerSlice = 4608;
+        static constexpr std::size_t framesPerRead  = 1152;
+
+        auto onTimerTimeout() -> void;
+        auto openNextFile() -> bool;
+        auto analyzeSlice() -> SliceResult;
+        auto storeResult() -> void;
+        auto storeFailure() -> void;
+        void closeFile();
+
+        std::shared_ptr<sys::Service> svc;
+        sys::TimerHandle mTimer;
+        bool mForceStop{};
+
+        std::uint32_t lastId{};
+        std::string currentPath;
+        std::unique_ptr<audio::Decoder> decoder;
+        std::unique_ptr<audio::loudness::LoudnessMeter> meter;
+        std::vector<std::int16_t> buffer;
+    };
+} // namespace service::detail
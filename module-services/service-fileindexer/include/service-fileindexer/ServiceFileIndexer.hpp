@@ -9,6 +9,7 @@
 #include "ServiceFileIndexerName.hpp"
 #include "StartupIndexer.hpp"
 #include "InotifyHandler.hpp"
+#include "LoudnessIndexer.hpp"
 
 namespace service
 {
@@ -27,7 +28,8 @@ namespace service
         void ProcessCloseReason(sys::CloseReason closeReason) override;
 
       private:
-        detail::InotifyHandler mInotifyHandler;
+        detail::LoudnessIndexer mLoudnessIndexer;
+        detail::InotifyHandler mInotifyHandler{mLoudnessIndexer};
         detail::StartupIndexer mStartupIndexer;
     };
 
@@ -5,6 +5,7 @@
 
 #include <DrawCommand.hpp>
 #include <log/log.hpp>
+#include <Service/MessagePool.hpp>
 #include <Service/Worker.hpp>
 #include <service-gui/ServiceGUI.hpp>
 
@@ -70,7 +71,7 @@ namespace service::gui
 
     void WorkerGUI::onRenderingFinished(int contextId, ::gui::RefreshModes refreshMode)
     {
-        auto msg = std::make_shared<service::gui::RenderingFinished>(contextId, refreshMode);
+        auto msg = sys::makePooled<service::gui::RenderingFinished>(contextId, refreshMode);
         guiService->bus.sendUnicast(std::move(msg), guiService->GetName());
     }
 
@@ -0,0 +1,80 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "BusLatencyBenchmark.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace service::test
+{
+    namespace
+    {
+        constexpr std::uint32_t echoStackSize = 2048;
+        constexpr std::uint32_t echoTimeoutMs = 1000;
+    } // namespace
+
+    EchoService::EchoService(std::size_t noisePerRequest)
+        : sys::Service(service::name::service_test_echo, "", echoStackSize), noisePerRequest{noisePerRequest}
+    {
+        connect(typeid(EchoRequest), [this](sys::Message *request) -> sys::MessagePointer {
+            for (std::size_t i = 0; i < this->noisePerRequest; ++i) {
+                bus.sendUnicast(std::make_shared<NoiseMessage>(), request->sender);
+            }
+            return std::make_shared<EchoResponse>();
+        });
+    }
+
+    sys::ReturnCodes EchoService::InitHandler()
+    {
+        return sys::ReturnCodes::Success;
+    }
+
+    sys::ReturnCodes EchoService::DeinitHandler()
+    {
+        return sys::ReturnCodes::Success;
+    }
+
+    sys::ReturnCodes EchoService::SwitchPowerModeHandler(const sys::ServicePowerMode /*mode*/)
+    {
+        return sys::ReturnCodes::Success;
+    }
+
+    sys::MessagePointer EchoService::DataReceivedHandler(sys::DataMessage * /*msgl*/, sys::ResponseMessage * /*resp*/)
+    {
+        return std::make_shared<sys::ResponseMessage>(sys::ReturnCodes::Unresolved);
+    }
+
+    BusLatencyResult runBusLatencyBenchmark(sys::Service *caller, std::size_t iterations)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        BusLatencyResult result;
+        std::vector<std::chrono::microseconds> samples;
+        samples.reserve(iterations);
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            const auto start = Clock::now();
+            const auto ret   = caller->bus.sendUnicastSync(
+                std::make_shared<EchoRequest>(), service::name::service_test_echo, echoTimeoutMs);
+            const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+
+            if (ret.first != sys::ReturnCodes::Success) {
+                ++result.failures;
+                continue;
+            }
+            samples.push_back(elapsed);
+        }
+
+        result.iterations = iterations;
+        if (samples.empty()) {
+            return result;
+        }
+        std::sort(samples.begin(), samples.end());
+        result.min    = samples.front();
+        result.median = samples[samples.size() / 2];
+        result.p99    = samples[std::min(samples.size() - 1, samples.size() * 99 / 100)];
+        result.max    = samples.back();
+        return result;
+    }
+} // namespace service::test
@@ -0,0 +1,61 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <Service/Message.hpp>
+#include <Service/Service.hpp>
+
+#include <chrono>
+#include <cstddef>
+
+namespace service::name
+{
+    constexpr auto service_test_echo = "service-test-echo";
+}
+
+namespace service::test
+{
+    class EchoRequest : public sys::DataMessage
+    {};
+
+    class EchoResponse : public sys::ResponseMessage
+    {};
+
+    /// Unrelated traffic arriving to the requester while it waits for a synchronous response.
+    class NoiseMessage : public sys::DataMessage
+    {};
+
+    /// Replies to EchoRequest, sending a number of NoiseMessage to the requester before each reply.
+    class EchoService : public sys::Service
+    {
+      public:
+        explicit EchoService(std::size_t noisePerRequest);
+
+        sys::ReturnCodes InitHandler() override;
+        sys::ReturnCodes DeinitHandler() override;
+        sys::ReturnCodes SwitchPowerModeHandler(const sys::ServicePowerMode mode) override;
+        sys::MessagePointer DataReceivedHandler(sys::DataMessage *msgl, sys::ResponseMessage *resp = nullptr) override;
+
+      private:
+        std::size_t noisePerRequest;
+    };
+
+    struct BusLatencyResult
+    {
+        std::size_t iterations = 0;
+        std::size_t failures   = 0;
+        std::chrono::microseconds min{};
+        std::chrono::microseconds median{};
+        std::chrono::microseconds p99{};
+        std::chrono::microseconds max{};
+    };
+
+    /**
+     * Measures round trips of synchronous unicasts from the caller to a running EchoService.
+     * @param caller        Service sending the requests, has to be the calling thread
+     * @param iterations    Number of requests
+     * @return Latency statistics
+     */
+    BusLatencyResult runBusLatencyBenchmark(sys::Service *caller, std::size_t iterations);
+} // namespace service::test
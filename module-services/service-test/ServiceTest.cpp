@@ -6,11 +6,22 @@
 #include "application-test/include/application-test/ApplicationTest.hpp"
 #include "service-appmgr/Controller.hpp"
 
+#if defined(TARGET_Linux)
+#include "BusLatencyBenchmark.hpp"
+#include <SystemManager/SystemManagerCommon.hpp>
+#include <cinttypes>
+#endif
+
 namespace service::test
 {
 
     static std::uint32_t stackSize       = 2048;
     constexpr auto setting_private_value = "private value";
+#if defined(TARGET_Linux)
+    constexpr auto benchmarkDelay           = std::chrono::seconds{5};
+    constexpr std::size_t benchmarkRequests = 500;
+    constexpr std::size_t benchmarkNoise    = 2;
+#endif
 
     ServiceTest::ServiceTest() : sys::Service(service::name::service_test, "", stackSize)
     {
@@ -50,6 +61,14 @@ namespace service::test
             });
         th.start();
 
+#if defined(TARGET_Linux)
+        // measure the synchronous request/response latency against a helper echo service
+        connect(typeid(NoiseMessage), [](sys::Message *) -> sys::MessagePointer { return sys::MessageNone{}; });
+        benchmarkTimer = sys::TimerFactory::createSingleShotTimer(
+            this, "BusLatencyBenchmark", benchmarkDelay, [this](sys::Timer &) { runBusLatencyBenchmark(); });
+        benchmarkTimer.start();
+#endif
+
         LOG_INFO("Initialized");
         return sys::ReturnCodes::Success;
     }
@@ -65,6 +84,29 @@ namespace service::test
         return sys::ReturnCodes::Success;
     }
 
+#if defined(TARGET_Linux)
+    void ServiceTest::runBusLatencyBenchmark()
+    {
+        if (!sys::SystemManagerCommon::RunSystemService(std::make_shared<EchoService>(benchmarkNoise), this)) {
+            LOG_ERROR("Unable to start %s", service::name::service_test_echo);
+            return;
+        }
+
+        const auto result = test::runBusLatencyBenchmark(this, benchmarkRequests);
+        LOG_INFO("Bus sync latency [us] over %zu requests (%zu failed): min %" PRId64 " median %" PRId64
+                 " p99 %" PRId64 " max %" PRId64 ", %zu unrelated messages received per request",
+                 result.iterations,
+                 result.failures,
+                 static_cast<std::int64_t>(result.min.count()),
+                 static_cast<std::int64_t>(result.median.count()),
+                 static_cast<std::int64_t>(result.p99.count()),
+                 static_cast<std::int64_t>(result.max.count()),
+                 benchmarkNoise);
+
+        sys::SystemManagerCommon::DestroySystemService(service::name::service_test_echo, this);
+    }
+#endif
+
     sys::MessagePointer ServiceTest::DataReceivedHandler(sys::DataMessage *msgl, sys::ResponseMessage *resp)
     {
         return std::make_shared<sys::ResponseMessage>(sys::ReturnCodes::Unresolved);
@@ -21,6 +21,11 @@ namespace service::test
         settings::Settings settings;
         sys::TimerHandle th;
         bool appStarted = false;
+#if defined(TARGET_Linux)
+        sys::TimerHandle benchmarkTimer;
+
+        void runBusLatencyBenchmark();
+#endif
 
       public:
         ServiceTest();
@@ -3,12 +3,14 @@
 
 #include <Service/BusProxy.hpp>
 
+#include <Service/Service.hpp>
+
 #include "details/bus/Bus.hpp"
 
 namespace sys
 {
     BusProxy::BusProxy(Service *owner, Watchdog &watchdog)
-        : owner{owner}, watchdog{watchdog}, busImpl{std::make_unique<Bus>()}
+        : owner{owner}, ownerName{owner->GetName()}, watchdog{watchdog}, busImpl{std::make_unique<Bus>()}
     {
         channels.push_back(BusChannel::System); // Mandatory for each service.
     }
@@ -24,6 +26,15 @@ namespace sys
         return ret;
     }
 
+    bool BusProxy::sendUnicast(std::shared_ptr<Message> message, const ServiceName &target)
+    {
+        auto ret = busImpl->SendUnicast(std::move(message), target, owner);
+        if (ret) {
+            watchdog.refresh();
+        }
+        return ret;
+    }
+
     SendResult BusProxy::unicastSync(std::shared_ptr<Message> message, sys::Service *whose, std::uint32_t timeout)
     {
         auto ret = busImpl->UnicastSync(message, whose, timeout);
@@ -44,6 +55,26 @@ namespace sys
         return ret;
     }
 
+    SendResult BusProxy::sendUnicastSync(std::shared_ptr<Message> message,
+                                         const ServiceName &target,
+                                         uint32_t timeout)
+    {
+        auto ret = busImpl->SendUnicastSync(std::move(message), target, owner, timeout);
+        if (ret.first != ReturnCodes::Failure) {
+            watchdog.refresh();
+        }
+        return ret;
+    }
+
+    bool BusProxy::sendRequest(std::shared_ptr<Message> message, const ServiceName &target)
+    {
+        const auto ret = busImpl->SendRequest(std::move(message), target, owner);
+        if (ret == ReturnCodes::Success) {
+            watchdog.refresh();
+        }
+        return ret == ReturnCodes::Success;
+    }
+
     void BusProxy::sendMulticast(std::shared_ptr<Message> message, BusChannel channel)
     {
         busImpl->SendMulticast(std::move(message), channel, owner);
@@ -61,6 +92,11 @@ namespace sys
         busImpl->SendResponse(std::move(response), std::move(request), owner);
     }
 
+    const ServiceName &BusProxy::getOwnerName() const noexcept
+    {
+        return ownerName;
+    }
+
     void BusProxy::connect()
     {
         Bus::Add(owner);
@@ -0,0 +1,177 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <Service/BusTrace.hpp>
+
+#if BUS_TRACE_ENABLED == 1
+
+#include <Service/Message.hpp>
+#include <log/log.hpp>
+#include "module-os/CriticalSectionGuard.hpp"
+
+#include <FreeRTOS.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <typeinfo>
+#include <vector>
+
+#if defined(TARGET_Linux)
+#include <chrono>
+#endif
+
+namespace sys::trace
+{
+    namespace
+    {
+#if defined(TARGET_Linux)
+        constexpr std::uint32_t timestampHz = 1000000;
+
+        std::uint32_t timestamp() noexcept
+        {
+            const auto now = std::chrono::steady_clock::now().time_since_epoch();
+            return static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(now).count());
+        }
+#else
+        /// The run time statistics timer, see fsl_runtimestat_gpt.c
+        constexpr std::uint32_t timestampHz = 10000;
+
+        std::uint32_t timestamp() noexcept
+        {
+            return ulHighFrequencyTimerTicks();
+        }
+#endif
+
+        constexpr std::uint32_t dumpVersion = 1;
+        constexpr std::uint16_t unknownType = busTraceTypes - 1;
+
+        std::array<BusTraceRecord, busTraceCapacity> records{};
+        std::size_t nextRecord = 0;
+        std::size_t recorded   = 0;
+        /// Open addressing table of the traced message types, the index is the type ID
+        std::array<const std::type_info *, busTraceTypes> types{};
+
+        std::uint16_t typeID(const std::type_info &type) noexcept
+        {
+            const auto start = std::hash<const void *>{}(&type) % (busTraceTypes - 1);
+            for (std::size_t probe = 0; probe < busTraceTypes - 1; ++probe) {
+                const auto slot = (start + probe) % (busTraceTypes - 1);
+                if (types[slot] == nullptr) {
+                    types[slot] = &type;
+                }
+                if (types[slot] == &type) {
+                    return static_cast<std::uint16_t>(slot);
+                }
+            }
+            return unknownType;
+        }
+
+        struct Snapshot
+        {
+            std::vector<BusTraceRecord> records;
+            std::vector<std::pair<std::uint16_t, const std::type_info *>> types;
+        };
+
+        Snapshot takeSnapshot()
+        {
+            Snapshot snapshot;
+            snapshot.records.reserve(busTraceCapacity);
+            snapshot.types.reserve(busTraceTypes);
+
+            cpp_freertos::CriticalSectionGuard guard;
+            const auto oldest = recorded < busTraceCapacity ? 0 : nextRecord;
+            for (std::size_t i = 0; i < std::min(recorded, busTraceCapacity); ++i) {
+                snapshot.records.push_back(records[(oldest + i) % busTraceCapacity]);
+            }
+            for (std::size_t id = 0; id < types.size(); ++id) {
+                if (types[id] != nullptr) {
+                    snapshot.types.emplace_back(static_cast<std::uint16_t>(id), types[id]);
+                }
+            }
+            return snapshot;
+        }
+
+        template <typename T>
+        void write(std::ofstream &file, T value)
+        {
+            file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+        }
+
+        void writeName(std::ofstream &file, std::uint16_t id, std::string_view name)
+        {
+            write(file, id);
+            write(file, static_cast<std::uint16_t>(name.size()));
+            file.write(name.data(), static_cast<std::streamsize>(name.size()));
+        }
+    } // namespace
+
+    void recordBusEvent(BusEvent event, const Message &message, ServiceID service) noexcept
+    {
+        const auto &type = typeid(message);
+
+        cpp_freertos::CriticalSectionGuard guard;
+        records[nextRecord] = BusTraceRecord{timestamp(),
+                                             static_cast<std::uint32_t>(message.uniID),
+                                             service,
+                                             message.sender.id(),
+                                             typeID(type),
+                                             event,
+                                             0};
+        nextRecord          = (nextRecord + 1) % busTraceCapacity;
+        ++recorded;
+    }
+
+    bool dumpBusTrace(const std::filesystem::path &path)
+    {
+        const auto snapshot = takeSnapshot();
+
+        std::vector<ServiceID> services;
+        for (const auto &record : snapshot.records) {
+            services.push_back(record.service);
+            services.push_back(record.sender);
+        }
+        std::sort(services.begin(), services.end());
+        services.erase(std::unique(services.begin(), services.end()), services.end());
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            LOG_ERROR("Unable to open %s", path.c_str());
+            return false;
+        }
+
+        file.write("MBTR", 4);
+        write(file, static_cast<std::uint16_t>(dumpVersion));
+        write(file, static_cast<std::uint16_t>(sizeof(BusTraceRecord)));
+        write(file, timestampHz);
+        write(file, static_cast<std::uint32_t>(snapshot.records.size()));
+        write(file, static_cast<std::uint16_t>(snapshot.types.size()));
+        write(file, static_cast<std::uint16_t>(services.size()));
+
+        for (const auto &[id, type] : snapshot.types) {
+            writeName(file, id, type->name());
+        }
+        for (const auto id : services) {
+            writeName(file, id, ServiceName{id}.str());
+        }
+        file.write(reinterpret_cast<const char *>(snapshot.records.data()),
+                   static_cast<std::streamsize>(snapshot.records.size() * sizeof(BusTraceRecord)));
+
+        LOG_INFO("Bus trace with %zu events written to %s", snapshot.records.size(), path.c_str());
+        return file.good();
+    }
+} // namespace sys::trace
+
+#else
+
+namespace sys::trace
+{
+    bool dumpBusTrace(const std::filesystem::path & /*path*/)
+    {
+        return false;
+    }
+} // namespace sys::trace
+
+#endif
@@ -0,0 +1,335 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <Service/MessageMailbox.hpp>
+#include <Service/BusTrace.hpp>
+
+#include "ticks.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+namespace sys
+{
+    namespace
+    {
+        constexpr auto toIndex(MailboxLane lane) noexcept
+        {
+            return static_cast<std::size_t>(lane);
+        }
+
+        /// Waits on the thread of the service owning the mailbox
+        class ServiceMailboxLock : public MailboxLock
+        {
+          public:
+            explicit ServiceMailboxLock(cpp_freertos::Thread *thread) : serviceLock{thread, mutex}
+            {}
+
+            void lock() override
+            {
+                mutex.Lock();
+            }
+
+            void unlock() override
+            {
+                mutex.Unlock();
+            }
+
+            bool wait(TickType_t ticks) override
+            {
+                return serviceLock.wait(ticks);
+            }
+
+            void signal() override
+            {
+                serviceLock.signal();
+            }
+
+          private:
+            cpp_freertos::MutexStandard mutex;
+            ServiceLock serviceLock;
+        };
+    } // namespace
+
+    MailboxQueue::MailboxQueue()
+    {
+        lanes[toIndex(MailboxLane::System)].capacity      = systemCapacity;
+        lanes[toIndex(MailboxLane::Interactive)].capacity = interactiveCapacity;
+        lanes[toIndex(MailboxLane::Background)].capacity  = backgroundCapacity;
+    }
+
+    void MailboxQueue::push(MessagePointer message)
+    {
+        const std::type_index type{typeid(*message)};
+        const auto rule = ruleFor(*message, type);
+        const auto idx  = toIndex(rule.lane);
+        auto &lane      = lanes[idx];
+        auto &stats     = statistics[idx];
+
+        ++stats.pushed;
+        if (coalesce(lane, type, rule.policy, message)) {
+            ++stats.coalesced;
+            return;
+        }
+        if (lane.entries.size() >= lane.capacity) {
+            if (dropOldest(lane)) {
+                ++stats.dropped;
+            }
+            else {
+                ++stats.overflows;
+            }
+        }
+
+        lane.entries.push_back(Entry{std::move(message), type, rule.policy});
+        stats.size          = static_cast<std::uint32_t>(lane.entries.size());
+        stats.highWaterMark = std::max(stats.highWaterMark, stats.size);
+    }
+
+    MessagePointer MailboxQueue::pop()
+    {
+        if (empty()) {
+            return nullptr;
+        }
+
+        const auto idx = nextLane();
+        auto &lane     = lanes[idx];
+        auto message   = std::move(lane.entries.front().message);
+        lane.entries.pop_front();
+        statistics[idx].size = static_cast<std::uint32_t>(lane.entries.size());
+        return message;
+    }
+
+    MessagePointer MailboxQueue::extract(MessageUIDType uniID)
+    {
+        for (std::size_t idx = 0; idx < mailboxLanesCount; ++idx) {
+            auto &entries = lanes[idx].entries;
+            auto it       = std::find_if(
+                entries.begin(), entries.end(), [uniID](const Entry &entry) { return entry.message->uniID == uniID; });
+            if (it != entries.end()) {
+                auto message = std::move(it->message);
+                entries.erase(it);
+                statistics[idx].size = static_cast<std::uint32_t>(entries.size());
+                return message;
+            }
+        }
+        return nullptr;
+    }
+
+    bool MailboxQueue::empty() const noexcept
+    {
+        return std::all_of(lanes.begin(), lanes.end(), [](const auto &lane) { return lane.entries.empty(); });
+    }
+
+    std::size_t MailboxQueue::size() const noexcept
+    {
+        std::size_t total = 0;
+        for (const auto &lane : lanes) {
+            total += lane.entries.size();
+        }
+        return total;
+    }
+
+    void MailboxQueue::setRule(const std::type_info &type, MailboxRule rule)
+    {
+        const std::type_index key{type};
+        if (auto it = std::find_if(rules.begin(), rules.end(), [key](const auto &r) { return r.first == key; });
+            it != rules.end()) {
+            it->second = rule;
+            return;
+        }
+        rules.emplace_back(key, rule);
+    }
+
+    void MailboxQueue::setCapacity(MailboxLane lane, std::size_t capacity)
+    {
+        lanes[toIndex(lane)].capacity = capacity;
+    }
+
+    const MailboxStatistics &MailboxQueue::getStatistics() const noexcept
+    {
+        return statistics;
+    }
+
+    void MailboxQueue::resetStatistics() noexcept
+    {
+        for (std::size_t idx = 0; idx < mailboxLanesCount; ++idx) {
+            statistics[idx]      = MailboxLaneStatistics{};
+            statistics[idx].size = static_cast<std::uint32_t>(lanes[idx].entries.size());
+        }
+    }
+
+    MailboxRule MailboxQueue::ruleFor(const Message &message, std::type_index type) const noexcept
+    {
+        for (const auto &[key, rule] : rules) {
+            if (key == type) {
+                return rule;
+            }
+        }
+
+        switch (message.type) {
+        case Message::Type::System:
+            return {MailboxLane::System, MailboxPolicy::Keep};
+        case Message::Type::Response:
+            return {MailboxLane::Interactive, MailboxPolicy::Keep};
+        default:
+            break;
+        }
+        // receivers rely on every notification being delivered, dropping is opted into per type with setRule(), only
+        // notifications which supersede a queued one replace it
+        if (message.transType == Message::TransmissionType::Multicast ||
+            message.transType == Message::TransmissionType::Broadcast) {
+            return {MailboxLane::Background, MailboxPolicy::Keep};
+        }
+        return {MailboxLane::Interactive, MailboxPolicy::Keep};
+    }
+
+    bool MailboxQueue::coalesce(Lane &lane, std::type_index type, MailboxPolicy policy, MessagePointer &message)
+    {
+        auto it = std::find_if(lane.entries.begin(), lane.entries.end(), [&](const Entry &entry) {
+            return entry.type == type && (policy == MailboxPolicy::Coalesce || message->supersedes(*entry.message));
+        });
+        if (it == lane.entries.end()) {
+            return false;
+        }
+        it->message = std::move(message);
+        return true;
+    }
+
+    bool MailboxQueue::dropOldest(Lane &lane)
+    {
+        auto it = std::find_if(lane.entries.begin(), lane.entries.end(), [](const Entry &entry) {
+            return entry.policy != MailboxPolicy::Keep;
+        });
+        if (it == lane.entries.end()) {
+            return false;
+        }
+        lane.entries.erase(it);
+        return true;
+    }
+
+    std::size_t MailboxQueue::nextLane() noexcept
+    {
+        std::size_t first = 0;
+        while (lanes[first].entries.empty()) {
+            ++first;
+        }
+
+        auto lower = first + 1;
+        while (lower < mailboxLanesCount && lanes[lower].entries.empty()) {
+            ++lower;
+        }
+        if (lower == mailboxLanesCount) {
+            bypassed = 0;
+            return first;
+        }
+        if (++bypassed >= fairnessBudget) {
+            bypassed = 0;
+            return lower;
+        }
+        return first;
+    }
+
+    MessageMailbox::MessageMailbox(cpp_freertos::Thread *thread, ServiceID owner)
+        : MessageMailbox(std::make_unique<ServiceMailboxLock>(thread), owner)
+    {}
+
+    MessageMailbox::MessageMailbox(std::unique_ptr<MailboxLock> lock, ServiceID owner)
+        : lock{std::move(lock)}, owner{owner}
+    {}
+
+    void MessageMailbox::push(const MessagePointer &message)
+    {
+        trace::recordBusEvent(trace::BusEvent::Enqueued, *message, owner);
+        lock->lock();
+        queue.push(message);
+        lock->unlock();
+        lock->signal();
+    }
+
+    MessagePointer MessageMailbox::pop(std::uint32_t timeout)
+    {
+        std::lock_guard mlock(*lock);
+        while (queue.empty()) {
+            if (!lock->wait(timeout)) {
+                return nullptr;
+            }
+        }
+        return queue.pop();
+    }
+
+    bool MessageMailbox::empty()
+    {
+        std::lock_guard mlock(*lock);
+        return queue.empty();
+    }
+
+    void MessageMailbox::pushResponse(const MessagePointer &response)
+    {
+        lock->lock();
+        if (auto slot = findReplySlot(response->uniID); slot != replies.end() && slot->reply == nullptr) {
+            slot->reply = response;
+        }
+        else {
+            // Responses handed over to reply slots never reach the service loop, only queued ones are traced
+            trace::recordBusEvent(trace::BusEvent::Enqueued, *response, owner);
+            queue.push(response);
+        }
+        lock->unlock();
+        lock->signal();
+    }
+
+    void MessageMailbox::expectReply(MessageUIDType uniID)
+    {
+        std::lock_guard mlock(*lock);
+        replies.push_back(ReplySlot{uniID, nullptr});
+    }
+
+    MessagePointer MessageMailbox::awaitReply(MessageUIDType uniID, std::uint32_t timeout)
+    {
+        std::lock_guard mlock(*lock);
+        if (findReplySlot(uniID) == replies.end()) {
+            replies.push_back(ReplySlot{uniID, queue.extract(uniID)});
+        }
+
+        // NOTE: please mind that timeout + currentTime might overflow 32b
+        const std::uint64_t deadline = cpp_freertos::Ticks::GetTicks() + std::uint64_t{timeout};
+        auto slot                    = findReplySlot(uniID);
+        while (slot->reply == nullptr) {
+            const std::uint64_t now = cpp_freertos::Ticks::GetTicks();
+            if (now >= deadline) {
+                break;
+            }
+            lock->wait(static_cast<TickType_t>(deadline - now));
+            // Slots might have been opened by other threads in the meantime
+            slot = findReplySlot(uniID);
+        }
+
+        auto reply = std::move(slot->reply);
+        replies.erase(slot);
+        return reply;
+    }
+
+    std::vector<MessageMailbox::ReplySlot>::iterator MessageMailbox::findReplySlot(MessageUIDType uniID)
+    {
+        return std::find_if(
+            replies.begin(), replies.end(), [uniID](const ReplySlot &slot) { return slot.uniID == uniID; });
+    }
+
+    void MessageMailbox::setRule(const std::type_info &type, MailboxRule rule)
+    {
+        std::lock_guard mlock(*lock);
+        queue.setRule(type, rule);
+    }
+
+    void MessageMailbox::setCapacity(MailboxLane lane, std::size_t capacity)
+    {
+        std::lock_guard mlock(*lock);
+        queue.setCapacity(lane, capacity);
+    }
+
+    MailboxStatistics MessageMailbox::getStatistics()
+    {
+        std::lock_guard mlock(*lock);
+        return queue.getStatistics();
+    }
+} // namespace sys
@@ -0,0 +1,96 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <Service/MessagePool.hpp>
+
+#include <log/log.hpp>
+#include "module-os/CriticalSectionGuard.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+
+namespace sys
+{
+    namespace pool
+    {
+        namespace
+        {
+            PoolBase *pools = nullptr;
+        } // namespace
+
+        void *PoolBase::allocate(const std::type_info &type, std::byte *storage) noexcept
+        {
+            cpp_freertos::CriticalSectionGuard guard;
+
+            if (!registered) {
+                stats.name = type.name();
+                next       = pools;
+                pools      = this;
+                registered = true;
+            }
+
+            ++stats.allocations;
+            void *block = nullptr;
+            if (freeList != nullptr) {
+                block    = freeList;
+                freeList = *static_cast<void **>(freeList);
+            }
+            else if (touched < stats.capacity) {
+                block = storage + touched * stats.blockSize;
+                ++touched;
+            }
+            else {
+                ++stats.fallbacks;
+                return nullptr;
+            }
+
+            ++stats.inUse;
+            stats.peakInUse = std::max(stats.peakInUse, stats.inUse);
+            return block;
+        }
+
+        bool PoolBase::deallocate(void *ptr, std::byte *storage) noexcept
+        {
+            const auto block = static_cast<std::byte *>(ptr);
+            if (block < storage || block >= storage + stats.blockSize * stats.capacity) {
+                return false;
+            }
+
+            cpp_freertos::CriticalSectionGuard guard;
+            *static_cast<void **>(ptr) = freeList;
+            freeList                   = ptr;
+            --stats.inUse;
+            return true;
+        }
+
+        std::vector<MessagePoolStatistics> collectStatistics()
+        {
+            std::vector<MessagePoolStatistics> result;
+            cpp_freertos::CriticalSectionGuard guard;
+            for (auto pool = pools; pool != nullptr; pool = pool->next) {
+                result.push_back(pool->stats);
+            }
+            return result;
+        }
+    } // namespace pool
+
+    std::vector<MessagePoolStatistics> getMessagePoolStatistics()
+    {
+        return pool::collectStatistics();
+    }
+
+    void logMessagePoolStatistics()
+    {
+        for (const auto &stats : getMessagePoolStatistics()) {
+            LOG_INFO("Message pool %s: block %zu B, %" PRIu32 "/%zu in use (peak %" PRIu32 "), allocations %" PRIu32
+                     ", heap fallbacks %" PRIu32,
+                     stats.name,
+                     stats.blockSize,
+                     stats.inUse,
+                     stats.capacity,
+                     stats.peakInUse,
+                     stats.allocations,
+                     stats.fallbacks);
+        }
+    }
+} // namespace sys
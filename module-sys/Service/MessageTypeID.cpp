@@ -0,0 +1,50 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <Service/MessageTypeID.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+namespace sys
+{
+    namespace
+    {
+        std::atomic<std::size_t> registeredTypes{0};
+        std::array<std::atomic<const std::type_info *>, maxMessageTypeIDs> types{};
+    } // namespace
+
+    namespace detail
+    {
+        MessageTypeID registerMessageType(const std::type_info &type) noexcept
+        {
+            const auto id = registeredTypes.fetch_add(1, std::memory_order_relaxed);
+            if (id >= maxMessageTypeIDs) {
+                return invalidMessageTypeID;
+            }
+            types[id].store(&type, std::memory_order_release);
+            return static_cast<MessageTypeID>(id);
+        }
+    } // namespace detail
+
+    MessageTypeID findMessageTypeID(const std::type_info &type) noexcept
+    {
+        const auto count = std::min(registeredTypes.load(std::memory_order_relaxed), maxMessageTypeIDs);
+        for (std::size_t id = 0; id < count; ++id) {
+            if (const auto registered = types[id].load(std::memory_order_acquire);
+                registered != nullptr && *registered == type) {
+                return static_cast<MessageTypeID>(id);
+            }
+        }
+        return invalidMessageTypeID;
+    }
+
+    const std::type_info *messageTypeOf(MessageTypeID id) noexcept
+    {
+        if (id >= maxMessageTypeIDs) {
+            return nullptr;
+        }
+        return types[id].load(std::memory_order_acquire);
+    }
+} // namespace sys
@@ -2,10 +2,11 @@
 // For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
 
 #include <Service/Service.hpp>
-#include "FreeRTOSConfig.h"    // for configASSERT
-#include "MessageType.hpp"     // for MessageType, MessageType::MessageType...
-#include "Service/Mailbox.hpp" // for Mailbox
-#include <Service/Message.hpp> // for Message, MessagePointer, DataMessage, Resp...
+#include "FreeRTOSConfig.h"           // for configASSERT
+#include "MessageType.hpp"            // for MessageType, MessageType::MessageType...
+#include "Service/MessageMailbox.hpp" // for MessageMailbox
+#include <Service/Message.hpp>        // for Message, MessagePointer, DataMessage, Resp...
+#include <Service/BusTrace.hpp>       // for recordBusEvent
 #include "Timers/SystemTimer.hpp"
 #include "Timers/TimerHandle.hpp"  // for Timer
 #include "Timers/TimerMessage.hpp" // for TimerMessage
@@ -16,6 +17,7 @@
 #include "thread.hpp"              // for Thread
 #include "ticks.hpp"               // for Ticks
 #include <algorithm>               // for remove_if
+#include <cinttypes>               // for PRIu32
 #include <cstdint>                 // for uint32_t, uint64_t, UINT32_MAX
 #include <iosfwd>                  // for std
 #include <typeinfo>                // for type_info
@@ -62,7 +64,8 @@ namespace sys
     Service::Service(
         std::string name, std::string parent, uint32_t stackDepth, ServicePriority priority, Watchdog &watchdog)
         : cpp_freertos::Thread(name, stackDepth / 4 /* Stack depth in bytes */, static_cast<UBaseType_t>(priority)),
-          parent(parent), bus(this, watchdog), mailbox(this), watchdog(watchdog), isReady(false), enableRunLoop(false)
+          parent(parent), bus(this, watchdog), mailbox(this, bus.getOwnerName().id()), watchdog(watchdog), isReady(false),
+          enableRunLoop(false), timers(this)
     {}
 
     Service::~Service()
@@ -84,6 +87,19 @@ namespace sys
     void Service::CloseService()
     {
         bus.disconnect();
+
+        const auto statistics = mailbox.getStatistics();
+        for (std::size_t idx = 0; idx < statistics.size(); ++idx) {
+            const auto &lane = statistics[idx];
+            if (lane.dropped != 0 || lane.overflows != 0) {
+                LOG_WARN("%s mailbox lane %s: high water mark %" PRIu32 ", dropped %" PRIu32 ", overflows %" PRIu32,
+                         GetName().c_str(),
+                         magic_enum::enum_name(static_cast<MailboxLane>(idx)).data(),
+                         lane.highWaterMark,
+                         lane.dropped,
+                         lane.overflows);
+            }
+        }
     }
 
     void Service::Run()
@@ -97,9 +113,11 @@ namespace sys
     void Service::processBus()
     {
         if (auto msg = mailbox.pop(); msg) {
-            const bool respond  = msg->type != Message::Type::Response && GetName() != msg->sender;
+            const bool respond  = msg->type != Message::Type::Response && bus.getOwnerName() != msg->sender;
             currentlyProcessing = msg;
-            auto response       = msg->Execute(this);
+            trace::recordBusEvent(trace::BusEvent::Dequeued, *msg, bus.getOwnerName().id());
+            auto response = msg->Execute(this);
+            trace::recordBusEvent(trace::BusEvent::Handled, *msg, bus.getOwnerName().id());
             if (response == nullptr || !respond) {
                 return;
             }
@@ -140,8 +158,27 @@ namespace sys
 
     auto Service::ExecuteMessageHandler(Message *message) -> std::pair<bool, MessagePointer>
     {
-        const auto idx = type_index(typeid(*message));
-        if (const auto handler = message_handlers.find(idx); handler != message_handlers.end()) {
+        const auto id = message->getTypeID();
+        if (id < typed_handlers.size() && typed_handlers[id] != nullptr) {
+            const auto &handlerFunction = *typed_handlers[id];
+            if (handlerFunction == nullptr) {
+                return {true, nullptr};
+            }
+            return {true, handlerFunction(message)};
+        }
+        if (message_handlers.empty()) {
+            return {false, nullptr};
+        }
+
+        const auto &type = typeid(*message);
+        if (const auto handler = message_handlers.find(type_index(type)); handler != message_handlers.end()) {
+            if (id != invalidMessageTypeID && messageTypeOf(id) != nullptr && *messageTypeOf(id) == type) {
+                // Connected by type before the type got its ID, move it to the table for the next messages
+                auto handlerFunction = std::move(handler->second);
+                message_handlers.erase(handler);
+                connectTyped(id, type, std::move(handlerFunction));
+                return ExecuteMessageHandler(message);
+            }
             const auto &handlerFunction = handler->second;
             if (handlerFunction == nullptr) {
                 return {true, nullptr};
@@ -153,6 +190,9 @@ namespace sys
 
     bool Service::connect(const type_info &type, MessageHandler handler)
     {
+        if (const auto id = findMessageTypeID(type); id != invalidMessageTypeID) {
+            return connectTyped(id, type, std::move(handler));
+        }
         auto idx = type_index(type);
         if (message_handlers.find(idx) == message_handlers.end()) {
             log_debug("Registering new message handler on %s", type.name());
@@ -163,9 +203,31 @@ namespace sys
         return false;
     }
 
+    bool Service::connectTyped(MessageTypeID id, const std::type_info &type, MessageHandler handler)
+    {
+        if (id == invalidMessageTypeID) {
+            return connect(type, std::move(handler));
+        }
+        if (message_handlers.find(type_index(type)) != message_handlers.end() ||
+            (id < typed_handlers.size() && typed_handlers[id] != nullptr)) {
+            LOG_ERROR("Handler for: %s already registered!", type.name());
+            return false;
+        }
+        if (id >= typed_handlers.size()) {
+            typed_handlers.resize(id + 1);
+        }
+        log_debug("Registering new message handler on %s with ID %u", type.name(), static_cast<unsigned>(id));
+        typed_handlers[id] = std::make_unique<MessageHandler>(std::move(handler));
+        return true;
+    }
+
     bool Service::connect(Message *msg, MessageHandler handler)
     {
         auto &type = typeid(*msg);
+        // A message derived from a typed one without being typed itself reports the ID of its base
+        if (const auto id = msg->getTypeID(); id != invalidMessageTypeID && *messageTypeOf(id) == type) {
+            return connectTyped(id, type, std::move(handler));
+        }
         return connect(type, handler);
     }
 
@@ -176,6 +238,10 @@ namespace sys
 
     bool Service::disconnect(const std::type_info &type)
     {
+        if (const auto id = findMessageTypeID(type); id < typed_handlers.size() && typed_handlers[id] != nullptr) {
+            typed_handlers[id].reset();
+            return true;
+        }
         auto iter = message_handlers.find(type_index(type));
         if (iter == std::end(message_handlers)) {
             return false;
@@ -202,40 +268,133 @@ namespace sys
 
     auto Service::TimerHandle(SystemMessage &message) -> ReturnCodes
     {
-        auto timer_message = dynamic_cast<sys::TimerMessage *>(&message);
-        if (timer_message == nullptr) {
+        if (dynamic_cast<sys::TimerMessage *>(&message) == nullptr) {
             LOG_ERROR("Wrong message in system message handler");
             return ReturnCodes::Failure;
         }
-
-        auto sysTimer = timer_message->getTimer();
-        auto timer    = timers.get(sysTimer);
-        if (timer == nullptr) {
-            LOG_ERROR("No such timer registered in Service");
-            return ReturnCodes::Failure;
-        }
-        timer->onTimeout();
+        timers.expire();
         return ReturnCodes::Success;
     }
 
+    Service::Timers::Timers(Service *owner) : alarm{owner}
+    {}
+
     void Service::Timers::attach(timer::SystemTimer *timer)
     {
+        cpp_freertos::LockGuard lock(mutex);
         list.push_back(timer);
     }
 
     void Service::Timers::detach(timer::SystemTimer *timer)
     {
+        cpp_freertos::LockGuard lock(mutex);
+        wheel.cancel(*timer);
         const auto it = std::find(list.begin(), list.end(), timer);
         if (it != list.end()) {
             list.erase(it);
         }
     }
 
+    void Service::Timers::schedule(timer::SystemTimer *timer, std::chrono::milliseconds interval)
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        const auto current = now();
+        // Keep the wheel close to the current tick, so that new timers land on its finest possible level
+        wheel.advance(current);
+        wheel.schedule(*timer, current + cpp_freertos::Ticks::MsToTicks(interval.count()));
+        rearm(current);
+    }
+
+    void Service::Timers::reschedule(timer::SystemTimer *timer, std::chrono::milliseconds interval)
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        const auto current = now();
+        // Periodic timers keep their phase unless the service lags behind a whole period
+        const auto expiry = std::max(timer->getExpiry() + cpp_freertos::Ticks::MsToTicks(interval.count()), current);
+        wheel.schedule(*timer, expiry);
+        rearm(current);
+    }
+
+    void Service::Timers::cancel(timer::SystemTimer *timer)
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        // The OS timer is left armed, a needless wakeup is cheaper than reprogramming it on every stop
+        wheel.cancel(*timer);
+    }
+
+    auto Service::Timers::popExpired() -> timer::SystemTimer *
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        return static_cast<timer::SystemTimer *>(wheel.popExpired());
+    }
+
+    void Service::Timers::expire()
+    {
+        alarm.acknowledge();
+        {
+            cpp_freertos::LockGuard lock(mutex);
+            armedAt.reset();
+            ++wheel.getStatistics().wakeups;
+            wheel.advance(now());
+        }
+
+        // Callbacks are called without the lock held, they may start, stop and destroy timers
+        while (auto timer = popExpired()) {
+            timer->onTimeout();
+        }
+
+        cpp_freertos::LockGuard lock(mutex);
+        rearm(now());
+    }
+
+    void Service::Timers::rearm(std::uint64_t current)
+    {
+        const auto expiry = wheel.nextExpiry();
+        if (!expiry) {
+            return;
+        }
+        const auto wakeup = std::max(timer::TimerWheel::coalesce(*expiry, slack), current);
+        if (armedAt && *armedAt <= wakeup) {
+            return;
+        }
+        if (!alarm.arm(static_cast<TickType_t>(wakeup - current))) {
+            LOG_ERROR("Failed to arm the timers");
+            return;
+        }
+        armedAt = wakeup;
+        ++wheel.getStatistics().alarms;
+    }
+
+    auto Service::Timers::now() -> std::uint64_t
+    {
+        const auto ticks = cpp_freertos::Ticks::GetTicks();
+        if (ticks < lastTicks) {
+            ticksEpoch += std::uint64_t{1} << (sizeof(TickType_t) * 8);
+        }
+        lastTicks = ticks;
+        return ticksEpoch + ticks;
+    }
+
     void Service::Timers::stop()
     {
         for (auto timer : list) {
             timer->stop();
         }
+        cpp_freertos::LockGuard lock(mutex);
+        armedAt.reset();
+        alarm.disarm();
+    }
+
+    void Service::Timers::setSlack(std::chrono::milliseconds value)
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        slack = cpp_freertos::Ticks::MsToTicks(value.count());
+    }
+
+    auto Service::Timers::getStatistics() -> timer::TimerWheelStatistics
+    {
+        cpp_freertos::LockGuard lock(mutex);
+        return wheel.getStatistics();
     }
 
     auto Service::Timers::get(timer::SystemTimer *timer) noexcept -> timer::SystemTimer *
@@ -280,12 +439,15 @@ namespace sys
         case SystemMessageType::Timer:
             ret = service->TimerHandle(*message);
             break;
-        case SystemMessageType::Start:
-            ret = service->InitHandler();
+        case SystemMessageType::Start: {
+            const auto startTicks = cpp_freertos::Ticks::GetTicks();
+            ret                   = service->InitHandler();
+            service->initDuration =
+                std::chrono::milliseconds{cpp_freertos::Ticks::TicksToMs(cpp_freertos::Ticks::GetTicks() - startTicks)};
             if (ret == ReturnCodes::Success) {
                 service->isReady = true;
             }
-            break;
+        } break;
         case SystemMessageType::ServiceCloseReason:
             service->ProcessCloseReasonHandler(static_cast<ServiceCloseReasonMessage *>(message)->getCloseReason());
             break;
@@ -293,8 +455,11 @@ namespace sys
         return std::make_shared<ResponseMessage>(ret);
     }
 
-    bool Service::isConnected(std::type_index idx)
+    bool Service::isConnected(const std::type_info &type)
     {
-        return message_handlers.find(idx) != message_handlers.end();
+        if (const auto id = findMessageTypeID(type); id < typed_handlers.size() && typed_handlers[id] != nullptr) {
+            return true;
+        }
+        return message_handlers.find(type_index(type)) != message_handlers.end();
     }
 } // namespace sys
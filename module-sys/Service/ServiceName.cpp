@@ -0,0 +1,115 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <Service/ServiceName.hpp>
+
+#include <log/log.hpp>
+#include "module-os/CriticalSectionGuard.hpp"
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+
+namespace sys
+{
+    namespace
+    {
+        // Open addressing table, twice as large as the names table so probing sequences stay short. Slots keep
+        // ID + 1, zero marks an empty slot which keeps the table constant-initialized.
+        constexpr std::size_t slotsCount = ServiceName::maxNames * 2;
+
+        std::array<const std::string *, ServiceName::maxNames> names{};
+        std::array<std::atomic<ServiceID>, slotsCount> slots{};
+        std::size_t namesCount = 0;
+
+        const std::string unknownName{"Unknown"};
+
+        std::size_t slotOf(std::string_view name) noexcept
+        {
+            return std::hash<std::string_view>{}(name) % slotsCount;
+        }
+
+        ServiceID lookup(std::string_view name) noexcept
+        {
+            for (auto slot = slotOf(name), probes = std::size_t{0}; probes < slotsCount;
+                 slot = (slot + 1) % slotsCount, ++probes) {
+                const auto entry = slots[slot].load(std::memory_order_acquire);
+                if (entry == 0) {
+                    break;
+                }
+                const ServiceID id = entry - 1;
+                if (*names[id] == name) {
+                    return id;
+                }
+            }
+            return invalidServiceID;
+        }
+    } // namespace
+
+    ServiceName::ServiceName(ServiceID id) noexcept : value{id}
+    {}
+
+    ServiceName::ServiceName(std::string_view name) : value{intern(name)}
+    {}
+
+    ServiceName &ServiceName::operator=(std::string_view name)
+    {
+        value = intern(name);
+        return *this;
+    }
+
+    ServiceName &ServiceName::operator=(const std::string &name)
+    {
+        return *this = std::string_view{name};
+    }
+
+    ServiceName &ServiceName::operator=(const char *name)
+    {
+        return *this = std::string_view{name};
+    }
+
+    const std::string &ServiceName::str() const noexcept
+    {
+        if (value >= maxNames || names[value] == nullptr) {
+            return unknownName;
+        }
+        return *names[value];
+    }
+
+    ServiceID ServiceName::find(std::string_view name) noexcept
+    {
+        return lookup(name);
+    }
+
+    ServiceID ServiceName::intern(std::string_view name)
+    {
+        if (const auto id = lookup(name); id != invalidServiceID) {
+            return id;
+        }
+
+        // Allocate outside of the critical section, the entry is dropped if somebody else was faster.
+        auto entry = std::make_unique<const std::string>(name);
+        {
+            cpp_freertos::CriticalSectionGuard guard;
+
+            if (const auto id = lookup(name); id != invalidServiceID) {
+                return id;
+            }
+            if (namesCount < maxNames) {
+                const auto id = static_cast<ServiceID>(namesCount++);
+                names[id]     = entry.release();
+
+                auto slot = slotOf(name);
+                while (slots[slot].load(std::memory_order_relaxed) != 0) {
+                    slot = (slot + 1) % slotsCount;
+                }
+                slots[slot].store(id + 1, std::memory_order_release);
+                return id;
+            }
+        }
+
+        LOG_ERROR("Service names table is full, unable to register %s", entry->c_str());
+        return invalidServiceID;
+    }
+} // namespace sys
@@ -0,0 +1,231 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <Service/SystemMetrics.hpp>
+#include <log/log.hpp>
+#include <mutex.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <map>
+
+namespace sys::metrics
+{
+    namespace
+    {
+        constexpr std::uint16_t unknownName = std::numeric_limits<std::uint16_t>::max();
+
+        auto kindName(RecordKind kind) -> const char *
+        {
+            switch (kind) {
+            case RecordKind::Window:
+                return "window";
+            case RecordKind::TaskUsage:
+                return "task";
+            case RecordKind::Residency:
+                return "residency";
+            case RecordKind::SentinelRequest:
+                return "sentinel";
+            }
+            return "unknown";
+        }
+
+        auto ringMutex() -> cpp_freertos::MutexStandard &
+        {
+            static cpp_freertos::MutexStandard mutex;
+            return mutex;
+        }
+
+        auto ring() -> MetricsRing &
+        {
+            static MetricsRing metrics{metricsCapacity};
+            return metrics;
+        }
+    } // namespace
+
+    MetricsRing::MetricsRing(std::size_t capacity) : records(capacity)
+    {}
+
+    void MetricsRing::push(const Window &window)
+    {
+        append(Record{window.timestamp, RecordKind::Window, 0, window.frequency, window.length, window.freeHeap});
+        for (const auto &task : window.tasks) {
+            append(Record{window.timestamp, RecordKind::TaskUsage, 0, nameID(task.name), task.cpuShare, task.heapPeak});
+        }
+        for (const auto &residency : window.residency) {
+            append(Record{window.timestamp, RecordKind::Residency, 0, residency.frequency, residency.time, 0});
+        }
+        for (const auto &sentinel : window.sentinels) {
+            append(Record{window.timestamp,
+                          RecordKind::SentinelRequest,
+                          0,
+                          nameID(sentinel.name),
+                          sentinel.frequency,
+                          sentinel.wfiBlocked ? 1U : 0U});
+        }
+    }
+
+    auto MetricsRing::windows() const -> std::vector<Window>
+    {
+        std::vector<Window> result;
+        // Records preceding the first window record belong to a window partially overwritten already
+        for (const auto &record : ordered()) {
+            if (record.kind == RecordKind::Window) {
+                result.push_back(Window{record.timestamp, record.value, record.source, record.extra, {}, {}, {}});
+                continue;
+            }
+            if (result.empty()) {
+                continue;
+            }
+            auto &window = result.back();
+            switch (record.kind) {
+            case RecordKind::TaskUsage:
+                window.tasks.push_back(TaskUsage{nameOf(record.source), record.value, record.extra});
+                break;
+            case RecordKind::Residency:
+                window.residency.push_back(Residency{record.source, record.value});
+                break;
+            case RecordKind::SentinelRequest:
+                window.sentinels.push_back(
+                    SentinelRequest{nameOf(record.source), static_cast<std::uint16_t>(record.value), record.extra != 0});
+                break;
+            case RecordKind::Window:
+                break;
+            }
+        }
+        return result;
+    }
+
+    auto MetricsRing::summarize(std::uint32_t period) const -> Summary
+    {
+        const auto all = windows();
+
+        Summary summary;
+        std::map<std::string, std::pair<std::uint64_t, std::uint32_t>> tasks; // weighted CPU share, heap peak
+        std::map<std::uint16_t, std::uint32_t> residency;
+        for (auto window = all.rbegin(); window != all.rend() && (period == 0 || summary.length < period); ++window) {
+            if (summary.windows == 0) {
+                summary.sentinels = window->sentinels;
+            }
+            for (const auto &task : window->tasks) {
+                auto &[share, heapPeak] = tasks[task.name];
+                share += static_cast<std::uint64_t>(task.cpuShare) * window->length;
+                heapPeak = std::max(heapPeak, task.heapPeak);
+            }
+            for (const auto &level : window->residency) {
+                residency[level.frequency] += level.time;
+            }
+            summary.length += window->length;
+            ++summary.windows;
+        }
+
+        for (const auto &[name, usage] : tasks) {
+            const auto share = summary.length == 0 ? 0 : usage.first / summary.length;
+            summary.tasks.push_back(TaskUsage{name, static_cast<std::uint32_t>(share), usage.second});
+        }
+        std::sort(summary.tasks.begin(), summary.tasks.end(), [](const auto &lhs, const auto &rhs) {
+            return lhs.cpuShare > rhs.cpuShare;
+        });
+        for (const auto &[frequency, time] : residency) {
+            summary.residency.push_back(Residency{frequency, time});
+        }
+        return summary;
+    }
+
+    auto MetricsRing::toCsv() const -> std::string
+    {
+        std::string csv{"timestamp_ms,record,source,value,extra\n"};
+        for (const auto &record : ordered()) {
+            std::string source;
+            switch (record.kind) {
+            case RecordKind::TaskUsage:
+            case RecordKind::SentinelRequest:
+                source = nameOf(record.source);
+                break;
+            case RecordKind::Residency:
+                source = record.source == wfiFrequency ? "wfi" : std::to_string(record.source);
+                break;
+            case RecordKind::Window:
+                source = std::to_string(record.source);
+                break;
+            }
+            csv += std::to_string(record.timestamp) + ',' + kindName(record.kind) + ',' + source + ',' +
+                   std::to_string(record.value) + ',' + std::to_string(record.extra) + '\n';
+        }
+        return csv;
+    }
+
+    auto MetricsRing::size() const noexcept -> std::size_t
+    {
+        return count;
+    }
+
+    auto MetricsRing::nameID(std::string_view name) -> std::uint16_t
+    {
+        const auto found = std::find(names.begin(), names.end(), name);
+        if (found != names.end()) {
+            return static_cast<std::uint16_t>(std::distance(names.begin(), found));
+        }
+        if (names.size() >= unknownName) {
+            return unknownName;
+        }
+        names.emplace_back(name);
+        return static_cast<std::uint16_t>(names.size() - 1);
+    }
+
+    auto MetricsRing::nameOf(std::uint16_t id) const -> std::string
+    {
+        return id < names.size() ? names[id] : "unknown";
+    }
+
+    void MetricsRing::append(const Record &record)
+    {
+        if (records.empty()) {
+            return;
+        }
+        records[next] = record;
+        next          = (next + 1) % records.size();
+        count         = std::min(count + 1, records.size());
+    }
+
+    auto MetricsRing::ordered() const -> std::vector<Record>
+    {
+        std::vector<Record> result;
+        result.reserve(count);
+        const auto oldest = count < records.size() ? 0 : next;
+        for (std::size_t i = 0; i < count; ++i) {
+            result.push_back(records[(oldest + i) % records.size()]);
+        }
+        return result;
+    }
+
+    void record(const Window &window)
+    {
+        cpp_freertos::LockGuard lock{ringMutex()};
+        ring().push(window);
+    }
+
+    auto summarize(std::uint32_t period) -> Summary
+    {
+        cpp_freertos::LockGuard lock{ringMutex()};
+        return ring().summarize(period);
+    }
+
+    bool exportCsv(const std::filesystem::path &path)
+    {
+        std::string csv;
+        {
+            cpp_freertos::LockGuard lock{ringMutex()};
+            csv = ring().toCsv();
+        }
+
+        std::ofstream file(path, std::ios::trunc);
+        if (!file.is_open()) {
+            LOG_ERROR("Unable to open %s", path.c_str());
+            return false;
+        }
+        file << csv;
+        return file.good();
+    }
+} // namespace sys::metrics
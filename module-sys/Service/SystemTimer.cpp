@@ -6,6 +6,7 @@
 #include <Timers/TimerMessage.hpp>
 #include <log/log.hpp>
 #include <ticks.hpp>
+#include <algorithm>
 #include <memory>
 
 #if DEBUG_TIMER == 1
@@ -17,8 +18,7 @@
 namespace sys::timer
 {
     SystemTimer::SystemTimer(Service *parent, const std::string &name, std::chrono::milliseconds interval, Type type)
-        : cpp_freertos::Timer(name.c_str(), cpp_freertos::Ticks::MsToTicks(interval.count()), type == Type::Periodic),
-          name{name}, interval{interval}, type{type}, parent{parent}
+        : name{name}, interval{interval}, type{type}, parent{parent}
     {
         attachToService();
         log_debug("%s %s timer created", name.c_str(), type == Type::Periodic ? "periodic" : "single-shot");
@@ -35,55 +35,32 @@ namespace sys::timer
         parent->getTimers().detach(this);
     }
 
-    void SystemTimer::Run()
-    {
-        auto msg = std::make_shared<TimerMessage>(this);
-        if (const auto ret = parent->bus.sendUnicast(std::move(msg), parent->GetName()); !ret) {
-            LOG_ERROR("Timer %s error: bus error", name.c_str());
-        }
-    }
-
     void SystemTimer::start()
     {
         log_debug("Timer %s start", name.c_str());
-        stopTimerIfActive();
-        startTimer();
+        active = true;
+        parent->getTimers().schedule(this, interval);
     }
 
     void SystemTimer::restart(std::chrono::milliseconds newInterval)
     {
         log_debug("Timer %s restart", name.c_str());
-        stopTimerIfActive();
         setInterval(newInterval);
-        startTimer();
-    }
-
-    void SystemTimer::stopTimerIfActive()
-    {
-        if (active) {
-            cpp_freertos::Timer::Stop(0);
-        }
-    }
-
-    void SystemTimer::startTimer()
-    {
-        active = true;
-        cpp_freertos::Timer::Start(0);
+        start();
     }
 
     void SystemTimer::stop()
     {
         log_debug("Timer %s stop!", name.c_str());
-        // make sure callback is not called even if it is already in the queue
+        // make sure callback is not called even if it has already expired
         active = false;
-        cpp_freertos::Timer::Stop(0);
+        parent->getTimers().cancel(this);
     }
 
     void SystemTimer::setInterval(std::chrono::milliseconds value)
     {
         log_debug("Timer %s set interval to %" PRIi64 " ms!", name.c_str(), value.count());
         interval = value;
-        cpp_freertos::Timer::SetPeriod(cpp_freertos::Ticks::MsToTicks(interval.count()), 0);
     }
 
     void SystemTimer::onTimeout()
@@ -101,6 +78,9 @@ namespace sys::timer
         if (type == Type::SingleShot) {
             stop();
         }
+        else {
+            parent->getTimers().reschedule(this, interval);
+        }
         callback(*this);
     }
 
@@ -113,4 +93,36 @@ namespace sys::timer
     {
         callback = std::move(newCallback);
     }
+
+    WheelAlarm::WheelAlarm(Service *parent)
+        : cpp_freertos::Timer((parent->GetName() + "_timers").c_str(), 1, false), parent{parent}
+    {}
+
+    bool WheelAlarm::arm(TickType_t delay)
+    {
+        return cpp_freertos::Timer::SetPeriod(std::max<TickType_t>(delay, 1), 0);
+    }
+
+    void WheelAlarm::disarm()
+    {
+        cpp_freertos::Timer::Stop(0);
+    }
+
+    void WheelAlarm::acknowledge() noexcept
+    {
+        tickPending = false;
+    }
+
+    void WheelAlarm::Run()
+    {
+        // A single tick in the mailbox is enough, the service fires all the timers expired until it handles it
+        if (tickPending.exchange(true)) {
+            return;
+        }
+        auto msg = std::make_shared<TimerMessage>();
+        if (const auto ret = parent->bus.sendUnicast(std::move(msg), parent->GetName()); !ret) {
+            LOG_ERROR("Timers of %s error: bus error", parent->GetName().c_str());
+            tickPending = false;
+        }
+    }
 } // namespace sys::timer
@@ -0,0 +1,280 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <Timers/TimerWheel.hpp>
+
+#include <algorithm>
+
+namespace sys::timer
+{
+    namespace
+    {
+        constexpr std::uint64_t slotMask = TimerWheel::slotsPerLevel - 1;
+
+        constexpr auto shiftOf(std::size_t level) noexcept
+        {
+            return level * TimerWheel::slotBits;
+        }
+
+        constexpr auto slotOf(std::uint64_t tick, std::size_t level) noexcept
+        {
+            return static_cast<std::size_t>((tick >> shiftOf(level)) & slotMask);
+        }
+
+        /// Distance from the start slot to the first occupied one, going round the level.
+        std::optional<std::size_t> firstOccupied(std::uint64_t bits, std::size_t start) noexcept
+        {
+            if (bits == 0) {
+                return std::nullopt;
+            }
+            const auto rotated = start == 0 ? bits : (bits >> start) | (bits << (TimerWheel::slotsPerLevel - start));
+            return static_cast<std::size_t>(__builtin_ctzll(rotated));
+        }
+
+        void keepEarlier(std::optional<std::uint64_t> &best, std::uint64_t tick) noexcept
+        {
+            if (!best || tick < *best) {
+                best = tick;
+            }
+        }
+    } // namespace
+
+    TimerWheel::TimerWheel(std::uint64_t now) noexcept : current{now}
+    {}
+
+    TimerWheel::~TimerWheel() noexcept
+    {
+        for (auto head : buckets) {
+            while (head != nullptr) {
+                const auto next = head->next;
+                head->prev      = nullptr;
+                head->next      = nullptr;
+                head->bucket    = WheelEntry::unlinked;
+                head            = next;
+            }
+        }
+    }
+
+    void TimerWheel::schedule(WheelEntry &entry, std::uint64_t expiry) noexcept
+    {
+        if (entry.isScheduled()) {
+            unlink(entry);
+        }
+        else {
+            ++statistics.active;
+            statistics.peakActive = std::max(statistics.peakActive, statistics.active);
+        }
+        ++statistics.starts;
+        entry.expiry = expiry;
+        place(entry);
+    }
+
+    void TimerWheel::cancel(WheelEntry &entry) noexcept
+    {
+        if (!entry.isScheduled()) {
+            return;
+        }
+        unlink(entry);
+        --statistics.active;
+        ++statistics.cancels;
+    }
+
+    void TimerWheel::advance(std::uint64_t now) noexcept
+    {
+        while (current < now) {
+            const auto next = nextEvent();
+            if (!next || *next > now) {
+                // Nothing expires and nothing cascades in between
+                current = now;
+                return;
+            }
+            process(*next);
+        }
+    }
+
+    WheelEntry *TimerWheel::popExpired() noexcept
+    {
+        const auto entry = buckets[expiredBucket];
+        if (entry == nullptr) {
+            return nullptr;
+        }
+        unlink(*entry);
+        --statistics.active;
+        ++statistics.expirations;
+        return entry;
+    }
+
+    std::optional<std::uint64_t> TimerWheel::nextExpiry() const noexcept
+    {
+        if (buckets[expiredBucket] != nullptr) {
+            return current;
+        }
+
+        std::optional<std::uint64_t> best;
+        for (std::size_t level = 0; level < levels; ++level) {
+            const auto bits = occupied[level];
+            if (bits == 0) {
+                continue;
+            }
+            // Slots of a level are ordered by time from the one following the current tick, except the farthest
+            // slot of the last level, which holds also the timers beyond the wheel - scan the whole last level.
+            const auto start = slotOf(current + (std::uint64_t{1} << shiftOf(level)), level);
+            const auto count = level == levels - 1 ? static_cast<std::size_t>(__builtin_popcountll(bits)) : 1;
+            auto slot        = start;
+            for (std::size_t found = 0; found < count; ++found) {
+                slot = (slot + *firstOccupied(bits, slot)) & slotMask;
+                for (auto entry = buckets[level * slotsPerLevel + slot]; entry != nullptr; entry = entry->next) {
+                    keepEarlier(best, entry->expiry);
+                }
+                slot = (slot + 1) & slotMask;
+            }
+        }
+        return best;
+    }
+
+    std::uint64_t TimerWheel::now() const noexcept
+    {
+        return current;
+    }
+
+    bool TimerWheel::empty() const noexcept
+    {
+        return statistics.active == 0;
+    }
+
+    const TimerWheelStatistics &TimerWheel::getStatistics() const noexcept
+    {
+        return statistics;
+    }
+
+    TimerWheelStatistics &TimerWheel::getStatistics() noexcept
+    {
+        return statistics;
+    }
+
+    std::uint64_t TimerWheel::coalesce(std::uint64_t tick, std::uint64_t slack) noexcept
+    {
+        if (slack <= 1) {
+            return tick;
+        }
+        return ((tick + slack - 1) / slack) * slack;
+    }
+
+    void TimerWheel::place(WheelEntry &entry) noexcept
+    {
+        if (entry.expiry <= current) {
+            link(entry, expiredBucket);
+            return;
+        }
+
+        const auto delta = entry.expiry - current;
+        for (std::size_t level = 0; level < levels; ++level) {
+            if (delta < (std::uint64_t{1} << shiftOf(level + 1))) {
+                link(entry, static_cast<std::uint16_t>(level * slotsPerLevel + slotOf(entry.expiry, level)));
+                return;
+            }
+        }
+
+        // Beyond the wheel, park in the slot of the last level which cascades last
+        constexpr auto last = levels - 1;
+        const auto slot     = ((current >> shiftOf(last)) + slotMask) & slotMask;
+        link(entry, static_cast<std::uint16_t>(last * slotsPerLevel + slot));
+    }
+
+    void TimerWheel::link(WheelEntry &entry, std::uint16_t bucket) noexcept
+    {
+        entry.bucket = bucket;
+        if (bucket == expiredBucket) {
+            // Expired timers are fired in order
+            entry.prev = expiredTail;
+            entry.next = nullptr;
+            if (expiredTail != nullptr) {
+                expiredTail->next = &entry;
+            }
+            else {
+                buckets[bucket] = &entry;
+            }
+            expiredTail = &entry;
+            return;
+        }
+
+        entry.prev = nullptr;
+        entry.next = buckets[bucket];
+        if (entry.next != nullptr) {
+            entry.next->prev = &entry;
+        }
+        buckets[bucket] = &entry;
+        occupied[bucket / slotsPerLevel] |= std::uint64_t{1} << (bucket % slotsPerLevel);
+    }
+
+    void TimerWheel::unlink(WheelEntry &entry) noexcept
+    {
+        const auto bucket = entry.bucket;
+        if (entry.prev != nullptr) {
+            entry.prev->next = entry.next;
+        }
+        else {
+            buckets[bucket] = entry.next;
+        }
+        if (entry.next != nullptr) {
+            entry.next->prev = entry.prev;
+        }
+        else if (bucket == expiredBucket) {
+            expiredTail = entry.prev;
+        }
+        if (bucket != expiredBucket && buckets[bucket] == nullptr) {
+            occupied[bucket / slotsPerLevel] &= ~(std::uint64_t{1} << (bucket % slotsPerLevel));
+        }
+
+        entry.prev   = nullptr;
+        entry.next   = nullptr;
+        entry.bucket = WheelEntry::unlinked;
+    }
+
+    void TimerWheel::cascade(std::size_t level, std::size_t slot) noexcept
+    {
+        const auto bucket = level * slotsPerLevel + slot;
+        auto entry        = buckets[bucket];
+        buckets[bucket]   = nullptr;
+        occupied[level] &= ~(std::uint64_t{1} << slot);
+
+        while (entry != nullptr) {
+            const auto next = entry->next;
+            entry->prev     = nullptr;
+            entry->next     = nullptr;
+            place(*entry);
+            if (level > 0) {
+                ++statistics.cascades;
+            }
+            entry = next;
+        }
+    }
+
+    void TimerWheel::process(std::uint64_t tick) noexcept
+    {
+        current = tick;
+        // Coarser levels first, so that their timers reach level 0 in the same step
+        for (auto level = levels - 1; level > 0; --level) {
+            if ((tick & ((std::uint64_t{1} << shiftOf(level)) - 1)) == 0) {
+                cascade(level, slotOf(tick, level));
+            }
+        }
+        cascade(0, slotOf(tick, 0));
+    }
+
+    std::optional<std::uint64_t> TimerWheel::nextEvent() const noexcept
+    {
+        std::optional<std::uint64_t> best;
+        if (const auto distance = firstOccupied(occupied[0], slotOf(current + 1, 0)); distance) {
+            best = current + 1 + *distance;
+        }
+        for (std::size_t level = 1; level < levels; ++level) {
+            const auto shift    = shiftOf(level);
+            const auto boundary = ((current >> shift) + 1) << shift;
+            if (const auto distance = firstOccupied(occupied[level], slotOf(boundary, level)); distance) {
+                keepEarlier(best, boundary + (std::uint64_t{*distance} << shift));
+            }
+        }
+        return best;
+    }
+} // namespace sys::timer
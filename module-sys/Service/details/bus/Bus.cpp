@@ -8,11 +8,11 @@
 #include "SystemWatchdog/SystemWatchdog.hpp"
 #include "module-os/CriticalSectionGuard.hpp"
 
-#include "ticks.hpp"
-
 #include <algorithm>
+#include <array>
 #include <cassert>
-#include <set>
+#include <memory>
+#include <vector>
 
 namespace sys
 {
@@ -21,18 +21,75 @@ namespace sys
         MessageUID uniqueMsgId;
         MessageUID unicastMsgId;
 
-        std::map<BusChannel, std::set<Service *>> channels;
-        std::map<std::string, Service *> servicesRegistered;
+        // Registered services are indexed by their interned ID and channel subscribers by the channel value, so
+        // routing a message never touches a string nor walks a tree.
+        // Target lists are copied on write: senders take a reference to the current list under the guard and walk it
+        // outside of it, while a concurrent Add() or Remove() publishes a new list.
+        using Targets = std::shared_ptr<const std::vector<Service *>>;
+
+        std::array<Service *, ServiceName::maxNames> routes{};
+        std::array<Targets, magic_enum::enum_count<BusChannel>()> channels;
+        Targets servicesRegistered;
+
+        Service *routeTo(const ServiceName &target) noexcept
+        {
+            return target.isValid() ? routes[target.id()] : nullptr;
+        }
+
+        Targets &subscribersOf(BusChannel channel)
+        {
+            return channels[static_cast<std::size_t>(channel)];
+        }
+
+        /// Has to be called under the guard
+        template <typename Update>
+        void updateTargets(Targets &targets, Update &&update)
+        {
+            auto services = targets != nullptr ? *targets : std::vector<Service *>{};
+            update(services);
+            targets = std::make_shared<const std::vector<Service *>>(std::move(services));
+        }
+
+        void eraseService(Targets &targets, Service *service)
+        {
+            updateTargets(targets, [service](auto &services) {
+                services.erase(std::remove(services.begin(), services.end(), service), services.end());
+            });
+        }
+
+        void pushToAll(const Targets &targets, const std::shared_ptr<Message> &message)
+        {
+            if (targets == nullptr) {
+                return;
+            }
+            for (const auto &target : *targets) {
+                target->mailbox.push(message);
+            }
+        }
     } // namespace
 
     void Bus::Add(Service *service)
     {
+        const auto id = service->bus.getOwnerName().id();
+        if (id == invalidServiceID) {
+            LOG_ERROR("Unable to register service %s", service->GetName().c_str());
+            return;
+        }
+
         cpp_freertos::CriticalSectionGuard guard;
 
         for (auto channel : service->bus.channels) {
-            channels[channel].insert(service);
+            updateTargets(subscribersOf(channel), [service](auto &services) {
+                if (std::find(services.begin(), services.end(), service) == services.end()) {
+                    services.push_back(service);
+                }
+            });
         }
-        servicesRegistered[service->GetName()] = service;
+        updateTargets(servicesRegistered, [service, previous = routes[id]](auto &services) {
+            services.erase(std::remove(services.begin(), services.end(), previous), services.end());
+            services.push_back(service);
+        });
+        routes[id] = service;
     }
 
     void Bus::Remove(Service *service)
@@ -40,10 +97,12 @@ namespace sys
         cpp_freertos::CriticalSectionGuard guard;
 
         for (auto channel : service->bus.channels) {
-            auto &services = channels[channel];
-            services.erase(service);
+            eraseService(subscribersOf(channel), service);
+        }
+        if (const auto id = service->bus.getOwnerName().id(); id != invalidServiceID && routes[id] == service) {
+            routes[id] = nullptr;
         }
-        servicesRegistered.erase(service->GetName());
+        eraseService(servicesRegistered, service);
     }
 
     void Bus::SendResponse(std::shared_ptr<Message> response, std::shared_ptr<Message> request, Service *sender)
@@ -52,7 +111,7 @@ namespace sys
         assert(request != nullptr);
         assert(sender != nullptr);
 
-        response->sender    = sender->GetName();
+        response->sender    = sender->bus.getOwnerName();
         response->transType = Message::TransmissionType::Unicast;
 
         if (request->transType == Message::TransmissionType::Unicast) {
@@ -73,13 +132,27 @@ namespace sys
             response->ValidateResponseMessage();
         }
 
-        if (auto it = servicesRegistered.find(request->sender); it != servicesRegistered.end()) {
-            const auto targetService = it->second;
-            targetService->mailbox.push(response);
+        if (const auto targetService = routeTo(request->sender); targetService != nullptr) {
+            if (request->transType == Message::TransmissionType::Unicast) {
+                targetService->mailbox.pushResponse(response);
+            }
+            else {
+                targetService->mailbox.push(response);
+            }
         }
     }
 
     bool Bus::SendUnicast(std::shared_ptr<Message> message, const std::string &targetName, Service *sender)
+    {
+        if (const auto target = ServiceName::find(targetName); target != invalidServiceID) {
+            return SendUnicast(std::move(message), ServiceName{target}, sender);
+        }
+
+        LOG_ERROR("Service %s doesn't exist", targetName.c_str());
+        return false;
+    }
+
+    bool Bus::SendUnicast(std::shared_ptr<Message> message, const ServiceName &target, Service *sender)
     {
         {
             cpp_freertos::CriticalSectionGuard guard;
@@ -87,37 +160,45 @@ namespace sys
             message->uniID = unicastMsgId.getNext();
         }
 
-        message->sender    = sender->GetName();
+        message->sender    = sender->bus.getOwnerName();
         message->transType = Message::TransmissionType::Unicast;
 
         message->ValidateUnicastMessage();
 
-        if (auto it = servicesRegistered.find(targetName); it != servicesRegistered.end()) {
-            const auto targetService = it->second;
+        if (const auto targetService = routeTo(target); targetService != nullptr) {
             targetService->mailbox.push(message);
             return true;
         }
 
-        LOG_ERROR("Service %s doesn't exist", targetName.c_str());
+        LOG_ERROR("Service %s doesn't exist", target.c_str());
         return false;
     }
 
-    namespace
+    SendResult Bus::SendUnicastSync(std::shared_ptr<Message> message,
+                                    const std::string &targetName,
+                                    Service *sender,
+                                    std::uint32_t timeout)
     {
-        template <class W, class X>
-        void restoreMessagess(W &mailbox, X &tempMsg)
-        {
-            // Push messages collected during waiting for response to processing queue
-            for (const auto &w : tempMsg) {
-                mailbox.push(w);
-            }
+        if (const auto target = ServiceName::find(targetName); target != invalidServiceID) {
+            return SendUnicastSync(std::move(message), ServiceName{target}, sender, timeout);
         }
-    } // namespace
+
+        LOG_ERROR("Service %s doesn't exist", targetName.c_str());
+        return std::make_pair(ReturnCodes::ServiceDoesntExist, nullptr);
+    }
 
     SendResult Bus::SendUnicastSync(std::shared_ptr<Message> message,
-                                    const std::string &targetName,
+                                    const ServiceName &target,
                                     Service *sender,
                                     std::uint32_t timeout)
+    {
+        if (const auto ret = SendRequest(message, target, sender); ret != ReturnCodes::Success) {
+            return std::make_pair(ret, nullptr);
+        }
+        return UnicastSync(message, sender, timeout);
+    }
+
+    ReturnCodes Bus::SendRequest(std::shared_ptr<Message> message, const ServiceName &target, Service *sender)
     {
         {
             cpp_freertos::CriticalSectionGuard guard;
@@ -125,94 +206,63 @@ namespace sys
             message->uniID = unicastMsgId.getNext();
         }
 
-        message->sender    = sender->GetName();
+        message->sender    = sender->bus.getOwnerName();
         message->transType = Message::TransmissionType::Unicast;
 
         message->ValidateUnicastMessage();
 
-        auto ele = servicesRegistered.find(targetName);
-        if (ele != servicesRegistered.end()) {
-            const auto targetService = servicesRegistered[targetName];
-            targetService->mailbox.push(message);
-        }
-        else {
-            LOG_ERROR("Service %s doesn't exist", targetName.c_str());
-            return std::make_pair(ReturnCodes::ServiceDoesntExist, nullptr);
+        const auto targetService = routeTo(target);
+        if (targetService == nullptr) {
+            LOG_ERROR("Service %s doesn't exist", target.c_str());
+            return ReturnCodes::ServiceDoesntExist;
         }
 
-        return UnicastSync(message, sender, timeout);
+        // The reply slot has to be open before the request is sent, the target may respond immediately
+        sender->mailbox.expectReply(message->uniID);
+        targetService->mailbox.push(std::move(message));
+        return ReturnCodes::Success;
     }
 
     SendResult Bus::UnicastSync(const std::shared_ptr<Message> &message, Service *sender, std::uint32_t timeout)
     {
-        std::vector<std::shared_ptr<Message>> tempMsg;
-        tempMsg.reserve(4); // reserve space for 4 elements to avoid costly memory allocations
-
-        // NOTE: please mind that timeout + curentTime might overflow 32b
-        // especially if we want to wait infinitely
-        uint64_t currentTime   = cpp_freertos::Ticks::GetTicks();
-        uint64_t timeoutNeeded = currentTime + timeout;
-        uint64_t timeElapsed   = currentTime;
-
-        while (1) {
-            // timeout
-            if (timeElapsed >= timeoutNeeded) {
-                restoreMessagess(sender->mailbox, tempMsg);
-                return std::make_pair(ReturnCodes::Timeout, nullptr);
-            }
-
-            // Immediately block on rx queue
-            auto rxmsg  = sender->mailbox.pop(timeoutNeeded - timeElapsed);
-            timeElapsed = cpp_freertos::Ticks::GetTicks();
-
-            // check for timeout
-            if (rxmsg == nullptr) {
-                restoreMessagess(sender->mailbox, tempMsg);
-                return CreateSendResult(ReturnCodes::Timeout, nullptr);
-            }
-
-            // Received response
-            if ((rxmsg->uniID == message->uniID) && (message->sender == sender->GetName())) {
-                restoreMessagess(sender->mailbox, tempMsg);
-                return CreateSendResult(ReturnCodes::Success, rxmsg);
-            }
-            tempMsg.push_back(rxmsg);
+        if (auto response = sender->mailbox.awaitReply(message->uniID, timeout); response != nullptr) {
+            return CreateSendResult(ReturnCodes::Success, std::move(response));
         }
+        return CreateSendResult(ReturnCodes::Timeout, nullptr);
     }
 
     void Bus::SendMulticast(std::shared_ptr<Message> message, BusChannel channel, Service *sender)
     {
+        Targets targets;
         {
             cpp_freertos::CriticalSectionGuard guard;
             message->id = uniqueMsgId.getNext();
+            targets     = subscribersOf(channel);
         }
 
         message->channel   = channel;
         message->transType = Message::TransmissionType::Multicast;
-        message->sender    = sender->GetName();
+        message->sender    = sender->bus.getOwnerName();
 
         message->ValidateMulticastMessage();
 
-        for (const auto &target : channels[channel]) {
-            target->mailbox.push(message);
-        }
+        pushToAll(targets, message);
     }
 
     void Bus::SendBroadcast(std::shared_ptr<Message> message, Service *sender)
     {
+        Targets targets;
         {
             cpp_freertos::CriticalSectionGuard guard;
             message->id = uniqueMsgId.getNext();
+            targets     = servicesRegistered;
         }
 
         message->transType = Message::TransmissionType::Broadcast;
-        message->sender    = sender->GetName();
+        message->sender    = sender->bus.getOwnerName();
 
         message->ValidateBroadcastMessage();
 
-        for (const auto &target : servicesRegistered) {
-            const auto targetService = target.second;
-            targetService->mailbox.push(message);
-        }
+        pushToAll(targets, message);
     }
 } // namespace sys
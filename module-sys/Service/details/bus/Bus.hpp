@@ -30,6 +30,15 @@ namespace sys
          */
         bool SendUnicast(std::shared_ptr<Message> message, const std::string &targetName, Service *sender);
 
+        /**
+         * Sends a message directly to the specified target service, routed by its interned ID.
+         * @param message       Message to be sent
+         * @param target        Target service
+         * @param sender        Sender context
+         * @return true on success, false otherwise
+         */
+        bool SendUnicast(std::shared_ptr<Message> message, const ServiceName &target, Service *sender);
+
         /**
          * Sends a message directly to the specified target service with timeout.
          * @param message       Message to be sent
@@ -43,7 +52,29 @@ namespace sys
                                    Service *sender,
                                    std::uint32_t timeout);
 
-        /// await for response on source message with timeout
+        /**
+         * Sends a message directly to the specified target service with timeout, routed by its interned ID.
+         * @param message       Message to be sent
+         * @param target        Target service
+         * @param sender        Sender context
+         * @param timeout       Timeout
+         * @return Return code and a response.
+         */
+        SendResult SendUnicastSync(std::shared_ptr<Message> message,
+                                   const ServiceName &target,
+                                   Service *sender,
+                                   std::uint32_t timeout);
+
+        /**
+         * Sends a request and opens a reply slot for its response, which is awaited later with UnicastSync().
+         * @param message       Message to be sent
+         * @param target        Target service
+         * @param sender        Sender context
+         * @return ReturnCodes::Success if the request was sent, ReturnCodes::ServiceDoesntExist otherwise
+         */
+        ReturnCodes SendRequest(std::shared_ptr<Message> message, const ServiceName &target, Service *sender);
+
+        /// await for response on source message with timeout, the response is taken from the sender's reply slot
         SendResult UnicastSync(const std::shared_ptr<Message> &message, Service *sender, std::uint32_t timeout);
 
         /**
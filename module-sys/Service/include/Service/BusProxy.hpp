@@ -24,10 +24,15 @@ namespace sys
         ~BusProxy() noexcept;
 
         bool sendUnicast(std::shared_ptr<Message> message, const std::string &targetName);
+        bool sendUnicast(std::shared_ptr<Message> message, const ServiceName &target);
         SendResult unicastSync(std::shared_ptr<Message> message, sys::Service *whose, std::uint32_t timeout);
         SendResult sendUnicastSync(std::shared_ptr<Message> message,
                                    const std::string &targetName,
                                    std::uint32_t timeout);
+        SendResult sendUnicastSync(std::shared_ptr<Message> message, const ServiceName &target, std::uint32_t timeout);
+        /// Sends a request whose response is awaited later with unicastSync(), so that several requests can be
+        /// outstanding at once.
+        bool sendRequest(std::shared_ptr<Message> message, const ServiceName &target);
         void sendMulticast(std::shared_ptr<Message> message, BusChannel channel);
         void sendBroadcast(std::shared_ptr<Message> message);
 
@@ -53,6 +58,9 @@ namespace sys
 
         void sendResponse(std::shared_ptr<Message> response, std::shared_ptr<Message> request);
 
+        /// Interned name of the owning service, used as the sender of all outgoing messages.
+        [[nodiscard]] const ServiceName &getOwnerName() const noexcept;
+
       private:
         friend class Service;
         explicit BusProxy(Service *owner, Watchdog &watchdog);
@@ -61,6 +69,7 @@ namespace sys
         void disconnect();
 
         Service *owner;
+        ServiceName ownerName;
         Watchdog &watchdog;
         std::unique_ptr<Bus> busImpl;
     };
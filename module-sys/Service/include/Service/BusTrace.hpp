@@ -0,0 +1,63 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include "ServiceName.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+#ifndef BUS_TRACE_ENABLED
+#define BUS_TRACE_ENABLED 0
+#endif
+
+namespace sys
+{
+    class Message;
+} // namespace sys
+
+namespace sys::trace
+{
+    enum class BusEvent : std::uint8_t
+    {
+        Enqueued, ///< Message put into the mailbox of the service
+        Dequeued, ///< Message taken from the mailbox by the service, its handling starts
+        Handled   ///< Handling of the message finished
+    };
+
+    /// Single event of the bus trace, stored as is in the ring buffer and in the dump.
+    struct BusTraceRecord
+    {
+        std::uint32_t timestamp; ///< In units of busTraceTimestampHz, wraps around
+        std::uint32_t uniID;     ///< Lower half of the uniID of the message
+        ServiceID service;       ///< Service whose mailbox the event concerns
+        ServiceID sender;
+        std::uint16_t type; ///< Message type, names are stored in the dump
+        BusEvent event;
+        std::uint8_t reserved;
+    };
+    static_assert(sizeof(BusTraceRecord) == 16, "Dump format relies on the record size");
+
+    inline constexpr std::size_t busTraceCapacity = 2048;
+    inline constexpr std::size_t busTraceTypes    = 256;
+
+#if BUS_TRACE_ENABLED == 1
+    /// Records an event of a message in the ring buffer, the oldest events are overwritten.
+    void recordBusEvent(BusEvent event, const Message &message, ServiceID service) noexcept;
+#else
+    inline void recordBusEvent(BusEvent /*event*/, const Message & /*message*/, ServiceID /*service*/) noexcept
+    {}
+#endif
+
+    /**
+     * Writes the recorded events to a file, to be converted with tools/bus_trace_to_chrome.py.
+     *
+     * Layout: header, names of the message types and of the services, then the records from the oldest one. All
+     * numbers are little endian.
+     * @param path  File to write
+     * @return false if tracing is disabled or the file could not be written
+     */
+    bool dumpBusTrace(const std::filesystem::path &path);
+} // namespace sys::trace
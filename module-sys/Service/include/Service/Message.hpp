@@ -4,6 +4,8 @@
 #pragma once
 
 #include "MessageForward.hpp"
+#include "MessageTypeID.hpp"
+#include "ServiceName.hpp"
 
 #include <system/Common.hpp>
 #include <MessageType.hpp>
@@ -12,6 +14,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <type_traits>
 
 namespace sys
 {
@@ -56,6 +59,20 @@ namespace sys
 
         virtual MessagePointer Execute(Service *service);
 
+        /// ID of the message class for the handler lookup, messages not derived from TypedMessage have none.
+        [[nodiscard]] virtual MessageTypeID getTypeID() const noexcept
+        {
+            return invalidMessageTypeID;
+        }
+
+        /// True if the message makes a queued one of the same class obsolete, e.g. a newer status. It then replaces
+        /// the queued message in the mailbox instead of being queued after it, see MailboxQueue.
+        /// @param queued   Queued message, always of the same dynamic type
+        [[nodiscard]] virtual bool supersedes([[maybe_unused]] const Message &queued) const noexcept
+        {
+            return false;
+        }
+
         virtual explicit operator std::string() const
         {
             return {"{}"};
@@ -66,14 +83,14 @@ namespace sys
         Type type                  = Type::Unspecified;
         TransmissionType transType = TransmissionType::Unspecified;
         BusChannel channel         = BusChannel::Unknown;
-        std::string sender         = "Unknown";
+        ServiceName sender;
 
         [[nodiscard]] std::string to_string() const
         {
             return "| ID:" + std::to_string(id) + " | uniID: " + std::to_string(uniID) +
                    " | Type: " + std::string(magic_enum::enum_name(type)) +
                    " | TransmissionType: " + std::string(magic_enum::enum_name(transType)) +
-                   " | Channel: " + std::string(magic_enum::enum_name(channel)) + " | Sender: " + sender + " |";
+                   " | Channel: " + std::string(magic_enum::enum_name(channel)) + " | Sender: " + sender.str() + " |";
         }
 
         /**
@@ -174,7 +191,35 @@ namespace sys
         MessageType messageType = MessageType::MessageTypeUninitialized;
     };
 
-    class ReadyToCloseMessage : public DataMessage
+    /**
+     * Gives the message class an ID, so that its handlers are found without RTTI:
+     *
+     *     class KbdMessage : public sys::TypedMessage<KbdMessage>
+     *
+     * A class derived from a typed message has to be typed on its own, otherwise it is dispatched as its base.
+     */
+    template <typename Derived, typename Base = DataMessage>
+    class TypedMessage : public Base
+    {
+      public:
+        using TypedAs = Derived;
+        using Base::Base;
+
+        [[nodiscard]] MessageTypeID getTypeID() const noexcept override
+        {
+            return messageTypeID<Derived>();
+        }
+    };
+
+    template <typename T, typename = void>
+    struct isTypedMessage : std::false_type
+    {};
+
+    template <typename T>
+    struct isTypedMessage<T, std::void_t<typename T::TypedAs>> : std::is_same<typename T::TypedAs, T>
+    {};
+
+    class ReadyToCloseMessage : public TypedMessage<ReadyToCloseMessage>
     {};
 
     class ResponseMessage : public Message
@@ -0,0 +1,209 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include "Mailbox.hpp"
+#include "Message.hpp"
+#include "ServiceName.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+namespace sys
+{
+    /// Priority lanes of a service mailbox, served from the most important one.
+    enum class MailboxLane : std::uint8_t
+    {
+        System,      ///< System messages and timers
+        Interactive, ///< Unicast requests and responses
+        Background   ///< Multicast and broadcast notifications
+    };
+
+    /// What to do with a message when its lane is full.
+    enum class MailboxPolicy : std::uint8_t
+    {
+        Keep,       ///< Never dropped, the lane exceeds its capacity when nothing else can be dropped
+        DropOldest, ///< The oldest droppable message of the lane is dropped to make room
+        Coalesce    ///< Replaces an already queued message of the same type, dropped as DropOldest otherwise
+    };
+
+    struct MailboxRule
+    {
+        MailboxLane lane;
+        MailboxPolicy policy;
+    };
+
+    struct MailboxLaneStatistics
+    {
+        std::uint32_t size          = 0;
+        std::uint32_t highWaterMark = 0;
+        std::uint32_t pushed        = 0;
+        std::uint32_t dropped       = 0;
+        std::uint32_t coalesced     = 0;
+        std::uint32_t overflows     = 0; ///< Messages queued above the capacity because nothing could be dropped
+    };
+
+    inline constexpr std::size_t mailboxLanesCount = magic_enum::enum_count<MailboxLane>();
+
+    using MailboxStatistics = std::array<MailboxLaneStatistics, mailboxLanesCount>;
+
+    /**
+     * Prioritized, bounded queue of the messages of a single service. Not thread safe - see MessageMailbox.
+     *
+     * Messages are put into lanes by their type: system messages go to the System lane, multicast and broadcast
+     * notifications to the Background lane and everything else to the Interactive lane. All of them are kept by
+     * default, except that a message which supersedes a queued one of its type (see Message::supersedes), e.g. a
+     * periodic status, replaces it in place - so such messages take at most one slot per type. A service may
+     * override both the lane and the overflow policy for a message type with setRule(), e.g. to drop or coalesce a
+     * notification which is superseded by the next one of its type.
+     */
+    class MailboxQueue
+    {
+      public:
+        static constexpr std::size_t systemCapacity      = 32;
+        static constexpr std::size_t interactiveCapacity = 64;
+        static constexpr std::size_t backgroundCapacity  = 64;
+
+        /// Number of messages served from higher lanes in a row before a waiting lower lane gets its turn.
+        static constexpr std::uint32_t fairnessBudget = 16;
+
+        MailboxQueue();
+
+        void push(MessagePointer message);
+        [[nodiscard]] MessagePointer pop();
+        /// Removes a queued message with the given uniID, if any, leaving the order of the others intact.
+        [[nodiscard]] MessagePointer extract(MessageUIDType uniID);
+        [[nodiscard]] bool empty() const noexcept;
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        void setRule(const std::type_info &type, MailboxRule rule);
+        void setCapacity(MailboxLane lane, std::size_t capacity);
+
+        [[nodiscard]] const MailboxStatistics &getStatistics() const noexcept;
+        void resetStatistics() noexcept;
+
+      private:
+        struct Entry
+        {
+            MessagePointer message;
+            std::type_index type;
+            MailboxPolicy policy;
+        };
+
+        struct Lane
+        {
+            std::deque<Entry> entries;
+            std::size_t capacity;
+        };
+
+        [[nodiscard]] MailboxRule ruleFor(const Message &message, std::type_index type) const noexcept;
+        bool coalesce(Lane &lane, std::type_index type, MailboxPolicy policy, MessagePointer &message);
+        bool dropOldest(Lane &lane);
+        [[nodiscard]] std::size_t nextLane() noexcept;
+
+        std::array<Lane, mailboxLanesCount> lanes;
+        std::vector<std::pair<std::type_index, MailboxRule>> rules;
+        MailboxStatistics statistics;
+        std::uint32_t bypassed = 0;
+    };
+
+    /**
+     * Mutual exclusion and waiting of MessageMailbox. The mailbox of a service waits on the service thread, another
+     * lock may be injected where there is none, e.g. in host tests.
+     */
+    class MailboxLock
+    {
+      public:
+        virtual ~MailboxLock() = default;
+
+        virtual void lock()   = 0;
+        virtual void unlock() = 0;
+
+        /**
+         * Waits for signal(), the lock is held by the caller and released in the meantime.
+         * @param ticks     Timeout in ticks
+         * @return false on timeout
+         */
+        virtual bool wait(TickType_t ticks) = 0;
+        virtual void signal()               = 0;
+    };
+
+    /**
+     * Thread safe MailboxQueue, the mailbox of sys::Service.
+     *
+     * Besides the queue the mailbox keeps reply slots of the synchronous requests the service waits for. A response
+     * matching a slot by uniID is handed over directly and never enters the queue, so messages which arrive in the
+     * meantime stay queued in order.
+     */
+    class MessageMailbox
+    {
+      public:
+        /**
+         * @param thread    Thread of the service waiting for the messages
+         * @param owner     Service the messages are traced for, see BusTrace.hpp
+         */
+        explicit MessageMailbox(cpp_freertos::Thread *thread, ServiceID owner = invalidServiceID);
+
+        /**
+         * @param lock      Lock used instead of one waiting on a service thread
+         * @param owner     Service the messages are traced for, see BusTrace.hpp
+         */
+        explicit MessageMailbox(std::unique_ptr<MailboxLock> lock, ServiceID owner = invalidServiceID);
+
+        void push(const MessagePointer &message);
+        MessagePointer pop(std::uint32_t timeout = portMAX_DELAY);
+        bool empty();
+
+        /**
+         * Delivers a response to the reply slot waiting for its uniID, queues it if there is none.
+         * @param response  Response to a unicast request
+         */
+        void pushResponse(const MessagePointer &response);
+
+        /**
+         * Opens a reply slot for a request which is about to be sent.
+         * @param uniID     uniID of the request
+         */
+        void expectReply(MessageUIDType uniID);
+
+        /**
+         * Waits for the response to a request and closes its reply slot. If no slot was opened for the request, it
+         * is opened now and a response which has been already queued is taken over.
+         * @param uniID     uniID of the request
+         * @param timeout   Timeout in ticks
+         * @return Response, nullptr on timeout
+         */
+        MessagePointer awaitReply(MessageUIDType uniID, std::uint32_t timeout);
+
+        /**
+         * Sets the lane and the overflow policy of a message type.
+         * @param type  Message type, i.e. typeid(SomeNotification)
+         * @param rule  Lane and policy
+         */
+        void setRule(const std::type_info &type, MailboxRule rule);
+        void setCapacity(MailboxLane lane, std::size_t capacity);
+
+        [[nodiscard]] MailboxStatistics getStatistics();
+
+      private:
+        struct ReplySlot
+        {
+            MessageUIDType uniID;
+            MessagePointer reply;
+        };
+
+        std::vector<ReplySlot>::iterator findReplySlot(MessageUIDType uniID);
+
+        MailboxQueue queue;
+        std::vector<ReplySlot> replies;
+        std::unique_ptr<MailboxLock> lock;
+        ServiceID owner;
+    };
+} // namespace sys
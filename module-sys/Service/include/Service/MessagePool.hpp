@@ -0,0 +1,159 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace sys
+{
+    struct MessagePoolStatistics
+    {
+        const char *name          = nullptr; ///< Type of the pooled message
+        std::size_t blockSize     = 0;
+        std::size_t capacity      = 0;
+        std::uint32_t allocations = 0;
+        std::uint32_t fallbacks   = 0; ///< Allocations served by the heap because the pool was exhausted
+        std::uint32_t inUse       = 0;
+        std::uint32_t peakInUse   = 0;
+    };
+
+    /// Number of preallocated blocks of a pooled message type. Specialize to tune a type.
+    template <typename T>
+    struct MessagePoolTraits
+    {
+        static constexpr std::size_t capacity = 8;
+    };
+
+    namespace pool
+    {
+        /// Common part of all pools, pools link themselves into a global list on the first allocation.
+        class PoolBase
+        {
+          public:
+            constexpr PoolBase(std::size_t blockSize, std::size_t capacity) noexcept
+                : stats{nullptr, blockSize, capacity, 0, 0, 0, 0}
+            {}
+
+          protected:
+            void *allocate(const std::type_info &type, std::byte *storage) noexcept;
+            bool deallocate(void *ptr, std::byte *storage) noexcept;
+
+          private:
+            friend std::vector<MessagePoolStatistics> collectStatistics();
+
+            MessagePoolStatistics stats;
+            PoolBase *next      = nullptr;
+            bool registered     = false;
+            void *freeList      = nullptr;
+            std::size_t touched = 0; ///< Blocks handed out at least once, the others are not linked yet
+        };
+
+        template <std::size_t BlockSize, std::size_t Alignment, std::size_t Capacity>
+        class FixedPool : public PoolBase
+        {
+            static_assert(BlockSize >= sizeof(void *), "Block has to fit the free list link");
+
+          public:
+            constexpr FixedPool() noexcept : PoolBase(BlockSize, Capacity)
+            {}
+
+            void *allocate(const std::type_info &type) noexcept
+            {
+                return PoolBase::allocate(type, storage);
+            }
+
+            bool deallocate(void *ptr) noexcept
+            {
+                return PoolBase::deallocate(ptr, storage);
+            }
+
+          private:
+            alignas(Alignment) std::byte storage[BlockSize * Capacity]{};
+        };
+
+        std::vector<MessagePoolStatistics> collectStatistics();
+    } // namespace pool
+
+    /**
+     * Allocator backed by a statically allocated pool of fixed size blocks, one pool per allocated type. Meant to be
+     * used with std::allocate_shared, which rebinds it to the control block holding the message. The heap is used
+     * only when the pool is exhausted.
+     * @tparam T        Allocated type
+     * @tparam Capacity Number of blocks in the pool
+     * @tparam Tag      Type the statistics are reported for, the message type
+     */
+    template <typename T, std::size_t Capacity, typename Tag = T>
+    class PoolAllocator
+    {
+      public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = PoolAllocator<U, Capacity, Tag>;
+        };
+
+        constexpr PoolAllocator() noexcept = default;
+
+        template <typename U>
+        constexpr PoolAllocator(const PoolAllocator<U, Capacity, Tag> & /*other*/) noexcept
+        {}
+
+        [[nodiscard]] T *allocate(std::size_t n)
+        {
+            if (n == 1) {
+                if (auto ptr = pool.allocate(typeid(Tag)); ptr != nullptr) {
+                    return static_cast<T *>(ptr);
+                }
+            }
+            return static_cast<T *>(::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T *ptr, std::size_t /*n*/) noexcept
+        {
+            if (!pool.deallocate(ptr)) {
+                ::operator delete(ptr);
+            }
+        }
+
+        template <typename U>
+        constexpr bool operator==(const PoolAllocator<U, Capacity, Tag> & /*other*/) const noexcept
+        {
+            return std::is_same_v<T, U>;
+        }
+
+        template <typename U>
+        constexpr bool operator!=(const PoolAllocator<U, Capacity, Tag> &other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+      private:
+        static inline pool::FixedPool<sizeof(T), alignof(T), Capacity> pool{};
+    };
+
+    /**
+     * Creates a message in the pool of its type, drop-in replacement of std::make_shared for frequently sent
+     * messages.
+     */
+    template <typename T, typename... Args>
+    std::shared_ptr<T> makePooled(Args &&...args)
+    {
+        return std::allocate_shared<T>(PoolAllocator<T, MessagePoolTraits<T>::capacity>{},
+                                       std::forward<Args>(args)...);
+    }
+
+    /// Statistics of all message pools used so far.
+    std::vector<MessagePoolStatistics> getMessagePoolStatistics();
+
+    /// Logs statistics of all message pools used so far.
+    void logMessagePoolStatistics();
+} // namespace sys
@@ -0,0 +1,38 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <typeinfo>
+
+namespace sys
+{
+    /// Small, dense number of a message class, used to index the message handlers of a service.
+    using MessageTypeID = std::uint16_t;
+
+    inline constexpr MessageTypeID invalidMessageTypeID = std::numeric_limits<MessageTypeID>::max();
+    inline constexpr std::size_t maxMessageTypeIDs      = 1024;
+
+    namespace detail
+    {
+        /// Assigns the next free ID to the type, invalidMessageTypeID if all of them are taken.
+        MessageTypeID registerMessageType(const std::type_info &type) noexcept;
+    } // namespace detail
+
+    /// ID of the message class, assigned once on the first use.
+    template <typename T>
+    MessageTypeID messageTypeID() noexcept
+    {
+        static const MessageTypeID id = detail::registerMessageType(typeid(T));
+        return id;
+    }
+
+    /// ID the type has been registered with, invalidMessageTypeID if it has none yet.
+    MessageTypeID findMessageTypeID(const std::type_info &type) noexcept;
+
+    /// Type registered with the ID, nullptr if there is none.
+    const std::type_info *messageTypeOf(MessageTypeID id) noexcept;
+} // namespace sys
@@ -5,17 +5,21 @@
 
 #include "ServiceForward.hpp"
 #include "BusProxy.hpp"
-#include "Mailbox.hpp" // for Mailbox
+#include "MessageMailbox.hpp" // for MessageMailbox
 #include "Message.hpp" // for MessagePointer
 #include "ServiceManifest.hpp"
+#include <Timers/SystemTimer.hpp>
+#include <Timers/TimerWheel.hpp>
 #include "thread.hpp" // for Thread
 #include <SystemWatchdog/Watchdog.hpp>
 #include <SystemWatchdog/SystemWatchdog.hpp> // for SystemWatchdog
 #include <algorithm>                         // for find, max
+#include <chrono>                            // for milliseconds
 #include <cstdint>                           // for uint32_t, uint64_t
 #include <functional>                        // for function
 #include <iterator>                          // for end
 #include <map>                               // for map
+#include <optional>                          // for optional
 #include <memory>                            // for allocator, shared_ptr, enable_shared_from_this
 #include <string>                            // for string
 #include <typeindex>                         // for type_index
@@ -141,13 +145,28 @@ namespace sys
 
         BusProxy bus;
 
-        Mailbox<std::shared_ptr<Message>> mailbox;
+        MessageMailbox mailbox;
 
         Watchdog &watchdog;
 
         bool isReady;
 
+        /// Time the InitHandler took, when the service was started
+        std::chrono::milliseconds initDuration{0};
+
         /// connect: register message handler
+        /// Handlers of messages derived from TypedMessage are kept in a table indexed by the message type ID,
+        /// the others are looked up by their std::type_index.
+        template <typename Msg>
+        bool connect(MessageHandler handler)
+        {
+            if constexpr (isTypedMessage<Msg>::value) {
+                return connectTyped(messageTypeID<Msg>(), typeid(Msg), std::move(handler));
+            }
+            else {
+                return connect(typeid(Msg), std::move(handler));
+            }
+        }
         bool connect(const std::type_info &type, MessageHandler handler);
         bool connect(Message *msg, MessageHandler handler);
         bool connect(Message &&msg, MessageHandler handler);
@@ -160,7 +179,7 @@ namespace sys
                           "Response has to be based on system message");
             Async<Request, Response> async;
             auto request = std::make_shared<Request>(arg...);
-            if (isConnected(std::type_index(typeid(Response)))) {
+            if (isConnected(typeid(Response))) {
                 async.setState(Async<Request, Response>::State::Error);
                 throw async_fail("connection failure");
             }
@@ -216,9 +235,13 @@ namespace sys
         virtual void processBus() final;
 
         std::map<std::type_index, MessageHandler> message_handlers;
+        /// Handlers of typed messages, indexed by the message type ID. Held by pointers, so that a running handler
+        /// stays in place when it connects another one.
+        std::vector<std::unique_ptr<MessageHandler>> typed_handlers;
 
       private:
-        bool isConnected(std::type_index idx);
+        bool connectTyped(MessageTypeID id, const std::type_info &type, MessageHandler handler);
+        bool isConnected(const std::type_info &type);
         /// first point of enttry on messages - actually used method in run
         /// First calls message_handlers
         /// If not - fallback to DataReceivedHandler
@@ -234,18 +257,44 @@ namespace sys
 
         friend Proxy;
 
+        /// Timers of the service, kept in a timer wheel driven by a single OS timer
         class Timers
         {
             friend timer::SystemTimer;
 
           private:
             std::vector<timer::SystemTimer *> list;
+            timer::TimerWheel wheel;
+            timer::WheelAlarm alarm;
+            std::optional<std::uint64_t> armedAt;
+            std::uint64_t slack = 0;
+            TickType_t lastTicks = 0;
+            std::uint64_t ticksEpoch = 0;
+            cpp_freertos::MutexStandard mutex;
+
             void attach(timer::SystemTimer *timer);
             void detach(timer::SystemTimer *timer);
+            void schedule(timer::SystemTimer *timer, std::chrono::milliseconds interval);
+            void reschedule(timer::SystemTimer *timer, std::chrono::milliseconds interval);
+            void cancel(timer::SystemTimer *timer);
+            [[nodiscard]] auto popExpired() -> timer::SystemTimer *;
+            /// Arms the OS timer for the earliest expiry if it is not armed early enough, called with the mutex locked
+            void rearm(std::uint64_t now);
+            /// 64 bit tick count, called with the mutex locked
+            [[nodiscard]] auto now() -> std::uint64_t;
 
           public:
+            explicit Timers(Service *owner);
+
             void stop();
             [[nodiscard]] auto get(timer::SystemTimer *timer) noexcept -> timer::SystemTimer *;
+            /// Fires the expired timers, called on the service thread when the tick of the OS timer is handled
+            void expire();
+
+            /// Lets the timers expire up to the slack later, so that wakeups of timers expiring close to each other
+            /// are batched. Wakeups are aligned to multiples of the slack, also across the services.
+            void setSlack(std::chrono::milliseconds value);
+            [[nodiscard]] auto getStatistics() -> timer::TimerWheelStatistics;
         } timers;
 
         MessagePointer currentlyProcessing = nullptr;
@@ -0,0 +1,100 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+
+namespace sys
+{
+    using ServiceID = std::uint16_t;
+
+    inline constexpr ServiceID invalidServiceID = std::numeric_limits<ServiceID>::max();
+
+    /**
+     * Interned name of a service.
+     *
+     * Each distinct service name is registered once and gets a small, stable numeric ID which is kept for the whole
+     * lifetime of the system (also across service restarts). The bus routes and compares messages by the ID only;
+     * the string is kept solely for logging and for the legacy string based API.
+     */
+    class ServiceName
+    {
+      public:
+        /// Upper bound of distinct service names the system is able to intern.
+        static constexpr std::size_t maxNames = 128;
+
+        ServiceName() = default;
+        explicit ServiceName(ServiceID id) noexcept;
+        explicit ServiceName(std::string_view name);
+
+        ServiceName &operator=(std::string_view name);
+        ServiceName &operator=(const std::string &name);
+        ServiceName &operator=(const char *name);
+
+        [[nodiscard]] ServiceID id() const noexcept
+        {
+            return value;
+        }
+        [[nodiscard]] bool isValid() const noexcept
+        {
+            return value != invalidServiceID;
+        }
+
+        [[nodiscard]] const std::string &str() const noexcept;
+        [[nodiscard]] const char *c_str() const noexcept
+        {
+            return str().c_str();
+        }
+        operator const std::string &() const noexcept
+        {
+            return str();
+        }
+
+        /**
+         * Registers the name (if not registered yet) and returns its ID.
+         * @param name  Service name
+         * @return ID of the name, invalidServiceID if the table is full
+         */
+        static ServiceID intern(std::string_view name);
+
+        /**
+         * Looks up the ID of an already registered name. Lock-free.
+         * @param name  Service name
+         * @return ID of the name, invalidServiceID if the name is unknown
+         */
+        [[nodiscard]] static ServiceID find(std::string_view name) noexcept;
+
+      private:
+        ServiceID value = invalidServiceID;
+    };
+
+    inline bool operator==(const ServiceName &lhs, const ServiceName &rhs) noexcept
+    {
+        return lhs.id() == rhs.id();
+    }
+    inline bool operator!=(const ServiceName &lhs, const ServiceName &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    inline bool operator==(const ServiceName &lhs, std::string_view rhs) noexcept
+    {
+        return lhs.str() == rhs;
+    }
+    inline bool operator!=(const ServiceName &lhs, std::string_view rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    inline bool operator==(std::string_view lhs, const ServiceName &rhs) noexcept
+    {
+        return rhs == lhs;
+    }
+    inline bool operator!=(std::string_view lhs, const ServiceName &rhs) noexcept
+    {
+        return !(rhs == lhs);
+    }
+} // namespace sys
@@ -0,0 +1,118 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sys::metrics
+{
+    enum class RecordKind : std::uint8_t
+    {
+        Window,         ///< source: CPU frequency [MHz], value: window length [ms], extra: free user heap [B]
+        TaskUsage,      ///< source: task name, value: CPU share [0.01 %], extra: heap high-water mark [B]
+        Residency,      ///< source: CPU frequency [MHz] or wfiFrequency, value: time spent at it [ms]
+        SentinelRequest ///< source: sentinel name, value: requested frequency [MHz], extra: 1 if WFI is blocked
+    };
+
+    /// Single entry of the metrics ring, a window is stored as its Window record followed by the others.
+    struct Record
+    {
+        std::uint32_t timestamp; ///< End of the window [ms since boot]
+        RecordKind kind;
+        std::uint8_t reserved;
+        std::uint16_t source;
+        std::uint32_t value;
+        std::uint32_t extra;
+    };
+    static_assert(sizeof(Record) == 16, "Records are meant to stay compact");
+
+    /// Frequency under which the time spent in WFI is reported
+    inline constexpr std::uint16_t wfiFrequency = 0;
+    /// CPU share is given in hundredths of a percent
+    inline constexpr std::uint32_t fullCpuShare = 10000;
+
+    struct TaskUsage
+    {
+        std::string name;
+        std::uint32_t cpuShare; ///< [0.01 %]
+        std::uint32_t heapPeak; ///< [B]
+    };
+
+    struct Residency
+    {
+        std::uint16_t frequency; ///< [MHz]
+        std::uint32_t time;      ///< [ms]
+    };
+
+    struct SentinelRequest
+    {
+        std::string name;
+        std::uint16_t frequency; ///< [MHz]
+        bool wfiBlocked;
+    };
+
+    /// Everything measured in a single sampling window
+    struct Window
+    {
+        std::uint32_t timestamp{0}; ///< End of the window [ms since boot]
+        std::uint32_t length{0};    ///< [ms]
+        std::uint16_t frequency{0}; ///< CPU frequency at the end of the window [MHz]
+        std::uint32_t freeHeap{0};  ///< [B]
+        std::vector<TaskUsage> tasks;
+        std::vector<Residency> residency;
+        std::vector<SentinelRequest> sentinels;
+    };
+
+    /// Windows aggregated over a period: CPU shares are averaged, heap peaks are the highest ones, residency is
+    /// summed and sentinel requests are the latest ones.
+    struct Summary
+    {
+        std::uint32_t length{0}; ///< Time actually covered [ms]
+        std::uint32_t windows{0};
+        std::vector<TaskUsage> tasks;
+        std::vector<Residency> residency;
+        std::vector<SentinelRequest> sentinels;
+    };
+
+    /// Fixed capacity ring of records, the oldest windows are overwritten. Names are stored once in a table.
+    class MetricsRing
+    {
+      public:
+        explicit MetricsRing(std::size_t capacity);
+
+        void push(const Window &window);
+        /// Complete windows from the oldest one
+        [[nodiscard]] auto windows() const -> std::vector<Window>;
+        /// Aggregate of the latest windows covering at least the period, or all of them
+        [[nodiscard]] auto summarize(std::uint32_t period) const -> Summary;
+        /// One line per record: timestamp_ms,record,source,value,extra
+        [[nodiscard]] auto toCsv() const -> std::string;
+        [[nodiscard]] auto size() const noexcept -> std::size_t;
+
+      private:
+        auto nameID(std::string_view name) -> std::uint16_t;
+        [[nodiscard]] auto nameOf(std::uint16_t id) const -> std::string;
+        void append(const Record &record);
+        [[nodiscard]] auto ordered() const -> std::vector<Record>;
+
+        std::vector<Record> records;
+        std::size_t next{0};
+        std::size_t count{0};
+        std::vector<std::string> names;
+    };
+
+    inline constexpr std::size_t metricsCapacity = 2048;
+
+    /// Stores the window in the system wide ring, filled by the System Manager.
+    void record(const Window &window);
+    /// Aggregate of the latest windows of the system wide ring covering the period [ms]
+    [[nodiscard]] auto summarize(std::uint32_t period) -> Summary;
+    /// Writes the system wide ring as CSV
+    bool exportCsv(const std::filesystem::path &path);
+} // namespace sys::metrics
@@ -6,6 +6,7 @@
 #include "FreeRTOS.h"
 #include "portmacro.h"
 #include <Timers/Timer.hpp>
+#include <Timers/TimerWheel.hpp>
 #include <timer.hpp>
 #include <functional>
 #include <string>
@@ -18,7 +19,8 @@ namespace sys
 
 namespace sys::timer
 {
-    class SystemTimer : public Timer, private cpp_freertos::Timer
+    /// Timer of a service, scheduled in the timer wheel of the service and fired on its thread
+    class SystemTimer : public Timer, public WheelEntry
     {
       public:
         /// Create named timer and register it in parent
@@ -43,12 +45,6 @@ namespace sys::timer
         void onTimeout();
 
       private:
-        /// This is final by design - to avoid missuse we send Timer notification to Service
-        /// and then handle it like any other event. Not by callback as this could cause unrestricted access (no mutex)
-        void Run() final;
-        /// executed when we receive timeout notification (from overriden Run()) on bus
-        void startTimer();
-        void stopTimerIfActive();
         void attachToService();
 
         std::string name;
@@ -58,4 +54,24 @@ namespace sys::timer
         Service *parent         = nullptr;
         std::atomic_bool active = false;
     };
+
+    /// The only OS timer of a service, armed for the earliest expiry in the timer wheel of the service
+    class WheelAlarm : private cpp_freertos::Timer
+    {
+      public:
+        explicit WheelAlarm(Service *parent);
+
+        bool arm(TickType_t delay);
+        void disarm();
+        /// Lets the next timeout send a tick again, called by the service when it handles the tick
+        void acknowledge() noexcept;
+
+      private:
+        /// This is final by design - to avoid missuse we send Timer notification to Service
+        /// and then handle it like any other event. Not by callback as this could cause unrestricted access (no mutex)
+        void Run() final;
+
+        Service *parent;
+        std::atomic_bool tickPending = false;
+    };
 }; // namespace sys::timer
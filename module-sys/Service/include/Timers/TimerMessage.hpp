@@ -7,20 +7,11 @@
 
 namespace sys
 {
-    class Timer; // Forward declaration
-
+    /// Tick of the timers of a service, its expired timers are fired when it is handled
     class TimerMessage : public SystemMessage
     {
-        timer::SystemTimer *timer = nullptr;
-
       public:
-        explicit TimerMessage(timer::SystemTimer *timer)
-            : SystemMessage(SystemMessageType::Timer, ServicePowerMode::Active), timer(timer)
+        TimerMessage() : SystemMessage(SystemMessageType::Timer, ServicePowerMode::Active)
         {}
-
-        [[nodiscard]] auto getTimer() noexcept -> timer::SystemTimer *
-        {
-            return timer;
-        }
     };
 } // namespace sys
@@ -0,0 +1,110 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace sys::timer
+{
+    struct TimerWheelStatistics
+    {
+        std::uint32_t active      = 0; ///< Timers currently scheduled or expired and waiting to be fired
+        std::uint32_t peakActive  = 0;
+        std::uint32_t starts      = 0;
+        std::uint32_t cancels     = 0;
+        std::uint32_t expirations = 0;
+        std::uint32_t cascades    = 0; ///< Timers moved to a finer level of the wheel
+        std::uint32_t wakeups     = 0; ///< Ticks of the OS timer driving the wheel, counted by the owner
+        std::uint32_t alarms      = 0; ///< Reprogrammings of the OS timer driving the wheel, counted by the owner
+    };
+
+    /// Intrusive hook of a timer scheduled in a TimerWheel.
+    class WheelEntry
+    {
+      public:
+        [[nodiscard]] bool isScheduled() const noexcept
+        {
+            return bucket != unlinked;
+        }
+
+        [[nodiscard]] std::uint64_t getExpiry() const noexcept
+        {
+            return expiry;
+        }
+
+      private:
+        friend class TimerWheel;
+        static constexpr std::uint16_t unlinked = 0xFFFF;
+
+        WheelEntry *prev     = nullptr;
+        WheelEntry *next     = nullptr;
+        std::uint64_t expiry = 0;
+        std::uint16_t bucket = unlinked;
+    };
+
+    /**
+     * Hierarchical timer wheel, time is expressed in ticks. Not thread safe.
+     *
+     * Level 0 has a slot per tick, every next level has slots 64 times coarser. A timer lands on the level covering
+     * its distance from the current tick and cascades down to finer levels while the time advances, so both
+     * scheduling and cancelling are O(1) regardless of the number of timers. Timers farther than the last level
+     * covers (about 4.6 hours of 1 ms ticks) wait in its farthest slot and are placed again when it cascades.
+     */
+    class TimerWheel
+    {
+      public:
+        static constexpr std::size_t levels        = 4;
+        static constexpr std::size_t slotBits      = 6;
+        static constexpr std::size_t slotsPerLevel = 1U << slotBits;
+
+        explicit TimerWheel(std::uint64_t now = 0) noexcept;
+        ~TimerWheel() noexcept;
+        TimerWheel(const TimerWheel &) = delete;
+        TimerWheel &operator=(const TimerWheel &) = delete;
+
+        /**
+         * Schedules an entry, reschedules it if it is scheduled already.
+         * @param entry     Hook of the timer
+         * @param expiry    Tick the timer expires at, a tick which already passed expires the timer immediately
+         */
+        void schedule(WheelEntry &entry, std::uint64_t expiry) noexcept;
+        /// Removes an entry from the wheel, both from its slot and from the expired timers.
+        void cancel(WheelEntry &entry) noexcept;
+
+        /// Advances the wheel to the given tick, timers expiring until then are moved to the expired ones.
+        void advance(std::uint64_t now) noexcept;
+        /// Takes the next expired timer, nullptr if there are none.
+        [[nodiscard]] WheelEntry *popExpired() noexcept;
+
+        /// Earliest expiry of the scheduled timers, the current tick if there are expired timers waiting.
+        [[nodiscard]] std::optional<std::uint64_t> nextExpiry() const noexcept;
+        [[nodiscard]] std::uint64_t now() const noexcept;
+        [[nodiscard]] bool empty() const noexcept;
+
+        [[nodiscard]] const TimerWheelStatistics &getStatistics() const noexcept;
+        [[nodiscard]] TimerWheelStatistics &getStatistics() noexcept;
+
+        /// Rounds a tick up to a multiple of the slack, so that timers expiring close to each other share a wakeup.
+        [[nodiscard]] static std::uint64_t coalesce(std::uint64_t tick, std::uint64_t slack) noexcept;
+
+      private:
+        static constexpr std::uint16_t expiredBucket = levels * slotsPerLevel;
+
+        void place(WheelEntry &entry) noexcept;
+        void link(WheelEntry &entry, std::uint16_t bucket) noexcept;
+        void unlink(WheelEntry &entry) noexcept;
+        void cascade(std::size_t level, std::size_t slot) noexcept;
+        void process(std::uint64_t tick) noexcept;
+        [[nodiscard]] std::optional<std::uint64_t> nextEvent() const noexcept;
+
+        std::array<WheelEntry *, levels * slotsPerLevel + 1> buckets{};
+        std::array<std::uint64_t, levels> occupied{}; ///< Bitmaps of non empty slots of each level
+        WheelEntry *expiredTail = nullptr;
+        std::uint64_t current;
+        TimerWheelStatistics statistics;
+    };
+} // namespace sys::timer
@@ -0,0 +1,105 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <Service/Service.hpp>
+
+#include <array>
+#include <memory>
+#include <utility>
+
+namespace
+{
+    constexpr std::size_t messageTypes = 50;
+
+    template <std::size_t N>
+    class TypedMessage : public sys::TypedMessage<TypedMessage<N>>
+    {};
+
+    template <std::size_t N>
+    class LegacyMessage : public sys::DataMessage
+    {};
+
+    class BenchmarkService : public sys::Service
+    {
+      public:
+        BenchmarkService() : sys::Service("BenchmarkService")
+        {
+            isReady = true;
+        }
+
+        sys::MessagePointer DataReceivedHandler(sys::DataMessage *, sys::ResponseMessage *) override
+        {
+            return nullptr;
+        }
+
+        sys::ReturnCodes InitHandler() override
+        {
+            return sys::ReturnCodes::Success;
+        }
+
+        sys::ReturnCodes DeinitHandler() override
+        {
+            return sys::ReturnCodes::Success;
+        }
+
+        sys::ReturnCodes SwitchPowerModeHandler(const sys::ServicePowerMode) override
+        {
+            return sys::ReturnCodes::Success;
+        }
+
+        template <template <std::size_t> class Msg, std::size_t... N>
+        void connectAll(std::index_sequence<N...>)
+        {
+            (connect<Msg<N>>([this](sys::Message *) -> sys::MessagePointer {
+                 ++handled;
+                 return nullptr;
+             }),
+             ...);
+        }
+
+        std::size_t handled = 0;
+    };
+
+    using Messages = std::array<std::unique_ptr<sys::Message>, messageTypes>;
+
+    template <template <std::size_t> class Msg, std::size_t... N>
+    Messages makeMessages(std::index_sequence<N...>)
+    {
+        return Messages{std::make_unique<Msg<N>>()...};
+    }
+
+    std::size_t dispatchAll(BenchmarkService &service, const Messages &messages)
+    {
+        for (const auto &message : messages) {
+            message->Execute(&service);
+        }
+        return service.handled;
+    }
+} // namespace
+
+TEST_CASE("Message dispatch of a service handling 50 message types", "[!benchmark]")
+{
+    constexpr auto sequence = std::make_index_sequence<messageTypes>{};
+
+    BenchmarkService typedService;
+    typedService.connectAll<TypedMessage>(sequence);
+    const auto typedMessages = makeMessages<TypedMessage>(sequence);
+
+    BenchmarkService legacyService;
+    legacyService.connectAll<LegacyMessage>(sequence);
+    const auto legacyMessages = makeMessages<LegacyMessage>(sequence);
+
+    BENCHMARK("50 typed messages")
+    {
+        return dispatchAll(typedService, typedMessages);
+    };
+
+    BENCHMARK("50 legacy messages")
+    {
+        return dispatchAll(legacyService, legacyMessages);
+    };
+
+    REQUIRE(typedService.handled % messageTypes == 0);
+    REQUIRE(legacyService.handled % messageTypes == 0);
+}
@@ -0,0 +1,290 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <Service/MessageMailbox.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+    class TestNotification : public sys::DataMessage
+    {
+      public:
+        explicit TestNotification(int value) : value{value}
+        {
+            transType = sys::Message::TransmissionType::Multicast;
+        }
+        int value;
+    };
+
+    class TestRequest : public sys::DataMessage
+    {};
+
+    /// Status of one of several sources, each one superseded by its next status
+    class TestStatus : public TestNotification
+    {
+      public:
+        TestStatus(int source, int value) : TestNotification{value}, source{source}
+        {}
+
+        [[nodiscard]] bool supersedes(const sys::Message &queued) const noexcept override
+        {
+            return static_cast<const TestStatus &>(queued).source == source;
+        }
+
+        int source;
+    };
+
+    int valueOf(const sys::MessagePointer &message)
+    {
+        return static_cast<TestNotification &>(*message).value;
+    }
+
+    constexpr auto laneIdx(sys::MailboxLane lane)
+    {
+        return static_cast<std::size_t>(lane);
+    }
+} // namespace
+
+TEST_CASE("Mailbox serves lanes by priority")
+{
+    sys::MailboxQueue queue;
+
+    queue.push(std::make_shared<TestNotification>(1));
+    queue.push(std::make_shared<TestRequest>());
+    queue.push(std::make_shared<sys::SystemMessage>(sys::SystemMessageType::Start));
+
+    REQUIRE(queue.size() == 3);
+    REQUIRE(queue.pop()->type == sys::Message::Type::System);
+    REQUIRE(dynamic_cast<TestRequest *>(queue.pop().get()) != nullptr);
+    REQUIRE(valueOf(queue.pop()) == 1);
+    REQUIRE(queue.empty());
+    REQUIRE(queue.pop() == nullptr);
+}
+
+TEST_CASE("Mailbox does not starve lower lanes")
+{
+    sys::MailboxQueue queue;
+
+    queue.push(std::make_shared<TestNotification>(1));
+    for (std::uint32_t i = 0; i < sys::MailboxQueue::fairnessBudget; ++i) {
+        queue.push(std::make_shared<TestRequest>());
+    }
+
+    for (std::uint32_t i = 0; i < sys::MailboxQueue::fairnessBudget - 1; ++i) {
+        REQUIRE(dynamic_cast<TestRequest *>(queue.pop().get()) != nullptr);
+    }
+    REQUIRE(dynamic_cast<TestNotification *>(queue.pop().get()) != nullptr);
+}
+
+TEST_CASE("Mailbox keeps notifications by default")
+{
+    sys::MailboxQueue queue;
+    queue.setCapacity(sys::MailboxLane::Background, 2);
+
+    for (int i = 0; i < 4; ++i) {
+        queue.push(std::make_shared<TestNotification>(i));
+    }
+
+    const auto &stats = queue.getStatistics()[laneIdx(sys::MailboxLane::Background)];
+    REQUIRE(stats.dropped == 0);
+    REQUIRE(stats.overflows == 2);
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(valueOf(queue.pop()) == i);
+    }
+}
+
+TEST_CASE("Mailbox drops the oldest notification when the lane is full")
+{
+    sys::MailboxQueue queue;
+    queue.setCapacity(sys::MailboxLane::Background, 2);
+    queue.setRule(typeid(TestNotification), {sys::MailboxLane::Background, sys::MailboxPolicy::DropOldest});
+
+    for (int i = 0; i < 4; ++i) {
+        queue.push(std::make_shared<TestNotification>(i));
+    }
+
+    const auto &stats = queue.getStatistics()[laneIdx(sys::MailboxLane::Background)];
+    REQUIRE(stats.pushed == 4);
+    REQUIRE(stats.dropped == 2);
+    REQUIRE(stats.highWaterMark == 2);
+    REQUIRE(valueOf(queue.pop()) == 2);
+    REQUIRE(valueOf(queue.pop()) == 3);
+}
+
+TEST_CASE("Mailbox never drops kept messages")
+{
+    sys::MailboxQueue queue;
+    queue.setCapacity(sys::MailboxLane::Interactive, 1);
+
+    for (int i = 0; i < 3; ++i) {
+        queue.push(std::make_shared<TestRequest>());
+    }
+
+    const auto &stats = queue.getStatistics()[laneIdx(sys::MailboxLane::Interactive)];
+    REQUIRE(queue.size() == 3);
+    REQUIRE(stats.dropped == 0);
+    REQUIRE(stats.overflows == 2);
+    REQUIRE(stats.highWaterMark == 3);
+}
+
+TEST_CASE("Mailbox coalesces messages of the same type")
+{
+    sys::MailboxQueue queue;
+    queue.setRule(typeid(TestNotification), {sys::MailboxLane::Background, sys::MailboxPolicy::Coalesce});
+
+    for (int i = 0; i < 5; ++i) {
+        queue.push(std::make_shared<TestNotification>(i));
+    }
+
+    const auto &stats = queue.getStatistics()[laneIdx(sys::MailboxLane::Background)];
+    REQUIRE(queue.size() == 1);
+    REQUIRE(stats.coalesced == 4);
+    REQUIRE(valueOf(queue.pop()) == 4);
+    REQUIRE(queue.getStatistics()[laneIdx(sys::MailboxLane::Background)].size == 0);
+
+    queue.resetStatistics();
+    REQUIRE(queue.getStatistics()[laneIdx(sys::MailboxLane::Background)].pushed == 0);
+}
+
+TEST_CASE("Mailbox replaces superseded messages by default")
+{
+    sys::MailboxQueue queue;
+
+    queue.push(std::make_shared<TestNotification>(0));
+    for (int i = 1; i <= 100; ++i) {
+        queue.push(std::make_shared<TestStatus>(i % 2, i));
+    }
+    queue.push(std::make_shared<TestNotification>(101));
+
+    const auto &stats = queue.getStatistics()[laneIdx(sys::MailboxLane::Background)];
+    REQUIRE(queue.size() == 4);
+    REQUIRE(stats.coalesced == 98);
+    REQUIRE(stats.overflows == 0);
+    // the latest statuses take the places of the first ones, notifications stay in order around them
+    REQUIRE(valueOf(queue.pop()) == 0);
+    REQUIRE(valueOf(queue.pop()) == 99);
+    REQUIRE(valueOf(queue.pop()) == 100);
+    REQUIRE(valueOf(queue.pop()) == 101);
+}
+
+TEST_CASE("Mailbox rule overrides the default lane")
+{
+    sys::MailboxQueue queue;
+    queue.setRule(typeid(TestNotification), {sys::MailboxLane::Interactive, sys::MailboxPolicy::Keep});
+
+    queue.push(std::make_shared<TestRequest>());
+    queue.push(std::make_shared<TestNotification>(7));
+
+    REQUIRE(queue.getStatistics()[laneIdx(sys::MailboxLane::Interactive)].size == 2);
+    REQUIRE(queue.getStatistics()[laneIdx(sys::MailboxLane::Background)].size == 0);
+}
+
+namespace
+{
+    sys::MessagePointer withUniID(sys::MessagePointer message, sys::MessageUIDType uniID)
+    {
+        message->uniID = uniID;
+        return message;
+    }
+
+    /// Mailbox lock without a service thread, a tick is taken as a millisecond
+    class HostMailboxLock : public sys::MailboxLock
+    {
+      public:
+        void lock() override
+        {
+            mutex.lock();
+        }
+
+        void unlock() override
+        {
+            mutex.unlock();
+        }
+
+        bool wait(TickType_t ticks) override
+        {
+            return condition.wait_for(mutex, std::chrono::milliseconds{ticks}) == std::cv_status::no_timeout;
+        }
+
+        void signal() override
+        {
+            condition.notify_one();
+        }
+
+      private:
+        std::mutex mutex;
+        std::condition_variable_any condition;
+    };
+
+    sys::MessageMailbox hostMailbox()
+    {
+        return sys::MessageMailbox{std::make_unique<HostMailboxLock>()};
+    }
+} // namespace
+
+TEST_CASE("Mailbox hands responses over to reply slots")
+{
+    auto mailbox = hostMailbox();
+    const auto request  = withUniID(std::make_shared<TestRequest>(), 1);
+    const auto response = withUniID(std::make_shared<sys::ResponseMessage>(), 2);
+
+    mailbox.expectReply(2);
+    mailbox.push(request);
+    mailbox.pushResponse(response);
+
+    REQUIRE(mailbox.awaitReply(2, 0) == response);
+    REQUIRE(mailbox.pop(0) == request);
+    REQUIRE(mailbox.empty());
+}
+
+TEST_CASE("Mailbox queues responses nobody waits for")
+{
+    auto mailbox = hostMailbox();
+    const auto response = withUniID(std::make_shared<sys::ResponseMessage>(), 3);
+
+    mailbox.pushResponse(response);
+
+    REQUIRE_FALSE(mailbox.empty());
+    REQUIRE(mailbox.pop(0) == response);
+}
+
+TEST_CASE("Mailbox takes over an already queued reply keeping the order of other messages")
+{
+    auto mailbox = hostMailbox();
+    const auto first    = withUniID(std::make_shared<TestRequest>(), 4);
+    const auto response = withUniID(std::make_shared<sys::ResponseMessage>(), 5);
+    const auto second   = withUniID(std::make_shared<TestRequest>(), 6);
+
+    mailbox.push(first);
+    mailbox.pushResponse(response);
+    mailbox.push(second);
+
+    REQUIRE(mailbox.awaitReply(5, 0) == response);
+    REQUIRE(mailbox.pop(0) == first);
+    REQUIRE(mailbox.pop(0) == second);
+    REQUIRE(mailbox.empty());
+}
+
+TEST_CASE("Mailbox waits for a reply pushed by another thread")
+{
+    auto mailbox        = hostMailbox();
+    const auto response = withUniID(std::make_shared<sys::ResponseMessage>(), 7);
+    const auto other    = withUniID(std::make_shared<TestRequest>(), 8);
+
+    mailbox.expectReply(7);
+    std::thread responder{[&] {
+        mailbox.push(other);
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        mailbox.pushResponse(response);
+    }};
+
+    REQUIRE(mailbox.awaitReply(7, 5000) == response);
+    responder.join();
+    REQUIRE(mailbox.pop(0) == other);
+    REQUIRE(mailbox.empty());
+}
@@ -0,0 +1,149 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <Service/Service.hpp>
+
+#include <string>
+
+namespace
+{
+    class TypedA : public sys::TypedMessage<TypedA>
+    {};
+
+    class TypedB : public sys::TypedMessage<TypedB>
+    {};
+
+    class TypedLate : public sys::TypedMessage<TypedLate>
+    {};
+
+    /// Not typed on its own, so it reports the ID of TypedA
+    class DerivedFromTyped : public TypedA
+    {};
+
+    class Legacy : public sys::DataMessage
+    {};
+
+    class DispatchService : public sys::Service
+    {
+      public:
+        DispatchService() : sys::Service("DispatchService")
+        {
+            isReady = true;
+        }
+
+        sys::MessagePointer DataReceivedHandler(sys::DataMessage *, sys::ResponseMessage *) override
+        {
+            ++unhandled;
+            return nullptr;
+        }
+
+        sys::ReturnCodes InitHandler() override
+        {
+            return sys::ReturnCodes::Success;
+        }
+
+        sys::ReturnCodes DeinitHandler() override
+        {
+            return sys::ReturnCodes::Success;
+        }
+
+        sys::ReturnCodes SwitchPowerModeHandler(const sys::ServicePowerMode) override
+        {
+            return sys::ReturnCodes::Success;
+        }
+
+        sys::MessageHandler recordAs(std::string name)
+        {
+            return [this, name](sys::Message *) {
+                handled += name;
+                return sys::msgHandled();
+            };
+        }
+
+        std::string handled;
+        int unhandled = 0;
+    };
+
+    void send(DispatchService &service, sys::Message &&message)
+    {
+        message.Execute(&service);
+    }
+} // namespace
+
+TEST_CASE("Typed messages have distinct and stable IDs")
+{
+    REQUIRE(sys::messageTypeID<TypedA>() != sys::invalidMessageTypeID);
+    REQUIRE(sys::messageTypeID<TypedA>() != sys::messageTypeID<TypedB>());
+    REQUIRE(TypedA{}.getTypeID() == sys::messageTypeID<TypedA>());
+    REQUIRE(DerivedFromTyped{}.getTypeID() == sys::messageTypeID<TypedA>());
+    REQUIRE(Legacy{}.getTypeID() == sys::invalidMessageTypeID);
+
+    REQUIRE(sys::findMessageTypeID(typeid(TypedB)) == sys::messageTypeID<TypedB>());
+    REQUIRE(*sys::messageTypeOf(sys::messageTypeID<TypedB>()) == typeid(TypedB));
+    REQUIRE(sys::findMessageTypeID(typeid(Legacy)) == sys::invalidMessageTypeID);
+
+    STATIC_REQUIRE(sys::isTypedMessage<TypedA>::value);
+    STATIC_REQUIRE_FALSE(sys::isTypedMessage<DerivedFromTyped>::value);
+    STATIC_REQUIRE_FALSE(sys::isTypedMessage<Legacy>::value);
+}
+
+TEST_CASE("Service dispatches typed and legacy messages")
+{
+    DispatchService service;
+    REQUIRE(service.connect<TypedA>(service.recordAs("A")));
+    REQUIRE(service.connect(typeid(TypedB), service.recordAs("B")));
+    REQUIRE(service.connect(typeid(Legacy), service.recordAs("L")));
+
+    SECTION("Each message reaches its own handler")
+    {
+        send(service, TypedA{});
+        send(service, TypedB{});
+        send(service, Legacy{});
+        REQUIRE(service.handled == "ABL");
+        REQUIRE(service.unhandled == 0);
+    }
+
+    SECTION("Message derived from a typed one is dispatched as its base")
+    {
+        REQUIRE(service.connect(DerivedFromTyped{}, service.recordAs("D")));
+        send(service, DerivedFromTyped{});
+        REQUIRE(service.handled == "A");
+    }
+
+    SECTION("Handlers are registered once, whichever way they are connected")
+    {
+        REQUIRE_FALSE(service.connect(typeid(TypedA), service.recordAs("X")));
+        REQUIRE_FALSE(service.connect<TypedB>(service.recordAs("X")));
+        REQUIRE_FALSE(service.connect(TypedA{}, service.recordAs("X")));
+        REQUIRE_FALSE(service.connect<Legacy>(service.recordAs("X")));
+    }
+
+    SECTION("Disconnected handlers are not called")
+    {
+        REQUIRE(service.disconnect(typeid(TypedA)));
+        REQUIRE(service.disconnect(typeid(Legacy)));
+        REQUIRE_FALSE(service.disconnect(typeid(TypedA)));
+        send(service, TypedA{});
+        send(service, Legacy{});
+        send(service, TypedB{});
+        REQUIRE(service.handled == "B");
+        REQUIRE(service.unhandled == 2);
+    }
+}
+
+TEST_CASE("Service keeps handlers connected before the message type got its ID")
+{
+    DispatchService service;
+    REQUIRE(sys::findMessageTypeID(typeid(TypedLate)) == sys::invalidMessageTypeID);
+    REQUIRE(service.connect(typeid(TypedLate), service.recordAs("T")));
+
+    send(service, TypedLate{});
+    send(service, TypedLate{});
+    REQUIRE(service.handled == "TT");
+    REQUIRE_FALSE(service.connect<TypedLate>(service.recordAs("X")));
+
+    REQUIRE(service.disconnect(typeid(TypedLate)));
+    send(service, TypedLate{});
+    REQUIRE(service.handled == "TT");
+}
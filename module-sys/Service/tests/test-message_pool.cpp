@@ -0,0 +1,91 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <Service/Message.hpp>
+#include <Service/MessagePool.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    class PooledTestMessage : public sys::DataMessage
+    {
+      public:
+        explicit PooledTestMessage(int value) : value{value}
+        {}
+        int value;
+    };
+
+    class ExhaustedTestMessage : public sys::DataMessage
+    {};
+
+    sys::MessagePoolStatistics statisticsOf(const std::type_info &type)
+    {
+        const auto all = sys::getMessagePoolStatistics();
+        const auto it  = std::find_if(
+            all.begin(), all.end(), [&type](const auto &stats) { return std::strcmp(stats.name, type.name()) == 0; });
+        REQUIRE(it != all.end());
+        return *it;
+    }
+} // namespace
+
+namespace sys
+{
+    template <>
+    struct MessagePoolTraits<ExhaustedTestMessage>
+    {
+        static constexpr std::size_t capacity = 2;
+    };
+} // namespace sys
+
+TEST_CASE("Pooled messages reuse their blocks")
+{
+    const void *address = nullptr;
+    {
+        auto message = sys::makePooled<PooledTestMessage>(7);
+        REQUIRE(message->value == 7);
+        address = message.get();
+
+        const auto stats = statisticsOf(typeid(PooledTestMessage));
+        REQUIRE(stats.inUse == 1);
+        REQUIRE(stats.capacity == sys::MessagePoolTraits<PooledTestMessage>::capacity);
+    }
+
+    REQUIRE(statisticsOf(typeid(PooledTestMessage)).inUse == 0);
+
+    auto message = sys::makePooled<PooledTestMessage>(8);
+    REQUIRE(message.get() == address);
+    REQUIRE(statisticsOf(typeid(PooledTestMessage)).allocations == 2);
+}
+
+TEST_CASE("Pooled messages fall back to the heap when the pool is exhausted")
+{
+    std::vector<std::shared_ptr<ExhaustedTestMessage>> messages;
+    for (int i = 0; i < 4; ++i) {
+        messages.push_back(sys::makePooled<ExhaustedTestMessage>());
+    }
+
+    auto stats = statisticsOf(typeid(ExhaustedTestMessage));
+    REQUIRE(stats.allocations == 4);
+    REQUIRE(stats.fallbacks == 2);
+    REQUIRE(stats.inUse == 2);
+    REQUIRE(stats.peakInUse == 2);
+
+    messages.clear();
+    stats = statisticsOf(typeid(ExhaustedTestMessage));
+    REQUIRE(stats.inUse == 0);
+    REQUIRE(stats.peakInUse == 2);
+}
+
+TEST_CASE("Pooled messages are usable as message pointers")
+{
+    sys::MessagePointer message = sys::makePooled<PooledTestMessage>(3);
+    std::weak_ptr<sys::Message> observer = message;
+
+    REQUIRE(observer.lock() != nullptr);
+    message.reset();
+    REQUIRE(observer.expired());
+}
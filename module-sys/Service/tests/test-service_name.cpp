@@ -0,0 +1,62 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <Service/Message.hpp>
+#include <Service/ServiceName.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+TEST_CASE("Service name interning")
+{
+    const auto id = sys::ServiceName::intern("ServiceNameTest");
+
+    REQUIRE(id != sys::invalidServiceID);
+    REQUIRE(sys::ServiceName::intern("ServiceNameTest") == id);
+    REQUIRE(sys::ServiceName::find("ServiceNameTest") == id);
+    REQUIRE(sys::ServiceName::find("ServiceNameNeverRegistered") == sys::invalidServiceID);
+
+    const auto otherId = sys::ServiceName::intern("ServiceNameTestOther");
+    REQUIRE(otherId != id);
+
+    const sys::ServiceName name{id};
+    REQUIRE(name.isValid());
+    REQUIRE(name.str() == "ServiceNameTest");
+    REQUIRE(std::string{name.c_str()} == "ServiceNameTest");
+}
+
+TEST_CASE("Service name comparisons")
+{
+    const sys::ServiceName name{std::string_view{"ServiceNameCompare"}};
+    const sys::ServiceName same{sys::ServiceName::find("ServiceNameCompare")};
+    const sys::ServiceName other{std::string_view{"ServiceNameCompareOther"}};
+    const std::string text{"ServiceNameCompare"};
+
+    REQUIRE(name == same);
+    REQUIRE(name != other);
+    REQUIRE(name == "ServiceNameCompare");
+    REQUIRE(name != "ServiceNameCompareOther");
+    REQUIRE(name == text);
+    REQUIRE(text == name);
+    REQUIRE_FALSE(text != name);
+
+    const std::vector<std::string> names{"ServiceNameCompareOther", "ServiceNameCompare"};
+    REQUIRE(std::find(names.begin(), names.end(), name) == names.begin() + 1);
+
+    const std::string &converted = name;
+    REQUIRE(converted == text);
+}
+
+TEST_CASE("Message sender defaults to an unknown service")
+{
+    auto dataMsg = sys::DataMessage();
+
+    REQUIRE_FALSE(dataMsg.sender.isValid());
+    REQUIRE(dataMsg.sender.str() == "Unknown");
+
+    dataMsg.sender = "ServiceNameSender";
+    REQUIRE(dataMsg.sender.isValid());
+    REQUIRE(dataMsg.sender == "ServiceNameSender");
+}
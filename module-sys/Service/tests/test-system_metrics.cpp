@@ -0,0 +1,99 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <Service/SystemMetrics.hpp>
+
+using namespace sys::metrics;
+
+namespace
+{
+    Window makeWindow(std::uint32_t timestamp, std::uint32_t audioShare, std::uint32_t guiShare)
+    {
+        Window window;
+        window.timestamp = timestamp;
+        window.length    = 1000;
+        window.frequency = 132;
+        window.freeHeap  = 4096;
+        window.tasks     = {{"ServiceAudio", audioShare, 2048}, {"ServiceGUI", guiShare, 512}};
+        window.residency = {{132, 600}, {wfiFrequency, 400}};
+        window.sentinels = {{"ServiceAudio", 132, false}};
+        return window;
+    }
+} // namespace
+
+TEST_CASE("Metrics ring stores windows")
+{
+    MetricsRing ring{64};
+    ring.push(makeWindow(1000, 2500, 100));
+    ring.push(makeWindow(2000, 500, 300));
+    REQUIRE(ring.size() == 12);
+
+    const auto windows = ring.windows();
+    REQUIRE(windows.size() == 2);
+    REQUIRE(windows[0].timestamp == 1000);
+    REQUIRE(windows[1].frequency == 132);
+    REQUIRE(windows[1].freeHeap == 4096);
+    REQUIRE(windows[1].tasks.size() == 2);
+    REQUIRE(windows[1].tasks[0].name == "ServiceAudio");
+    REQUIRE(windows[1].tasks[0].cpuShare == 500);
+    REQUIRE(windows[1].residency[1].frequency == wfiFrequency);
+    REQUIRE(windows[1].sentinels[0].name == "ServiceAudio");
+}
+
+TEST_CASE("Metrics ring drops windows overwritten partially")
+{
+    MetricsRing ring{8};
+    ring.push(makeWindow(1000, 2500, 100));
+    ring.push(makeWindow(2000, 500, 300));
+
+    const auto windows = ring.windows();
+    REQUIRE(windows.size() == 1);
+    REQUIRE(windows[0].timestamp == 2000);
+    REQUIRE(windows[0].tasks.size() == 2);
+}
+
+TEST_CASE("Metrics ring summarizes the latest windows")
+{
+    MetricsRing ring{256};
+    ring.push(makeWindow(1000, 4000, 100));
+    ring.push(makeWindow(2000, 2000, 300));
+    ring.push(makeWindow(3000, 1000, 500));
+
+    SECTION("Period covered by the last two windows")
+    {
+        const auto summary = ring.summarize(2000);
+        REQUIRE(summary.windows == 2);
+        REQUIRE(summary.length == 2000);
+        REQUIRE(summary.tasks.size() == 2);
+        REQUIRE(summary.tasks[0].name == "ServiceAudio");
+        REQUIRE(summary.tasks[0].cpuShare == 1500);
+        REQUIRE(summary.tasks[1].cpuShare == 400);
+        REQUIRE(summary.tasks[0].heapPeak == 2048);
+        REQUIRE(summary.residency.size() == 2);
+        REQUIRE(summary.residency[0].frequency == wfiFrequency);
+        REQUIRE(summary.residency[0].time == 800);
+        REQUIRE(summary.residency[1].time == 1200);
+        REQUIRE(summary.sentinels.size() == 1);
+    }
+
+    SECTION("Whole ring")
+    {
+        const auto summary = ring.summarize(0);
+        REQUIRE(summary.windows == 3);
+        REQUIRE(summary.tasks[0].cpuShare == 2333);
+    }
+}
+
+TEST_CASE("Metrics ring exports CSV")
+{
+    MetricsRing ring{64};
+    ring.push(makeWindow(1000, 2500, 100));
+
+    const auto csv = ring.toCsv();
+    REQUIRE(csv.find("timestamp_ms,record,source,value,extra\n") == 0);
+    REQUIRE(csv.find("1000,window,132,1000,4096\n") != std::string::npos);
+    REQUIRE(csv.find("1000,task,ServiceAudio,2500,2048\n") != std::string::npos);
+    REQUIRE(csv.find("1000,residency,wfi,400,0\n") != std::string::npos);
+    REQUIRE(csv.find("1000,sentinel,ServiceAudio,132,0\n") != std::string::npos);
+}
@@ -0,0 +1,162 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include <Timers/TimerWheel.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using sys::timer::TimerWheel;
+using sys::timer::WheelEntry;
+
+namespace
+{
+    std::vector<WheelEntry *> drain(TimerWheel &wheel)
+    {
+        std::vector<WheelEntry *> expired;
+        while (auto entry = wheel.popExpired()) {
+            expired.push_back(entry);
+        }
+        return expired;
+    }
+} // namespace
+
+TEST_CASE("Timer wheel expires timers at their tick")
+{
+    TimerWheel wheel{1000};
+    WheelEntry near, middle, far;
+    wheel.schedule(near, 1010);
+    wheel.schedule(middle, 1000 + 5000);
+    wheel.schedule(far, 1000 + 300000);
+    REQUIRE(wheel.nextExpiry() == 1010);
+
+    wheel.advance(1009);
+    REQUIRE(drain(wheel).empty());
+    wheel.advance(1010);
+    REQUIRE(drain(wheel) == std::vector<WheelEntry *>{&near});
+    REQUIRE_FALSE(near.isScheduled());
+    REQUIRE(wheel.nextExpiry() == 6000);
+
+    wheel.advance(5999);
+    REQUIRE(drain(wheel).empty());
+    wheel.advance(6000);
+    REQUIRE(drain(wheel) == std::vector<WheelEntry *>{&middle});
+
+    wheel.advance(400000);
+    REQUIRE(drain(wheel) == std::vector<WheelEntry *>{&far});
+    REQUIRE(wheel.empty());
+    REQUIRE_FALSE(wheel.nextExpiry().has_value());
+}
+
+TEST_CASE("Timer wheel cancels and reschedules")
+{
+    TimerWheel wheel;
+    WheelEntry first, second;
+    wheel.schedule(first, 100);
+    wheel.schedule(second, 200);
+    wheel.cancel(first);
+    REQUIRE_FALSE(first.isScheduled());
+    REQUIRE(wheel.nextExpiry() == 200);
+
+    wheel.schedule(second, 50);
+    REQUIRE(wheel.nextExpiry() == 50);
+    wheel.advance(50);
+    wheel.cancel(second);
+    REQUIRE(drain(wheel).empty());
+
+    const auto &stats = wheel.getStatistics();
+    REQUIRE(stats.active == 0);
+    REQUIRE(stats.peakActive == 2);
+    REQUIRE(stats.starts == 3);
+    REQUIRE(stats.cancels == 2);
+    REQUIRE(stats.expirations == 0);
+}
+
+TEST_CASE("Timer wheel expires timers in the past immediately")
+{
+    TimerWheel wheel{500};
+    WheelEntry entry;
+    wheel.schedule(entry, 400);
+    REQUIRE(wheel.nextExpiry() == 500);
+    REQUIRE(drain(wheel) == std::vector<WheelEntry *>{&entry});
+}
+
+TEST_CASE("Timer wheel handles timers beyond its range")
+{
+    constexpr std::uint64_t farAway = std::uint64_t{1} << 30;
+    TimerWheel wheel{12345};
+    WheelEntry entry;
+    wheel.schedule(entry, 12345 + farAway);
+    REQUIRE(wheel.nextExpiry() == 12345 + farAway);
+
+    wheel.advance(12345 + farAway - 1);
+    REQUIRE(drain(wheel).empty());
+    wheel.advance(12345 + farAway);
+    REQUIRE(drain(wheel) == std::vector<WheelEntry *>{&entry});
+}
+
+TEST_CASE("Timer wheel matches a reference model")
+{
+    constexpr std::size_t timersCount = 200;
+    std::mt19937_64 random{42};
+    std::vector<WheelEntry> entries(timersCount);
+    std::vector<std::uint64_t> expiries(timersCount, 0);
+    std::vector<bool> scheduled(timersCount, false);
+
+    std::uint64_t now = 7;
+    TimerWheel wheel{now};
+    const auto randomDelay = [&random]() -> std::uint64_t {
+        // Spread the delays over all the levels of the wheel
+        const auto bits = random() % 26;
+        return random() % (std::uint64_t{1} << bits) + 1;
+    };
+
+    for (int step = 0; step < 20000; ++step) {
+        const auto idx = random() % timersCount;
+        switch (random() % 4) {
+        case 0:
+        case 1:
+            expiries[idx]  = now + randomDelay();
+            scheduled[idx] = true;
+            wheel.schedule(entries[idx], expiries[idx]);
+            break;
+        case 2:
+            scheduled[idx] = false;
+            wheel.cancel(entries[idx]);
+            break;
+        default:
+            now += randomDelay() / 8;
+            wheel.advance(now);
+            for (auto entry : drain(wheel)) {
+                const auto expired = static_cast<std::size_t>(entry - entries.data());
+                REQUIRE(scheduled[expired]);
+                REQUIRE(expiries[expired] <= now);
+                scheduled[expired] = false;
+            }
+            break;
+        }
+
+        std::optional<std::uint64_t> earliest;
+        for (std::size_t i = 0; i < timersCount; ++i) {
+            if (scheduled[i]) {
+                REQUIRE(entries[i].isScheduled());
+                if (!earliest || expiries[i] < *earliest) {
+                    earliest = expiries[i];
+                }
+            }
+        }
+        REQUIRE(wheel.nextExpiry() == earliest);
+        REQUIRE(earliest.value_or(now + 1) > now);
+    }
+}
+
+TEST_CASE("Timer wheel coalesces wakeups to the slack")
+{
+    REQUIRE(TimerWheel::coalesce(1234, 0) == 1234);
+    REQUIRE(TimerWheel::coalesce(1234, 1) == 1234);
+    REQUIRE(TimerWheel::coalesce(1234, 100) == 1300);
+    REQUIRE(TimerWheel::coalesce(1300, 100) == 1300);
+}
@@ -213,6 +213,21 @@ namespace sys
         return false;
     }
 
+    [[nodiscard]] auto CpuGovernor::GetActiveRequests() const -> std::vector<sentinel::Request>
+    {
+        std::vector<sentinel::Request> requests;
+        for (const auto &sentinel : sentinels) {
+            const auto frequency = sentinel->GetRequestedFrequency();
+            if (frequency == bsp::CpuFrequencyMHz::Level_0 && !sentinel->IsWfiBlocked()) {
+                continue;
+            }
+            if (auto sharedResource = sentinel->GetSentinel().lock()) {
+                requests.push_back({sharedResource->GetName(), frequency, sentinel->IsWfiBlocked()});
+            }
+        }
+        return requests;
+    }
+
     void CpuGovernor::InformSentinelsAboutCpuFrequencyChange(bsp::CpuFrequencyMHz newFrequency) noexcept
     {
         sentinel_foo foo = [&newFrequency](const std::shared_ptr<CpuSentinel> &s) -> bool {
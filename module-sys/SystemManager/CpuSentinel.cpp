@@ -5,6 +5,7 @@
 #include "system/messages/RequestCpuFrequencyMessage.hpp"
 #include "system/messages/HoldCpuFrequency.hpp"
 #include "system/messages/BlockWfiMode.hpp"
+#include "system/messages/WorkloadHintMessage.hpp"
 #include "system/Constants.hpp"
 #include <Timers/TimerFactory.hpp>
 #include <memory>
@@ -62,6 +63,13 @@ namespace sys
         }
     }
 
+    void CpuSentinel::HintWorkload(WorkloadHint hint, std::chrono::milliseconds expectedIn)
+    {
+        // Every hint is sent: the power manager expires hints on its own and each one carries its own start
+        auto msg = std::make_shared<sys::WorkloadHintMessage>(GetName(), hint, expectedIn);
+        owner->bus.sendUnicast(std::move(msg), service::name::system_manager);
+    }
+
     [[nodiscard]] auto CpuSentinel::GetFrequency() const noexcept -> bsp::CpuFrequencyMHz
     {
         return currentFrequency;
@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <string_view>
+#include <unordered_map>
 
 namespace sys
 {
@@ -29,4 +31,26 @@ namespace sys
     {
         return strategy->sort(nodes);
     }
+
+    auto DependencyGraph::sortInLevels() const -> graph::Levels
+    {
+        graph::Levels levels;
+        std::unordered_map<std::string_view, std::size_t> levelOf;
+        for (const auto &node : sort()) {
+            // Dependencies precede the node in the sorted order, so their levels are already known
+            std::size_t level = 0;
+            for (const auto &dependency : node.get().getDependencies()) {
+                if (const auto it = levelOf.find(dependency); it != levelOf.end()) {
+                    level = std::max(level, it->second + 1);
+                }
+            }
+            levelOf[node.get().getName()] = level;
+
+            if (levels.size() <= level) {
+                levels.resize(level + 1);
+            }
+            levels[level].push_back(node);
+        }
+        return levels;
+    }
 } // namespace sys
@@ -4,17 +4,21 @@
 #include "SystemManager/cpu/algorithm/FrequencyHold.hpp"
 #include "SystemManager/cpu/algorithm/ImmediateUpscale.hpp"
 #include "SystemManager/cpu/algorithm/FrequencyStepping.hpp"
+#include "SystemManager/cpu/algorithm/PredictiveScaling.hpp"
 #include "cpu/AlgorithmFactory.hpp"
 #include "magic_enum.hpp"
 #include <SystemManager/CpuStatistics.hpp>
 #include <SystemManager/PowerManager.hpp>
 #include <gsl/util>
 #include <log/log.hpp>
+#include <log/debug.hpp>
 #include <Logger.hpp>
 #include <Utils.hpp>
 #include <FreeRTOS.h>
 #include <ticks.hpp>
 
+#include <cinttypes>
+
 namespace sys
 {
     namespace
@@ -74,6 +78,9 @@ namespace sys
         cpuAlgorithms->emplace(sys::cpu::AlgoID::ImmediateUpscale, std::make_unique<sys::cpu::ImmediateUpscale>());
         cpuAlgorithms->emplace(sys::cpu::AlgoID::FrequencyStepping,
                                std::make_unique<sys::cpu::FrequencyStepping>(powerProfile));
+        auto predictive   = std::make_unique<sys::cpu::PredictiveScaling>(powerProfile);
+        predictiveScaling = predictive.get();
+        cpuAlgorithms->emplace(sys::cpu::AlgoID::PredictiveScaling, std::move(predictive));
 
         cpuFrequencyMonitors.push_back(CpuFrequencyMonitor(lowestLevelName));
         cpuFrequencyMonitors.push_back(CpuFrequencyMonitor(middleLevelName));
@@ -121,16 +128,27 @@ namespace sys
     {
         const std::uint32_t cpuLoad = cpuStatistics.GetPercentageCpuLoad();
         cpu::UpdateResult retval;
-        const cpu::AlgorithmData data{
-            cpuLoad, lowPowerControl->GetCurrentFrequencyLevel(), GetMinimumCpuFrequencyRequested()};
+        const cpu::AlgorithmData data{cpuLoad,
+                                      lowPowerControl->GetCurrentFrequencyLevel(),
+                                      GetMinimumCpuFrequencyRequested(),
+                                      std::chrono::milliseconds{cpp_freertos::Ticks::TicksToMs(xTaskGetTickCount())}};
+
+#if DEBUG_CPU_GOVERNOR_TRACE == 1
+        LOG_PRINTF("cpu_trace,load,%lld,%d,%" PRIu32 "\n",
+                   static_cast<long long>(data.timestamp.count()),
+                   static_cast<int>(data.curentFrequency),
+                   cpuLoad);
+#endif
 
         auto _ = gsl::finally([&retval, this, data] {
             retval.frequencySet = lowPowerControl->GetCurrentFrequencyLevel();
             retval.data         = data.sentinel;
         });
 
-        auto algorithms = {
-            sys::cpu::AlgoID::FrequencyHold, sys::cpu::AlgoID::ImmediateUpscale, sys::cpu::AlgoID::FrequencyStepping};
+        auto algorithms = {sys::cpu::AlgoID::FrequencyHold,
+                           sys::cpu::AlgoID::ImmediateUpscale,
+                           sys::cpu::AlgoID::PredictiveScaling,
+                           sys::cpu::AlgoID::FrequencyStepping};
 
         auto result    = cpuAlgorithms->calculate(algorithms, data, &retval.id);
         retval.changed = result.change;
@@ -151,6 +169,8 @@ namespace sys
 
     void PowerManager::RemoveSentinel(std::string sentinelName) const
     {
+        // a hint applying until withdrawn would otherwise keep the frequency up after its sentinel is gone
+        predictiveScaling->SetHint(sentinelName, WorkloadHint::None, {});
         cpuGovernor->RemoveSentinel(std::move(sentinelName));
     }
 
@@ -178,6 +198,21 @@ namespace sys
         return cpuAlgorithms->get(sys::cpu::AlgoID::FrequencyHold) != nullptr;
     }
 
+    void PowerManager::SetWorkloadHint(const std::string &sentinelName,
+                                       WorkloadHint hint,
+                                       std::chrono::milliseconds expectedIn)
+    {
+        const auto now = std::chrono::milliseconds{cpp_freertos::Ticks::TicksToMs(xTaskGetTickCount())};
+#if DEBUG_CPU_GOVERNOR_TRACE == 1
+        LOG_PRINTF("cpu_trace,hint,%lld,%s,%s,%lld\n",
+                   static_cast<long long>(now.count()),
+                   sentinelName.c_str(),
+                   std::string(magic_enum::enum_name(hint)).c_str(),
+                   static_cast<long long>(expectedIn.count()));
+#endif
+        predictiveScaling->SetHint(sentinelName, hint, now + expectedIn);
+    }
+
     void PowerManager::SetPermanentFrequency(bsp::CpuFrequencyMHz freq)
     {
         cpuAlgorithms->emplace(sys::cpu::AlgoID::FrequencyHold,
@@ -220,6 +255,7 @@ namespace sys
                              : (currentFreq == bsp::CpuFrequencyMHz::Level_6 ? highestLevelName : middleLevelName);
 
         UpdateCpuFrequencyMonitor(levelName, ticks - lastCpuFrequencyChangeTimestamp);
+        frequencyResidency.levels[currentFreq] += ticks - lastCpuFrequencyChangeTimestamp;
         lastCpuFrequencyChangeTimestamp = ticks;
     }
 
@@ -254,6 +290,7 @@ namespace sys
             lowPowerControl->EnableSysTick();
             portEXIT_CRITICAL();
             UpdateCpuFrequencyMonitor(WfiName, timeSpentInWFI);
+            frequencyResidency.wfi += cpp_freertos::Ticks::MsToTicks(timeSpentInWFI);
             UpdateCpuFrequencyMonitorTimestamp();
         }
     }
@@ -277,4 +314,30 @@ namespace sys
         taskStatistics.LogCpuUsage();
         cpuGovernor->PrintActiveSentinels();
     }
+
+    [[nodiscard]] auto PowerManager::GetCurrentFrequency() const noexcept -> bsp::CpuFrequencyMHz
+    {
+        return lowPowerControl->GetCurrentFrequencyLevel();
+    }
+
+    [[nodiscard]] auto PowerManager::GetFrequencyResidency() -> FrequencyResidency
+    {
+        UpdateCpuFrequencyMonitor(lowPowerControl->GetCurrentFrequencyLevel());
+        return frequencyResidency;
+    }
+
+    [[nodiscard]] auto PowerManager::GetNumberOfWorkloadHints() const noexcept -> std::size_t
+    {
+        return predictiveScaling->GetNumberOfHints();
+    }
+
+    [[nodiscard]] auto PowerManager::GetSentinelRequests() const -> std::vector<sentinel::Request>
+    {
+        auto requests              = cpuGovernor->GetActiveRequests();
+        const auto logSentinelView = logSentinel->GetRequestedFrequency();
+        if (logSentinelView.minFrequency != bsp::CpuFrequencyMHz::Level_0) {
+            requests.push_back({logSentinelView.name, logSentinelView.minFrequency, false});
+        }
+        return requests;
+    }
 } // namespace sys
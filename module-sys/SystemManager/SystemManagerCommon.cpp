@@ -25,6 +25,7 @@
 #include <system/messages/RequestCpuFrequencyMessage.hpp>
 #include <system/messages/HoldCpuFrequency.hpp>
 #include <system/messages/BlockWfiMode.hpp>
+#include <system/messages/WorkloadHintMessage.hpp>
 #include <time/ScopedTime.hpp>
 #include "Timers/TimerFactory.hpp"
 #include <service-appmgr/StartupType.hpp>
@@ -33,6 +34,7 @@
 #include <module-gui/gui/Common.hpp>
 #include <hal/boot_control.h>
 #include <algorithm>
+#include <cinttypes>
 
 namespace sys
 {
@@ -69,6 +71,7 @@ namespace sys
         inline constexpr std::chrono::milliseconds timerInitInterval{30s};
         inline constexpr std::chrono::milliseconds timerPeriodInterval{100ms};
         inline constexpr std::chrono::milliseconds powerManagerLogsTimerInterval{1h};
+        inline constexpr std::chrono::milliseconds systemMetricsTimerInterval{1min};
         inline constexpr auto restoreTimeout{5000};
     } // namespace constants
 
@@ -208,32 +211,89 @@ namespace sys
     void SystemManagerCommon::StartSystemServices()
     {
         DependencyGraph depGraph{graph::nodesFrom(systemServiceCreators), std::make_unique<graph::TopologicalSort>()};
-        const auto &sortedServices = [&depGraph]() {
+        const auto &levels = [&depGraph]() {
             utils::time::Scoped timer{"DependencyGraph"};
-            return depGraph.sort();
+            return depGraph.sortInLevels();
         }();
 
         LOG_INFO("Order of system services initialization:");
-        for (const auto &service : sortedServices) {
-            LOG_INFO("\t> %s", service.get().getName().c_str());
+        for (std::size_t level = 0; level < levels.size(); ++level) {
+            for (const auto &service : levels[level]) {
+                LOG_INFO("\t> %s (level %zu)", service.get().getName().c_str(), level);
+            }
         }
-        std::for_each(sortedServices.begin(), sortedServices.end(), [this](const auto &service) {
-            const auto startTimeout = service.get().getStartTimeout().count();
-            if (const auto success = RunSystemService(service.get().create(), this, startTimeout); !success) {
-                LOG_FATAL("Unable to start service: %s", service.get().getName().c_str());
+
+        // Services of a level depend only on the services of the previous levels, so they are started concurrently
+        const auto startTicks = cpp_freertos::Ticks::GetTicks();
+        for (const auto &level : levels) {
+            if (!RunSystemServices(level)) {
                 throw SystemInitialisationError{"System startup failed: unable to start a system service."};
             }
-        });
+        }
+        const auto startupTime = cpp_freertos::Ticks::TicksToMs(cpp_freertos::Ticks::GetTicks() - startTicks);
+        LOG_INFO("System services started in %" PRIu32 " ms", static_cast<std::uint32_t>(startupTime));
 
         postStartRoutine();
     }
 
+    bool SystemManagerCommon::RunSystemServices(const graph::Nodes &level)
+    {
+        struct PendingStart
+        {
+            std::shared_ptr<Service> service;
+            std::shared_ptr<SystemMessage> request;
+            TickType_t timeout;
+        };
+        std::vector<PendingStart> pending;
+        pending.reserve(level.size());
+
+        const auto levelTicks = cpp_freertos::Ticks::GetTicks();
+        for (const auto &node : level) {
+            auto service = node.get().create();
+            CriticalSection::Enter();
+            servicesList.push_back(service);
+            CriticalSection::Exit();
+
+            service->StartService();
+            auto request = std::make_shared<SystemMessage>(SystemMessageType::Start);
+            if (!bus.sendRequest(request, service->bus.getOwnerName())) {
+                LOG_FATAL("Unable to start service: %s", node.get().getName().c_str());
+                return false;
+            }
+            const auto timeout = cpp_freertos::Ticks::MsToTicks(node.get().getStartTimeout().count());
+            pending.push_back(PendingStart{std::move(service), std::move(request), timeout});
+        }
+
+        // Every start timeout counts from the moment the whole level was requested to start
+        for (const auto &[service, request, timeout] : pending) {
+            const auto elapsed = cpp_freertos::Ticks::GetTicks() - levelTicks;
+            const auto ret     = bus.unicastSync(request, this, elapsed < timeout ? timeout - elapsed : 0);
+            const auto resp    = std::static_pointer_cast<ResponseMessage>(ret.second);
+            if (ret.first != ReturnCodes::Success || resp->retCode != ReturnCodes::Success) {
+                LOG_FATAL("Unable to start service: %s", service->GetName().c_str());
+                return false;
+            }
+        }
+
+        for (const auto &[service, request, timeout] : pending) {
+            LOG_INFO("\t%s initialized in %" PRIu32 " ms",
+                     service->GetName().c_str(),
+                     static_cast<std::uint32_t>(service->initDuration.count()));
+        }
+        const auto levelTime = cpp_freertos::Ticks::TicksToMs(cpp_freertos::Ticks::GetTicks() - levelTicks);
+        LOG_INFO("Level of %zu services started in %" PRIu32 " ms",
+                 pending.size(),
+                 static_cast<std::uint32_t>(levelTime));
+        return true;
+    }
+
     void SystemManagerCommon::StartSystem(InitFunction sysInit, InitFunction appSpaceInit, DeinitFunction sysDeinit)
     {
-        cpuStatistics = std::make_unique<CpuStatistics>();
-        taskStatistics = std::make_unique<TaskStatistics>();
-        powerManager   = std::make_unique<PowerManager>(*cpuStatistics, *taskStatistics);
-        deviceManager = std::make_unique<DeviceManager>();
+        cpuStatistics        = std::make_unique<CpuStatistics>();
+        taskStatistics       = std::make_unique<TaskStatistics>();
+        powerManager         = std::make_unique<PowerManager>(*cpuStatistics, *taskStatistics);
+        systemMetricsSampler = std::make_unique<SystemMetricsSampler>(*powerManager);
+        deviceManager        = std::make_unique<DeviceManager>();
 
         systemInit   = std::move(sysInit);
         userInit     = std::move(appSpaceInit);
@@ -250,6 +310,12 @@ namespace sys
                 powerManager->LogPowerManagerStatistics();
             });
         powerManagerStatisticsTimer.start();
+
+        systemMetricsTimer = sys::TimerFactory::createPeriodicTimer(
+            this, "SystemMetricsTimer", constants::systemMetricsTimerInterval, [this](sys::Timer &) {
+                systemMetricsSampler->Sample();
+            });
+        systemMetricsTimer.start();
     }
 
     bool SystemManagerCommon::Restore(Service *s)
@@ -664,6 +730,12 @@ namespace sys
             return sys::MessageNone{};
         });
 
+        connect<sys::WorkloadHintMessage>([this](sys::Message *message) -> sys::MessagePointer {
+            auto msg = static_cast<sys::WorkloadHintMessage *>(message);
+            powerManager->SetWorkloadHint(msg->getName(), msg->getHint(), msg->getExpectedIn());
+            return sys::MessageNone{};
+        });
+
         connect(typeid(sys::IsCpuPermanent), [this](sys::Message *message) -> sys::MessagePointer {
             return std::make_shared<sys::IsCpuPermanentResponse>(powerManager->IsCpuPermanentFrequency());
         });
@@ -712,6 +784,7 @@ namespace sys
         lowBatteryShutdownDelay.stop();
         freqTimer.stop();
         powerManagerStatisticsTimer.stop();
+        systemMetricsTimer.stop();
 
         // We are going to remove services in reversed order of creation
         CriticalSection::Enter();
@@ -0,0 +1,114 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <SystemManager/SystemMetricsSampler.hpp>
+#include <memory/usermem.h>
+#include <purefs/filesystem_paths.hpp>
+#include <ticks.hpp>
+#include <Utils.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace sys
+{
+    namespace
+    {
+        /// Same order of magnitude as the number of tasks running in the system
+        constexpr std::size_t maxTrackedHeapUsers = 64;
+
+        auto toMs(TickType_t ticks) -> std::uint32_t
+        {
+            return static_cast<std::uint32_t>(cpp_freertos::Ticks::TicksToMs(ticks));
+        }
+    } // namespace
+
+    SystemMetricsSampler::SystemMetricsSampler(PowerManager &powerManager)
+        : powerManager{powerManager}, lastSampleTimestamp{cpp_freertos::Ticks::GetTicks()},
+          lastResidency{powerManager.GetFrequencyResidency()}
+    {}
+
+    void SystemMetricsSampler::Sample()
+    {
+        const auto timestamp = cpp_freertos::Ticks::GetTicks();
+
+        metrics::Window window;
+        window.timestamp = toMs(timestamp);
+        window.length    = toMs(timestamp - lastSampleTimestamp);
+        window.frequency = static_cast<std::uint16_t>(powerManager.GetCurrentFrequency());
+        window.freeHeap  = static_cast<std::uint32_t>(usermemGetFreeHeapSize());
+        SampleTasks(window);
+        SampleResidency(window);
+        SampleSentinels(window);
+        lastSampleTimestamp = timestamp;
+
+        metrics::record(window);
+#if defined(TARGET_Linux)
+        metrics::exportCsv(purefs::dir::getLogsPath() / "system_metrics.csv");
+#endif
+    }
+
+    void SystemMetricsSampler::SampleTasks(metrics::Window &window)
+    {
+        const auto numberOfTasks = uxTaskGetNumberOfTasks();
+        std::vector<TaskStatus_t> tasks(numberOfTasks);
+        std::uint32_t totalRunTime{0};
+        tasks.resize(uxTaskGetSystemState(tasks.data(), numberOfTasks, &totalRunTime));
+
+        std::vector<UserMemTaskUsage> heapUsers(maxTrackedHeapUsers);
+        heapUsers.resize(usermemGetTaskUsage(heapUsers.data(), heapUsers.size()));
+        usermemResetTaskPeaks();
+
+        const auto totalIncrease = utils::computeIncrease(totalRunTime, lastTotalRunTime);
+        std::map<TaskHandle_t, std::uint32_t> taskRunTime;
+        for (const auto &task : tasks) {
+            const auto runTime        = static_cast<std::uint32_t>(task.ulRunTimeCounter);
+            taskRunTime[task.xHandle] = runTime;
+
+            // Tasks created within the window are accounted from zero
+            const auto last     = lastTaskRunTime.find(task.xHandle);
+            const auto increase = utils::computeIncrease(runTime, last != lastTaskRunTime.end() ? last->second : 0U);
+            const auto cpuShare =
+                totalIncrease == 0
+                    ? 0
+                    : static_cast<std::uint32_t>((static_cast<std::uint64_t>(increase) * metrics::fullCpuShare) /
+                                                 totalIncrease);
+
+            const auto heapUser = std::find_if(heapUsers.begin(), heapUsers.end(), [&task](const auto &usage) {
+                return usage.task == task.xHandle;
+            });
+            const auto heapPeak =
+                heapUser != heapUsers.end() ? static_cast<std::uint32_t>(heapUser->peakAllocated) : 0U;
+
+            if (cpuShare != 0 || heapPeak != 0) {
+                window.tasks.push_back(metrics::TaskUsage{task.pcTaskName, cpuShare, heapPeak});
+            }
+        }
+        lastTaskRunTime  = std::move(taskRunTime);
+        lastTotalRunTime = totalRunTime;
+    }
+
+    void SystemMetricsSampler::SampleResidency(metrics::Window &window)
+    {
+        const auto residency = powerManager.GetFrequencyResidency();
+        for (const auto &[frequency, ticks] : residency.levels) {
+            const auto last     = lastResidency.levels.find(frequency);
+            const auto increase = ticks - (last != lastResidency.levels.end() ? last->second : 0);
+            if (increase != 0) {
+                window.residency.push_back(metrics::Residency{static_cast<std::uint16_t>(frequency), toMs(increase)});
+            }
+        }
+        if (const auto wfi = residency.wfi - lastResidency.wfi; wfi != 0) {
+            window.residency.push_back(metrics::Residency{metrics::wfiFrequency, toMs(wfi)});
+        }
+        lastResidency = residency;
+    }
+
+    void SystemMetricsSampler::SampleSentinels(metrics::Window &window) const
+    {
+        for (const auto &request : powerManager.GetSentinelRequests()) {
+            window.sentinels.push_back(
+                metrics::SentinelRequest{request.name, static_cast<std::uint16_t>(request.frequency), request.wfiBlocked});
+        }
+    }
+} // namespace sys
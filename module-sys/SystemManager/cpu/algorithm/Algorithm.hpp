@@ -8,6 +8,8 @@
 #include "SystemManager/SentinelView.hpp"
 #include "common.hpp"
 
+#include <chrono>
+
 namespace sys::cpu
 {
     struct AlgorithmData
@@ -15,6 +17,8 @@ namespace sys::cpu
         unsigned int CPUload                 = 0;
         bsp::CpuFrequencyMHz curentFrequency = bsp::CpuFrequencyMHz::Level_6;
         sentinel::View sentinel;
+        /// time of the calculation since boot
+        std::chrono::milliseconds timestamp{0};
     };
 
     struct AlgorithmResult
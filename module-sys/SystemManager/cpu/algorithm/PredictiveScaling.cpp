@@ -0,0 +1,110 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "PredictiveScaling.hpp"
+#include <algorithm>
+#include <array>
+
+namespace sys::cpu
+{
+    namespace
+    {
+        using namespace std::chrono_literals;
+
+        constexpr std::array frequencyLevels{bsp::CpuFrequencyMHz::Level_0,
+                                             bsp::CpuFrequencyMHz::Level_1,
+                                             bsp::CpuFrequencyMHz::Level_2,
+                                             bsp::CpuFrequencyMHz::Level_3,
+                                             bsp::CpuFrequencyMHz::Level_4,
+                                             bsp::CpuFrequencyMHz::Level_5,
+                                             bsp::CpuFrequencyMHz::Level_6};
+
+        /// lowest level at which the work done in the last period takes no more than loadLimit of it
+        bsp::CpuFrequencyMHz lowestMeetingLoad(const AlgorithmData &data, std::uint32_t loadLimit)
+        {
+            const auto work = static_cast<std::uint64_t>(data.curentFrequency) * data.CPUload;
+            for (const auto level : frequencyLevels) {
+                if (static_cast<std::uint64_t>(level) * loadLimit >= work) {
+                    return level;
+                }
+            }
+            return bsp::CpuFrequencyMHz::Level_6;
+        }
+    } // namespace
+
+    PredictiveScaling::PredictiveScaling(const bsp::PowerProfile &powerProfile, std::chrono::milliseconds leadTime)
+        : powerProfile(powerProfile), leadTime(leadTime)
+    {}
+
+    auto PredictiveScaling::GetProfile(WorkloadHint hint) noexcept -> Profile
+    {
+        switch (hint) {
+        case WorkloadHint::RenderBurst:
+            return {bsp::CpuFrequencyMHz::Level_6, 100, 500ms};
+        case WorkloadHint::AudioDecode:
+            return {bsp::CpuFrequencyMHz::Level_3, 60, 0ms};
+        case WorkloadHint::BulkDatabase:
+            return {bsp::CpuFrequencyMHz::Level_4, 90, 30s};
+        case WorkloadHint::None:
+            break;
+        }
+        return {bsp::CpuFrequencyMHz::Level_0, 100, 0ms};
+    }
+
+    void PredictiveScaling::SetHint(const std::string &sentinelName, WorkloadHint hint, std::chrono::milliseconds start)
+    {
+        if (hint == WorkloadHint::None) {
+            hints.erase(sentinelName);
+            return;
+        }
+        hints[sentinelName] = Hint{hint, start};
+    }
+
+    auto PredictiveScaling::GetNumberOfHints() const noexcept -> std::size_t
+    {
+        return hints.size();
+    }
+
+    AlgorithmResult PredictiveScaling::calculateImplementation(const AlgorithmData &data)
+    {
+        RemoveExpiredHints(data.timestamp);
+
+        auto target    = std::max(powerProfile.minimalFrequency, data.sentinel.minFrequency);
+        auto loadLimit = 100U;
+        auto inEffect  = false;
+        for (const auto &[name, hint] : hints) {
+            if (hint.start > data.timestamp + leadTime) {
+                continue;
+            }
+            const auto profile = GetProfile(hint.hint);
+            target             = std::max(target, profile.floor);
+            loadLimit          = std::min(loadLimit, profile.loadLimit);
+            inEffect           = true;
+        }
+        if (!inEffect) {
+            return {algorithm::Change::NoChange, data.curentFrequency};
+        }
+
+        target = std::max(target, lowestMeetingLoad(data, loadLimit));
+        if (target > data.curentFrequency) {
+            return {algorithm::Change::UpScaled, target};
+        }
+        if (target < data.curentFrequency) {
+            return {algorithm::Change::Downscaled, target};
+        }
+        return {algorithm::Change::Hold, target};
+    }
+
+    void PredictiveScaling::RemoveExpiredHints(std::chrono::milliseconds now)
+    {
+        for (auto it = hints.begin(); it != hints.end();) {
+            const auto duration = GetProfile(it->second.hint).duration;
+            if (duration != std::chrono::milliseconds::zero() && now >= it->second.start + duration) {
+                it = hints.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+} // namespace sys::cpu
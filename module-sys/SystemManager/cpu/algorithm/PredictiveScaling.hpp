@@ -0,0 +1,58 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include "Algorithm.hpp"
+#include "lpm/PowerProfile.hpp"
+#include <system/WorkloadHint.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace sys::cpu
+{
+    /// Uses workload hints of sentinels instead of the past load: the frequency is raised up to one lead time before
+    /// a hinted workload starts and, while any hint applies, it is set to the lowest level keeping the load under the
+    /// limit of the hinted workloads. Without hints in effect the decision is left to the other algorithms.
+    class PredictiveScaling : public Algorithm
+    {
+      public:
+        struct Profile
+        {
+            /// lowest frequency the workload may run at
+            bsp::CpuFrequencyMHz floor;
+            /// highest load [%] at which the workload still meets its deadlines
+            std::uint32_t loadLimit;
+            /// time after which the hint expires, zero if it applies until withdrawn
+            std::chrono::milliseconds duration;
+        };
+
+        static constexpr std::chrono::milliseconds defaultLeadTime{100};
+
+        explicit PredictiveScaling(const bsp::PowerProfile &powerProfile,
+                                   std::chrono::milliseconds leadTime = defaultLeadTime);
+
+        /// @param start - time since boot the workload is expected at
+        void SetHint(const std::string &sentinelName, WorkloadHint hint, std::chrono::milliseconds start);
+        [[nodiscard]] auto GetNumberOfHints() const noexcept -> std::size_t;
+
+        [[nodiscard]] static auto GetProfile(WorkloadHint hint) noexcept -> Profile;
+
+      private:
+        struct Hint
+        {
+            WorkloadHint hint;
+            std::chrono::milliseconds start;
+        };
+
+        [[nodiscard]] AlgorithmResult calculateImplementation(const AlgorithmData &data) override;
+        void RemoveExpiredHints(std::chrono::milliseconds now);
+
+        const bsp::PowerProfile &powerProfile;
+        const std::chrono::milliseconds leadTime;
+        std::map<std::string, Hint> hints;
+    };
+} // namespace sys::cpu
@@ -50,6 +50,8 @@ namespace sys
 
         [[nodiscard]] auto GetMinimumFrequencyRequested() noexcept -> sentinel::View;
         [[nodiscard]] auto IsWfiBlocked() noexcept -> bool;
+        /// requests of sentinels holding a frequency above the lowest one or blocking WFI
+        [[nodiscard]] auto GetActiveRequests() const -> std::vector<sentinel::Request>;
         void InformSentinelsAboutCpuFrequencyChange(bsp::CpuFrequencyMHz newFrequency) noexcept;
 
       private:
@@ -5,6 +5,7 @@
 
 #include <Service/Service.hpp>
 #include <bsp/common.hpp>
+#include <system/WorkloadHint.hpp>
 
 #include <string>
 #include <functional>
@@ -33,6 +34,13 @@ namespace sys
         /// @param block - boolean flag with blocking command
         void BlockWfiMode(bool block);
 
+        /// @brief function used to announce the workload about to be run, the CPU frequency is adjusted to it
+        /// ahead of time and kept at the lowest level meeting its deadlines. Each call sends a message to the system
+        /// manager, so hints are meant for the start of a workload rather than for every single operation
+        /// @param hint - expected workload, WorkloadHint::None withdraws the previous one
+        /// @param expectedIn - time left until the workload starts
+        void HintWorkload(WorkloadHint hint, std::chrono::milliseconds expectedIn = std::chrono::milliseconds::zero());
+
         [[nodiscard]] auto GetFrequency() const noexcept -> bsp::CpuFrequencyMHz;
 
         void CpuFrequencyHasChanged(bsp::CpuFrequencyMHz newFrequency);
@@ -14,8 +14,9 @@ namespace sys
 
     namespace graph
     {
-        using Node  = std::reference_wrapper<BaseServiceCreator>;
-        using Nodes = std::vector<Node>;
+        using Node   = std::reference_wrapper<BaseServiceCreator>;
+        using Nodes  = std::vector<Node>;
+        using Levels = std::vector<Nodes>;
 
         Nodes nodesFrom(const std::vector<std::unique_ptr<BaseServiceCreator>> &services);
     } // namespace graph
@@ -35,6 +36,13 @@ namespace sys
 
         [[nodiscard]] auto sort() const -> graph::Nodes;
 
+        /**
+         * Sorts the nodes and groups them in levels: nodes of a level depend only on nodes of the previous levels,
+         * so the nodes of a single level may be started concurrently.
+         * @return Levels in order, nodes within a level keep the order of sort()
+         */
+        [[nodiscard]] auto sortInLevels() const -> graph::Levels;
+
       private:
         graph::Nodes nodes;
         std::unique_ptr<DependencySortingStrategy> strategy;
@@ -11,13 +11,16 @@
 #include "CpuGovernor.hpp"
 #include "LogSentinel.hpp"
 #include "TaskStatistics.hpp"
+#include <system/WorkloadHint.hpp>
 #include <bsp/lpm/PowerProfile.hpp>
+#include <map>
 #include <vector>
 
 namespace sys::cpu
 {
     class AlgorithmFactory;
-}
+    class PredictiveScaling;
+} // namespace sys::cpu
 
 namespace sys
 {
@@ -40,6 +43,13 @@ namespace sys
         std::uint32_t lastTotalTicksCount{0};
     };
 
+    /// total time spent at each CPU frequency and in WFI since boot
+    struct FrequencyResidency
+    {
+        std::map<bsp::CpuFrequencyMHz, TickType_t> levels;
+        TickType_t wfi{0};
+    };
+
     class PowerManager
     {
       public:
@@ -69,9 +79,17 @@ namespace sys
         void SetPermanentFrequency(bsp::CpuFrequencyMHz freq);
         void ResetPermanentFrequency();
         void BlockWfiMode(const std::string &sentinelName, bool block);
+        void SetWorkloadHint(const std::string &sentinelName, WorkloadHint hint, std::chrono::milliseconds expectedIn);
         void EnterWfiIfReady();
         void LogPowerManagerStatistics();
 
+        [[nodiscard]] auto GetCurrentFrequency() const noexcept -> bsp::CpuFrequencyMHz;
+        [[nodiscard]] auto GetFrequencyResidency() -> FrequencyResidency;
+        /// requests of the sentinels currently holding the CPU, including the log dump one
+        [[nodiscard]] auto GetSentinelRequests() const -> std::vector<sentinel::Request>;
+        /// workload hints of the sentinels, including the ones not in effect yet
+        [[nodiscard]] auto GetNumberOfWorkloadHints() const noexcept -> std::size_t;
+
       private:
         void SetCpuFrequency(bsp::CpuFrequencyMHz freq);
         void UpdateCpuFrequencyMonitor(bsp::CpuFrequencyMHz currentFreq);
@@ -83,6 +101,7 @@ namespace sys
         TickType_t lastLogStatisticsTimestamp{0};
 
         std::vector<CpuFrequencyMonitor> cpuFrequencyMonitors;
+        FrequencyResidency frequencyResidency;
 
         std::shared_ptr<drivers::DriverSEMC> driverSEMC;
         std::unique_ptr<bsp::LowPowerMode> lowPowerControl;
@@ -91,6 +110,8 @@ namespace sys
         const bsp::PowerProfile powerProfile;
 
         std::unique_ptr<sys::cpu::AlgorithmFactory> cpuAlgorithms;
+        /// owned by cpuAlgorithms
+        sys::cpu::PredictiveScaling *predictiveScaling{nullptr};
         CpuStatistics &cpuStatistics;
         TaskStatistics &taskStatistics;
     };
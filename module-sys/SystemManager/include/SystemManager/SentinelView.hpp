@@ -23,5 +23,13 @@ namespace sys
             /// textual information on what actually happens
             std::string reason;
         };
+
+        /// what a single sentinel currently holds the CPU at
+        struct Request
+        {
+            std::string name;
+            bsp::CpuFrequencyMHz frequency = bsp::CpuFrequencyMHz::Level_0;
+            bool wfiBlocked                = false;
+        };
     }; // namespace sentinel
 } // namespace sys
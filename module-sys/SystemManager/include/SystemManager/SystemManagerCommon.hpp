@@ -11,12 +11,14 @@
 #include "Service/Mailbox.hpp"
 #include "Service/Service.hpp"
 #include "Service/ServiceCreator.hpp"
+#include "SystemManager/DependencyGraph.hpp"
 #include "Timers/TimerHandle.hpp"
 #include "PowerManager.hpp"
 #include <hal/key_input/RawKey.hpp>
 #include <system/Constants.hpp>
 #include "CpuStatistics.hpp"
 #include "TaskStatistics.hpp"
+#include "SystemMetricsSampler.hpp"
 #include "DeviceManager.hpp"
 #include <chrono>
 #include <vector>
@@ -161,6 +163,8 @@ namespace sys
         void PowerOff();
 
         void StartSystemServices();
+        /// Starts all the services of a dependency level at once and waits until every one of them is initialized.
+        bool RunSystemServices(const graph::Nodes &level);
 
         static bool RunService(std::shared_ptr<Service> service, Service *caller, TickType_t timeout = 5000);
         static bool RequestServiceClose(const std::string &name, Service *caller, TickType_t timeout = 5000);
@@ -204,6 +208,7 @@ namespace sys
         sys::TimerHandle serviceCloseTimer;
         sys::TimerHandle lowBatteryShutdownDelay;
         sys::TimerHandle powerManagerStatisticsTimer;
+        sys::TimerHandle systemMetricsTimer;
         InitFunction userInit;
         InitFunction systemInit;
         DeinitFunction systemDeinit;
@@ -218,6 +223,7 @@ namespace sys
         std::unique_ptr<CpuStatistics> cpuStatistics;
         std::unique_ptr<TaskStatistics> taskStatistics;
         std::unique_ptr<PowerManager> powerManager;
+        std::unique_ptr<SystemMetricsSampler> systemMetricsSampler;
         std::unique_ptr<DeviceManager> deviceManager;
     };
 } // namespace sys
@@ -0,0 +1,36 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include "PowerManager.hpp"
+#include <Service/SystemMetrics.hpp>
+
+#include <FreeRTOS.h>
+#include <task.h>
+#include <cstdint>
+#include <map>
+
+namespace sys
+{
+    /// Closes a metrics window on every call: CPU share and heap high-water mark of each task, time spent at each
+    /// CPU frequency and the sentinels holding the CPU, stored in the system wide metrics ring.
+    class SystemMetricsSampler
+    {
+      public:
+        explicit SystemMetricsSampler(PowerManager &powerManager);
+
+        void Sample();
+
+      private:
+        void SampleTasks(metrics::Window &window);
+        void SampleResidency(metrics::Window &window);
+        void SampleSentinels(metrics::Window &window) const;
+
+        PowerManager &powerManager;
+        TickType_t lastSampleTimestamp;
+        std::uint32_t lastTotalRunTime{0};
+        std::map<TaskHandle_t, std::uint32_t> lastTaskRunTime;
+        FrequencyResidency lastResidency;
+    };
+} // namespace sys
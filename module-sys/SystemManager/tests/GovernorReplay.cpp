@@ -0,0 +1,126 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include "GovernorReplay.hpp"
+#include "SystemManager/cpu/algorithm/FrequencyStepping.hpp"
+#include "SystemManager/cpu/algorithm/ImmediateUpscale.hpp"
+#include "SystemManager/cpu/algorithm/PredictiveScaling.hpp"
+#include <magic_enum.hpp>
+
+#include <algorithm>
+#include <sstream>
+
+namespace sys::cpu::replay
+{
+    namespace
+    {
+        constexpr auto tracePrefix = "cpu_trace";
+
+        auto split(const std::string &line) -> std::vector<std::string>
+        {
+            std::vector<std::string> fields;
+            std::stringstream stream{line};
+            std::string field;
+            while (std::getline(stream, field, ',')) {
+                fields.push_back(field);
+            }
+            if (!fields.empty() && fields.front() == tracePrefix) {
+                fields.erase(fields.begin());
+            }
+            return fields;
+        }
+
+        /// Core voltage of the frequency level [V]
+        auto voltageAt(bsp::CpuFrequencyMHz frequency) -> double
+        {
+            if (frequency >= bsp::CpuFrequencyMHz::Level_5) {
+                return 1.15;
+            }
+            return frequency >= bsp::CpuFrequencyMHz::Level_3 ? 1.0 : 0.9;
+        }
+    } // namespace
+
+    auto parseTrace(std::istream &input) -> Trace
+    {
+        Trace trace;
+        std::optional<HintEvent> pendingHint;
+        std::string line;
+        while (std::getline(input, line)) {
+            const auto fields = split(line);
+            if (fields.size() == 4 && fields[0] == "load") {
+                const auto frequency = std::stoul(fields[2]);
+                const auto load      = std::min(std::stoul(fields[3]), 100UL);
+                trace.push_back(Period{static_cast<std::uint32_t>(frequency * load / 100), std::move(pendingHint)});
+                pendingHint.reset();
+            }
+            else if (fields.size() == 5 && fields[0] == "hint") {
+                if (const auto hint = magic_enum::enum_cast<WorkloadHint>(fields[3]); hint.has_value()) {
+                    pendingHint = HintEvent{fields[2], *hint, std::chrono::milliseconds{std::stol(fields[4])}};
+                }
+            }
+        }
+        return trace;
+    }
+
+    auto powerAt(bsp::CpuFrequencyMHz frequency, double busy) -> double
+    {
+        // Static part plus dynamic one scaling with f * V^2, the clock keeps running at a fraction of it when idle
+        constexpr auto staticPower = 10.0;
+        constexpr auto idleShare   = 0.2;
+        const auto voltage         = voltageAt(frequency);
+        const auto dynamic         = static_cast<double>(frequency) * voltage * voltage;
+        return staticPower + dynamic * (busy + (1.0 - busy) * idleShare);
+    }
+
+    auto makeAlgorithms(const bsp::PowerProfile &profile) -> std::unique_ptr<AlgorithmFactory>
+    {
+        auto algorithms = std::make_unique<AlgorithmFactory>();
+        algorithms->emplace(AlgoID::ImmediateUpscale, std::make_unique<ImmediateUpscale>());
+        algorithms->emplace(AlgoID::FrequencyStepping, std::make_unique<FrequencyStepping>(profile));
+        algorithms->emplace(AlgoID::PredictiveScaling, std::make_unique<PredictiveScaling>(profile));
+        return algorithms;
+    }
+
+    auto run(const Trace &trace,
+             const Governor &governor,
+             const bsp::PowerProfile &profile,
+             bsp::CpuFrequencyMHz initialFrequency) -> Result
+    {
+        auto algorithms = makeAlgorithms(profile);
+        auto predictive = static_cast<PredictiveScaling *>(algorithms->get(AlgoID::PredictiveScaling));
+
+        Result result;
+        auto frequency = initialFrequency;
+        std::chrono::milliseconds now{0};
+        double backlog{0};
+
+        for (const auto &period : trace) {
+            if (period.hint.has_value()) {
+                predictive->SetHint(period.hint->sentinel, period.hint->hint, now + period.hint->expectedIn);
+            }
+
+            const auto capacity = static_cast<double>(frequency);
+            backlog += period.work;
+            const auto done = std::min(backlog, capacity);
+            backlog -= done;
+            result.energy += powerAt(frequency, done / capacity);
+            if (backlog > 0) {
+                ++result.missedPeriods;
+                const auto delay = std::chrono::milliseconds{
+                    static_cast<std::int64_t>(backlog / capacity * governorPeriod.count())};
+                result.maxDelay = std::max(result.maxDelay, delay);
+            }
+            now += governorPeriod;
+
+            const AlgorithmData data{static_cast<unsigned>(done * 100 / capacity), frequency, sentinel::View{}, now};
+            const auto decision = algorithms->calculate(governor.algorithms, data);
+            if (decision.change != algorithm::Change::NoChange && decision.change != algorithm::Change::Hold &&
+                decision.value != frequency) {
+                frequency = decision.value;
+                ++result.frequencyChanges;
+                algorithms->reset(governor.algorithms);
+            }
+        }
+        return result;
+    }
+} // namespace sys::cpu::replay
@@ -0,0 +1,77 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include "SystemManager/cpu/AlgorithmFactory.hpp"
+#include "lpm/PowerProfile.hpp"
+#include <system/WorkloadHint.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <istream>
+#include <list>
+#include <optional>
+#include <string>
+#include <vector>
+
+/// Host side replay of CPU load traces against the frequency scaling algorithms.
+///
+/// A trace is a list of governor periods, each with the work requested in it and optionally the workload hint
+/// received before it. Work is expressed in MHz: the frequency needed to complete it within the period. Work not
+/// completed in its period is carried over to the next ones, which is what a missed deadline costs.
+namespace sys::cpu::replay
+{
+    struct HintEvent
+    {
+        std::string sentinel;
+        WorkloadHint hint;
+        std::chrono::milliseconds expectedIn;
+    };
+
+    struct Period
+    {
+        /// work requested in the period [MHz]
+        std::uint32_t work{0};
+        std::optional<HintEvent> hint;
+    };
+
+    using Trace = std::vector<Period>;
+
+    struct Result
+    {
+        /// relative energy, see powerAt()
+        double energy{0};
+        /// periods which ended with work left
+        std::uint32_t missedPeriods{0};
+        /// longest time work waited past the end of its period
+        std::chrono::milliseconds maxDelay{0};
+        std::uint32_t frequencyChanges{0};
+    };
+
+    struct Governor
+    {
+        std::string name;
+        std::list<AlgoID> algorithms;
+    };
+
+    inline constexpr std::chrono::milliseconds governorPeriod{100};
+
+    /// Parses the lines printed with DEBUG_CPU_GOVERNOR_TRACE, optionally with the cpu_trace prefix stripped:
+    ///   load,<timestamp_ms>,<frequency_MHz>,<load_%>
+    ///   hint,<timestamp_ms>,<sentinel>,<WorkloadHint>,<expected_in_ms>
+    /// Other lines are skipped. Loads recorded at 100% underestimate the work, as the excess was not measured.
+    [[nodiscard]] auto parseTrace(std::istream &input) -> Trace;
+
+    /// Relative power drawn at the frequency, busy for the given part of the period [0-1]
+    [[nodiscard]] auto powerAt(bsp::CpuFrequencyMHz frequency, double busy) -> double;
+
+    /// All algorithms used by PowerManager, configured for the profile
+    [[nodiscard]] auto makeAlgorithms(const bsp::PowerProfile &profile) -> std::unique_ptr<AlgorithmFactory>;
+
+    /// Runs the trace through the governor the way PowerManager does, starting at the given frequency
+    [[nodiscard]] auto run(const Trace &trace,
+                           const Governor &governor,
+                           const bsp::PowerProfile &profile,
+                           bsp::CpuFrequencyMHz initialFrequency = bsp::CpuFrequencyMHz::Level_6) -> Result;
+} // namespace sys::cpu::replay
@@ -173,3 +173,71 @@ TEST_CASE("Given Dependency Graph When topological sort on directed cyclic graph
     REQUIRE(sorted[1].get().getName() == "S2");
     REQUIRE(sorted[2].get().getName() == "S1");
 }
+
+namespace
+{
+    std::vector<std::vector<std::string>> namesOf(const graph::Levels &levels)
+    {
+        std::vector<std::vector<std::string>> names;
+        for (const auto &level : levels) {
+            auto &levelNames = names.emplace_back();
+            for (const auto &node : level) {
+                levelNames.push_back(node.get().getName());
+            }
+        }
+        return names;
+    }
+} // namespace
+
+TEST_CASE("Given Dependency Graph When sorted in levels without dependencies then verify single level")
+{
+    std::vector<std::unique_ptr<BaseServiceCreator>> services;
+    services.push_back(std::make_unique<MockedServiceCreator>(createManifest("S1", {})));
+    services.push_back(std::make_unique<MockedServiceCreator>(createManifest("S2", {})));
+    services.push_back(std::make_unique<MockedServiceCreator>(createManifest("S3", {})));
+
+    DependencyGraph graph{graph::nodesFrom(services), std::make_unique<TopologicalSort>()};
+
+    REQUIRE(namesOf(graph.sortInLevels()) == std::vector<std::vector<std::string>>{{"S1", "S2", "S3"}});
+}
+
+TEST_CASE("Given Dependency Graph When sorted in levels advanced case then verify levels")
+{
+    std::vector<std::unique_ptr<BaseServiceCreator>> services;
+    services.push_back(std::make_unique<MockedServiceCreator>(createManifest("S1", {"S2", "S3", "S4"})));
+    services.push_back(std::make_unique<MockedServiceCreator>(createManifest("S2", {})));
+    services.push_back(std::make_unique<MockedServiceCreator>(createManifest("S3", {"S5", "S6"})));
+    services.push_back(std::make_unique<MockedServiceCreator>(createManifest("S4", {"S6"})));
+    services.push_back(std::make_unique<MockedServiceCreator>(createManifest("S5", {})));
+    services.push_back(std::make_unique<MockedServiceCreator>(createManifest("S6", {})));
+
+    // Graph:
+    //    --> S4 ---\>
+    //   /     ----> S6
+    //  /     /
+    // S1 -> S3 -> S5
+    //   \-> S2
+    DependencyGraph graph{graph::nodesFrom(services), std::make_unique<TopologicalSort>()};
+
+    REQUIRE(namesOf(graph.sortInLevels()) ==
+            std::vector<std::vector<std::string>>{{"S2", "S5", "S6"}, {"S3", "S4"}, {"S1"}});
+}
+
+TEST_CASE("Given Dependency Graph When sorted in levels then every node follows its dependencies")
+{
+    std::vector<std::unique_ptr<BaseServiceCreator>> services;
+    services.push_back(std::make_unique<MockedServiceCreator>(createManifest("S1", {"S2"})));
+    services.push_back(std::make_unique<MockedServiceCreator>(createManifest("S2", {"S3"})));
+    services.push_back(std::make_unique<MockedServiceCreator>(createManifest("S3", {"S4"})));
+    services.push_back(std::make_unique<MockedServiceCreator>(createManifest("S4", {})));
+    services.push_back(std::make_unique<MockedServiceCreator>(createManifest("S5", {"S4"})));
+
+    // Graph:
+    // S1 -> S2 -> S3 -> S4
+    //                  /
+    //                S5
+    DependencyGraph graph{graph::nodesFrom(services), std::make_unique<TopologicalSort>()};
+
+    REQUIRE(namesOf(graph.sortInLevels()) ==
+            std::vector<std::vector<std::string>>{{"S4"}, {"S3", "S5"}, {"S2"}, {"S1"}});
+}
@@ -8,6 +8,7 @@
 #include "SystemManager/cpu/algorithm/FrequencyHold.hpp"
 #include "SystemManager/cpu/algorithm/FrequencyStepping.hpp"
 #include "SystemManager/cpu/algorithm/ImmediateUpscale.hpp"
+#include "SystemManager/cpu/algorithm/PredictiveScaling.hpp"
 #include "SystemManager/CpuGovernor.hpp"
 
 namespace mockup
@@ -118,3 +119,86 @@ TEST_CASE("combined algos")
     REQUIRE(result.value == bsp::CpuFrequencyMHz::Level_3);
     REQUIRE(result.change == sys::cpu::algorithm::Change::Downscaled);
 }
+
+TEST_CASE("PredictiveScaling")
+{
+    using namespace std::chrono_literals;
+    using sys::cpu::algorithm::Change;
+    const bsp::PowerProfile pp{.minimalFrequency = bsp::CpuFrequencyMHz::Level_0};
+    sys::cpu::PredictiveScaling algo{pp, 100ms};
+
+    auto dataAt = [](std::chrono::milliseconds now, bsp::CpuFrequencyMHz frequency, unsigned load) {
+        return sys::cpu::AlgorithmData{load, frequency, sys::sentinel::View{}, now};
+    };
+
+    SECTION("no decision without hints")
+    {
+        const auto result = algo.calculate(dataAt(0ms, bsp::CpuFrequencyMHz::Level_2, 100));
+        REQUIRE(result.change == Change::NoChange);
+    }
+
+    SECTION("render burst is served ahead of its start and expires")
+    {
+        algo.SetHint("eink", sys::WorkloadHint::RenderBurst, 1000ms);
+        REQUIRE(algo.calculate(dataAt(800ms, bsp::CpuFrequencyMHz::Level_1, 5)).change == Change::NoChange);
+
+        auto result = algo.calculate(dataAt(900ms, bsp::CpuFrequencyMHz::Level_1, 5));
+        REQUIRE(result.change == Change::UpScaled);
+        REQUIRE(result.value == bsp::CpuFrequencyMHz::Level_6);
+
+        result = algo.calculate(dataAt(1200ms, bsp::CpuFrequencyMHz::Level_6, 5));
+        REQUIRE(result.change == Change::Hold);
+
+        REQUIRE(algo.calculate(dataAt(1500ms, bsp::CpuFrequencyMHz::Level_6, 5)).change == Change::NoChange);
+        REQUIRE(algo.GetNumberOfHints() == 0);
+    }
+
+    SECTION("steady workload falls back to the lowest level meeting its load limit")
+    {
+        algo.SetHint("audio", sys::WorkloadHint::AudioDecode, 0ms);
+
+        // 20% of 528 MHz needs 176 MHz at most 60% loaded, so 264 MHz
+        auto result = algo.calculate(dataAt(100ms, bsp::CpuFrequencyMHz::Level_6, 20));
+        REQUIRE(result.change == Change::Downscaled);
+        REQUIRE(result.value == bsp::CpuFrequencyMHz::Level_5);
+
+        // Light load stays at the floor of the workload
+        result = algo.calculate(dataAt(200ms, bsp::CpuFrequencyMHz::Level_5, 5));
+        REQUIRE(result.change == Change::Downscaled);
+        REQUIRE(result.value == bsp::CpuFrequencyMHz::Level_3);
+
+        result = algo.calculate(dataAt(300ms, bsp::CpuFrequencyMHz::Level_3, 95));
+        REQUIRE(result.change == Change::UpScaled);
+        REQUIRE(result.value == bsp::CpuFrequencyMHz::Level_4);
+
+        algo.SetHint("audio", sys::WorkloadHint::None, 0ms);
+        REQUIRE(algo.calculate(dataAt(400ms, bsp::CpuFrequencyMHz::Level_4, 5)).change == Change::NoChange);
+    }
+
+    SECTION("hint renewed after it expired is served again")
+    {
+        algo.SetHint("db", sys::WorkloadHint::BulkDatabase, 0ms);
+        auto result = algo.calculate(dataAt(0ms, bsp::CpuFrequencyMHz::Level_1, 5));
+        REQUIRE(result.change == Change::UpScaled);
+        REQUIRE(result.value == bsp::CpuFrequencyMHz::Level_4);
+
+        REQUIRE(algo.calculate(dataAt(30s, bsp::CpuFrequencyMHz::Level_4, 5)).change == Change::NoChange);
+        REQUIRE(algo.GetNumberOfHints() == 0);
+
+        // the same sentinel hints the same workload again
+        algo.SetHint("db", sys::WorkloadHint::BulkDatabase, 31s);
+        result = algo.calculate(dataAt(31s, bsp::CpuFrequencyMHz::Level_1, 5));
+        REQUIRE(result.change == Change::UpScaled);
+        REQUIRE(result.value == bsp::CpuFrequencyMHz::Level_4);
+    }
+
+    SECTION("sentinel requests are kept")
+    {
+        algo.SetHint("db", sys::WorkloadHint::BulkDatabase, 0ms);
+        auto data                  = dataAt(0ms, bsp::CpuFrequencyMHz::Level_6, 0);
+        data.sentinel.minFrequency = bsp::CpuFrequencyMHz::Level_5;
+        const auto result          = algo.calculate(data);
+        REQUIRE(result.change == Change::Downscaled);
+        REQUIRE(result.value == bsp::CpuFrequencyMHz::Level_5);
+    }
+}
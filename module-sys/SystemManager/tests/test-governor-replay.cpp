@@ -0,0 +1,122 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#include <catch2/catch.hpp>
+#include "GovernorReplay.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace sys::cpu;
+using namespace std::chrono_literals;
+
+namespace
+{
+    const bsp::PowerProfile profile{.frequencyShiftLowerThreshold = 50,
+                                    .frequencyShiftUpperThreshold = 80,
+                                    .maxBelowThresholdCount       = 5,
+                                    .maxBelowThresholdInRowCount  = 1,
+                                    .maxAboveThresholdCount       = 2,
+                                    .minimalFrequency             = bsp::CpuFrequencyMHz::Level_0};
+
+    const replay::Governor stepping{"stepping", {AlgoID::ImmediateUpscale, AlgoID::FrequencyStepping}};
+    const replay::Governor predictive{
+        "predictive", {AlgoID::ImmediateUpscale, AlgoID::PredictiveScaling, AlgoID::FrequencyStepping}};
+
+    /// Idle screen redrawn every 3 s, each redraw hinted one governor period ahead
+    replay::Trace renderBursts()
+    {
+        replay::Trace trace;
+        for (int redraw = 0; redraw < 10; ++redraw) {
+            trace.insert(trace.end(), 28, replay::Period{2, std::nullopt});
+            trace.back().hint = replay::HintEvent{"eink", sys::WorkloadHint::RenderBurst, replay::governorPeriod};
+            trace.insert(trace.end(), 2, replay::Period{400, std::nullopt});
+        }
+        return trace;
+    }
+
+    /// Steady decoding with a spike every second
+    replay::Trace audioPlayback()
+    {
+        replay::Trace trace;
+        for (int second = 0; second < 30; ++second) {
+            trace.insert(trace.end(), 9, replay::Period{30, std::nullopt});
+            trace.push_back(replay::Period{60, std::nullopt});
+        }
+        trace.front().hint = replay::HintEvent{"audio", sys::WorkloadHint::AudioDecode, 0ms};
+        return trace;
+    }
+
+    void print(const std::string &traceName, const replay::Governor &governor, const replay::Result &result)
+    {
+        std::cout << traceName << ',' << governor.name << ',' << result.energy << ',' << result.missedPeriods << ','
+                  << result.maxDelay.count() << ',' << result.frequencyChanges << '\n';
+    }
+} // namespace
+
+TEST_CASE("Governor replay parses recorded traces")
+{
+    std::stringstream input{"cpu_trace,load,1000,132,50\n"
+                            "something else\n"
+                            "hint,1050,eink,RenderBurst,100\n"
+                            "load,1100,528,100\n"
+                            "hint,1150,eink,Unknown,0\n"
+                            "load,1200,4,10\n"};
+    const auto trace = replay::parseTrace(input);
+    REQUIRE(trace.size() == 3);
+    REQUIRE(trace[0].work == 66);
+    REQUIRE_FALSE(trace[0].hint.has_value());
+    REQUIRE(trace[1].work == 528);
+    REQUIRE(trace[1].hint.has_value());
+    REQUIRE(trace[1].hint->sentinel == "eink");
+    REQUIRE(trace[1].hint->hint == sys::WorkloadHint::RenderBurst);
+    REQUIRE(trace[1].hint->expectedIn == 100ms);
+    REQUIRE_FALSE(trace[2].hint.has_value());
+}
+
+TEST_CASE("Governor replay accounts work carried over")
+{
+    const replay::Trace trace{{600, std::nullopt}, {0, std::nullopt}};
+    const auto result = replay::run(trace, stepping, profile, bsp::CpuFrequencyMHz::Level_6);
+    REQUIRE(result.missedPeriods == 1);
+    REQUIRE(result.maxDelay == std::chrono::milliseconds{72 * 100 / 528});
+    REQUIRE(result.energy > replay::powerAt(bsp::CpuFrequencyMHz::Level_6, 1.0));
+}
+
+TEST_CASE("Predictive governor meets hinted bursts")
+{
+    const auto trace      = renderBursts();
+    const auto reactive   = replay::run(trace, stepping, profile, bsp::CpuFrequencyMHz::Level_0);
+    const auto anticipate = replay::run(trace, predictive, profile, bsp::CpuFrequencyMHz::Level_0);
+
+    REQUIRE(anticipate.missedPeriods == 0);
+    REQUIRE(reactive.missedPeriods > 0);
+    REQUIRE(anticipate.maxDelay < reactive.maxDelay);
+}
+
+TEST_CASE("Predictive governor keeps steady workloads off the highest frequency")
+{
+    const auto trace    = audioPlayback();
+    const auto reactive = replay::run(trace, stepping, profile);
+    const auto steady   = replay::run(trace, predictive, profile);
+
+    REQUIRE(steady.missedPeriods == 0);
+    REQUIRE(steady.energy <= reactive.energy);
+}
+
+TEST_CASE("Governor replay of a recorded trace", "[.replay]")
+{
+    // GOVERNOR_TRACE=<file> catch2-governor-replay "[.replay]"
+    const auto path = std::getenv("GOVERNOR_TRACE");
+    REQUIRE(path != nullptr);
+    std::ifstream input{path};
+    REQUIRE(input.is_open());
+    const auto trace = replay::parseTrace(input);
+
+    std::cout << "trace,governor,energy,missed_periods,max_delay_ms,frequency_changes\n";
+    for (const auto &governor : {stepping, predictive}) {
+        print(path, governor, replay::run(trace, governor, profile));
+    }
+}
@@ -5,6 +5,8 @@
 #include <catch2/catch.hpp>
 #include <SystemManager/CpuGovernor.hpp>
 #include <SystemManager/CpuSentinel.hpp>
+#include <SystemManager/CpuStatistics.hpp>
+#include <SystemManager/PowerManager.hpp>
 #include <memory>
 
 namespace sys
@@ -91,6 +93,57 @@ TEST_CASE("Power Manager CPU sentinels governor test")
         governor->ResetCpuFrequencyRequest("testSentinel_1");
         REQUIRE(governor->GetMinimumFrequencyRequested().minFrequency == bsp::CpuFrequencyMHz::Level_0);
     }
+
+    SECTION("Active sentinel requests")
+    {
+        auto governor = std::make_unique<CpuGovernor>();
+        governor->RegisterNewSentinel(testSentinel_1);
+        governor->RegisterNewSentinel(testSentinel_2);
+        REQUIRE(governor->GetActiveRequests().empty());
+
+        governor->SetCpuFrequencyRequest("testSentinel_2", bsp::CpuFrequencyMHz::Level_4);
+        auto requests = governor->GetActiveRequests();
+        REQUIRE(requests.size() == 1);
+        REQUIRE(requests[0].name == "testSentinel_2");
+        REQUIRE(requests[0].frequency == bsp::CpuFrequencyMHz::Level_4);
+        REQUIRE_FALSE(requests[0].wfiBlocked);
+
+        governor->BlockWfiMode("testSentinel_1", true);
+        requests = governor->GetActiveRequests();
+        REQUIRE(requests.size() == 2);
+        REQUIRE(requests[0].name == "testSentinel_1");
+        REQUIRE(requests[0].frequency == bsp::CpuFrequencyMHz::Level_0);
+        REQUIRE(requests[0].wfiBlocked);
+
+        governor->ResetCpuFrequencyRequest("testSentinel_2");
+        governor->BlockWfiMode("testSentinel_1", false);
+        REQUIRE(governor->GetActiveRequests().empty());
+    }
+}
+
+TEST_CASE("Power Manager workload hints of removed sentinels")
+{
+    using namespace sys;
+    using namespace std::chrono_literals;
+    auto mockedService = std::make_shared<MockedService>("TestService");
+    auto audioSentinel = std::make_shared<CpuSentinel>("audioSentinel", mockedService.get());
+    auto dbSentinel    = std::make_shared<CpuSentinel>("dbSentinel", mockedService.get());
+
+    CpuStatistics cpuStatistics;
+    TaskStatistics taskStatistics;
+    PowerManager powerManager{cpuStatistics, taskStatistics};
+    powerManager.RegisterNewSentinel(audioSentinel);
+    powerManager.RegisterNewSentinel(dbSentinel);
+
+    // the audio decode hint applies until withdrawn
+    powerManager.SetWorkloadHint("audioSentinel", WorkloadHint::AudioDecode, 0ms);
+    powerManager.SetWorkloadHint("dbSentinel", WorkloadHint::BulkDatabase, 0ms);
+    REQUIRE(powerManager.GetNumberOfWorkloadHints() == 2);
+
+    powerManager.RemoveSentinel("audioSentinel");
+    REQUIRE(powerManager.GetNumberOfWorkloadHints() == 1);
+    powerManager.RemoveSentinel("dbSentinel");
+    REQUIRE(powerManager.GetNumberOfWorkloadHints() == 0);
 }
 
 TEST_CASE("GovernorSentinelsVector - single sentinel add and remove")
@@ -0,0 +1,16 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+namespace sys
+{
+    /// Workload a sentinel is about to run, lets the CPU frequency be set before the load shows up
+    enum class WorkloadHint
+    {
+        None,        ///< the previous hint of the sentinel no longer applies
+        RenderBurst, ///< short burst needing the highest frequency, e.g. screen redraw
+        AudioDecode, ///< steady real-time processing, has to finish within each period
+        BulkDatabase ///< long job without latency requirements, e.g. indexing or a bulk import
+    };
+} // namespace sys
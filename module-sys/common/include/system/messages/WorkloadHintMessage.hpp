@@ -0,0 +1,43 @@
+// Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+// For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+#pragma once
+
+#include <Service/Message.hpp>
+#include <system/WorkloadHint.hpp>
+
+#include <chrono>
+#include <string>
+
+namespace sys
+{
+    class WorkloadHintMessage : public sys::TypedMessage<WorkloadHintMessage>
+    {
+      public:
+        WorkloadHintMessage(std::string sentinelName, WorkloadHint hint, std::chrono::milliseconds expectedIn)
+            : TypedMessage(MessageType::SystemManagerCpuFrequency), sentinelName(std::move(sentinelName)), hint(hint),
+              expectedIn(expectedIn)
+        {}
+
+        [[nodiscard]] auto getName() const
+        {
+            return sentinelName;
+        }
+
+        [[nodiscard]] auto getHint() const noexcept
+        {
+            return hint;
+        }
+
+        /// time left until the workload starts
+        [[nodiscard]] auto getExpectedIn() const noexcept
+        {
+            return expectedIn;
+        }
+
+      private:
+        std::string sentinelName;
+        WorkloadHint hint;
+        std::chrono::milliseconds expectedIn;
+    };
+} // namespace sys
@@ -7,6 +7,7 @@
 #define DEBUG_BLUETOOTH_HCI_COMS     0 /// show communication with BT module - transactions
 #define DEBUG_BLUETOOTH_HCI_BYTES    0 /// show communication with BT module - all the HCI bytes
 #define DEBUG_CELLULAR_UART          0 /// show full modem uart communication
+#define DEBUG_CPU_GOVERNOR_TRACE     0 /// print CPU governor input as a trace replayable on the host
 #define DEBUG_DB_MODEL_DATA          0 /// show messages prior to handling in service
 #define DEBUG_EINK_REFRESH           0 /// show refresh information
 #define DEBUG_FONT                   0 /// show Font debug messages
@@ -361,6 +361,11 @@ namespace vfsn::internal::syscalls
         return invoke_fs(_errno_, &purefs::fs::filesystem::fsync, fd);
     }
 
+    int ftruncate(int &_errno_, int fd, off_t length)
+    {
+        return invoke_fs(_errno_, &purefs::fs::filesystem::ftruncate, fd, length);
+    }
+
     int statvfs(int &_errno_, const char *path, struct statvfs *buf)
     {
         if (!buf) {
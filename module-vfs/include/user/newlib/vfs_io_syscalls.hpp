@@ -36,6 +36,7 @@ namespace vfsn::internal::syscalls
     int chmod(int &_errno_, const char *path, mode_t mode);
     int fchmod(int &_errno_, int fd, mode_t mode);
     int fsync(int &_errno_, int fd);
+    int ftruncate(int &_errno_, int fd, off_t length);
     int mount(int &_errno_,
               const char *special_file,
               const char *dir,
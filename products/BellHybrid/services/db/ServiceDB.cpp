@@ -69,7 +69,7 @@ sys::MessagePointer ServiceDB::DataReceivedHandler(sys::DataMessage *msgl, sys::
     case MessageType::DBSyncPackage: {
         auto time   = utils::time::Scoped("DBSyncPackage");
         auto msg    = static_cast<DBServiceMessageSyncPackage *>(msgl);
-        auto ret    = StoreIntoSyncPackage({msg->syncPackagePath});
+        auto ret    = StoreIntoSyncPackage({msg->syncPackagePath}, msg->sender);
         responseMsg = std::make_shared<DBServiceResponseMessage>(ret);
     } break;
 
@@ -97,6 +97,12 @@ sys::ReturnCodes ServiceDB::InitHandler()
     multimediaFilesDB = std::make_unique<db::multimedia_files::MultimediaFilesDB>(
         (purefs::dir::getDatabasesPath() / multimediaDatabaseName).c_str());
 
+    for (const auto database :
+         std::initializer_list<Database *>{eventsDB.get(), quotesDB.get(), multimediaFilesDB.get()}) {
+        scheduleIntegrityCheck(database);
+        enableIdleCheckpoints(database);
+    }
+
     // Create record interfaces
     alarmEventRecordInterface = std::make_unique<AlarmEventRecordInterface>(eventsDB.get());
     multimediaFilesRecordInterface =
@@ -109,6 +115,8 @@ sys::ReturnCodes ServiceDB::InitHandler()
 
     for (auto &dbAgent : databaseAgents) {
         dbAgent->registerMessages();
+        scheduleIntegrityCheck(dbAgent->getDatabase());
+        enableIdleCheckpoints(dbAgent->getDatabase());
     }
 
     auto settings = std::make_unique<settings::Settings>();
@@ -128,12 +136,7 @@ sys::ReturnCodes ServiceDB::InitHandler()
     return sys::ReturnCodes::Success;
 }
 
-bool ServiceDB::StoreIntoSyncPackage(const std::filesystem::path &syncPackagePath)
+bool ServiceDB::StoreIntoSyncPackage(const std::filesystem::path &syncPackagePath, const std::string &requester)
 {
-    const auto &path = syncPackagePath / std::filesystem::path(quotesDB->getName()).filename();
-    if (!quotesDB->storeIntoFile(path)) {
-        LOG_ERROR("Store quotesDB in sync package failed");
-        return false;
-    }
-    return true;
+    return startSyncPackage({quotesDB.get()}, syncPackagePath, requester);
 }
@@ -37,7 +37,7 @@ class ServiceDB : public ServiceDBCommon
     sys::MessagePointer DataReceivedHandler(sys::DataMessage *msgl, sys::ResponseMessage *resp) override;
     sys::ReturnCodes InitHandler() override;
 
-    bool StoreIntoSyncPackage(const std::filesystem::path &syncPackagePath);
+    bool StoreIntoSyncPackage(const std::filesystem::path &syncPackagePath, const std::string &requester);
 };
 
 namespace sys
@@ -227,7 +227,7 @@ sys::MessagePointer ServiceDB::DataReceivedHandler(sys::DataMessage *msgl, sys::
     case MessageType::DBSyncPackage: {
         auto time   = utils::time::Scoped("DBSyncPackage");
         auto msg    = static_cast<DBServiceMessageSyncPackage *>(msgl);
-        auto ret    = StoreIntoSyncPackage({msg->syncPackagePath});
+        auto ret    = StoreIntoSyncPackage({msg->syncPackagePath}, msg->sender);
         responseMsg = std::make_shared<DBServiceResponseMessage>(ret);
     } break;
 
@@ -261,6 +261,19 @@ sys::ReturnCodes ServiceDB::InitHandler()
     multimediaFilesDB  = std::make_unique<db::multimedia_files::MultimediaFilesDB>(
         (purefs::dir::getDatabasesPath() / "multimedia.db").c_str());
 
+    for (const auto database : std::initializer_list<Database *>{eventsDB.get(),
+                                                                 contactsDB.get(),
+                                                                 smsDB.get(),
+                                                                 notesDB.get(),
+                                                                 calllogDB.get(),
+                                                                 notificationsDB.get(),
+                                                                 predefinedQuotesDB.get(),
+                                                                 customQuotesDB.get(),
+                                                                 multimediaFilesDB.get()}) {
+        scheduleIntegrityCheck(database);
+        enableIdleCheckpoints(database);
+    }
+
     // Create record interfaces
     alarmEventRecordInterface  = std::make_unique<AlarmEventRecordInterface>(eventsDB.get());
     contactRecordInterface     = std::make_unique<ContactRecordInterface>(contactsDB.get());
@@ -280,6 +293,8 @@ sys::ReturnCodes ServiceDB::InitHandler()
 
     for (auto &dbAgent : databaseAgents) {
         dbAgent->registerMessages();
+        scheduleIntegrityCheck(dbAgent->getDatabase());
+        enableIdleCheckpoints(dbAgent->getDatabase());
     }
 
     auto settings = std::make_unique<settings::Settings>();
@@ -300,17 +315,7 @@ sys::ReturnCodes ServiceDB::InitHandler()
     return sys::ReturnCodes::Success;
 }
 
-bool ServiceDB::StoreIntoSyncPackage(const std::filesystem::path &syncPackagePath)
+bool ServiceDB::StoreIntoSyncPackage(const std::filesystem::path &syncPackagePath, const std::string &requester)
 {
-    if (!contactsDB->storeIntoFile(syncPackagePath / std::filesystem::path(contactsDB->getName()).filename())) {
-        LOG_ERROR("Store contactsDB in sync package failed");
-        return false;
-    }
-
-    if (!smsDB->storeIntoFile(syncPackagePath / std::filesystem::path(smsDB->getName()).filename())) {
-        LOG_ERROR("Store smsDB in sync package failed");
-        return false;
-    }
-
-    return true;
+    return startSyncPackage({contactsDB.get(), smsDB.get()}, syncPackagePath, requester);
 }
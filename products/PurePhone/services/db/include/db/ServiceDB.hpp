@@ -38,7 +38,7 @@ class ServiceDB : public ServiceDBCommon
   public:
     ~ServiceDB() override;
 
-    bool StoreIntoSyncPackage(const std::filesystem::path &syncPackagePath);
+    bool StoreIntoSyncPackage(const std::filesystem::path &syncPackagePath, const std::string &requester);
 
   private:
     std::unique_ptr<EventsDB> eventsDB;
@@ -17,6 +17,7 @@ enum class MessageType
 
     DBServiceNotification, ///< Common service-db notification message.
     DBSyncPackage,
+    DBSyncPackageResult, ///< Sync package databases copied (or failed to)
 
     DBSettingsGet,    ///< get current settings from database
     DBSettingsUpdate, ///< update settings
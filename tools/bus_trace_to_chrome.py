@@ -0,0 +1,168 @@
+#!/usr/bin/python3
+# Copyright (c) 2017-2025, Mudita Sp. z.o.o. All rights reserved.
+# For licensing, see https://github.com/mudita/MuditaOS/blob/master/LICENSE.md
+
+'''
+Converts a message bus trace dump (bus_trace.bin, see module-sys/Service/include/Service/BusTrace.hpp) to the
+Chrome trace event format, which can be opened in chrome://tracing or https://ui.perfetto.dev
+
+Every service is shown as a thread: handling of a message is a slice named after the message type and the time the
+message waited in the mailbox is an async slice in the "mailbox" category.
+
+Usage:
+    bus_trace_to_chrome.py bus_trace.bin -o bus_trace.json [--summary]
+'''
+
+import argparse
+import collections
+import json
+import shutil
+import struct
+import subprocess
+import sys
+
+HEADER = struct.Struct('<4sHHIIHH')
+NAME = struct.Struct('<HH')
+RECORD = struct.Struct('<IIHHHBB')
+
+MAGIC = b'MBTR'
+VERSION = 1
+
+ENQUEUED, DEQUEUED, HANDLED = range(3)
+
+
+def read_names(data, offset, count):
+    names = {}
+    for _ in range(count):
+        name_id, length = NAME.unpack_from(data, offset)
+        offset += NAME.size
+        names[name_id] = data[offset:offset + length].decode('utf-8', errors='replace')
+        offset += length
+    return names, offset
+
+
+def demangle(names):
+    if not names or shutil.which('c++filt') is None:
+        return names
+    ids = list(names.keys())
+    result = subprocess.run(['c++filt', '-t'], input='\n'.join(names[i] for i in ids), capture_output=True, text=True)
+    if result.returncode != 0:
+        return names
+    return dict(zip(ids, result.stdout.splitlines()))
+
+
+def parse(path):
+    with open(path, 'rb') as file:
+        data = file.read()
+
+    magic, version, record_size, frequency, records_count, types_count, services_count = HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != VERSION or record_size != RECORD.size:
+        sys.exit(f'{path}: not a supported bus trace dump')
+
+    types, offset = read_names(data, HEADER.size, types_count)
+    services, offset = read_names(data, offset, services_count)
+
+    records = []
+    wraps = 0
+    previous = None
+    for index in range(records_count):
+        timestamp, uni_id, service, sender, type_id, event, _ = RECORD.unpack_from(data, offset + index * RECORD.size)
+        # Records are stored in order, so a timestamp going back means the counter wrapped around
+        if previous is not None and timestamp < previous:
+            wraps += 1
+        previous = timestamp
+        microseconds = ((wraps << 32) + timestamp) * 1000000 / frequency
+        records.append((microseconds, uni_id, service, sender, type_id, event))
+
+    return demangle(types), services, records
+
+
+def convert(types, services, records):
+    events = [{'name': 'process_name', 'ph': 'M', 'pid': 1, 'args': {'name': 'MuditaOS bus'}}]
+    for service_id, name in services.items():
+        events.append({'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': service_id, 'args': {'name': name}})
+
+    waiting = set()
+    handling = {}
+    for timestamp, uni_id, service, sender, type_id, event in records:
+        name = types.get(type_id, 'unknown')
+        key = (uni_id, service)
+        args = {'sender': services.get(sender, 'unknown'), 'uniID': uni_id}
+        if event == ENQUEUED:
+            events.append({'name': name, 'cat': 'mailbox', 'ph': 'b', 'id': f'{uni_id}:{service}', 'ts': timestamp,
+                           'pid': 1, 'tid': service, 'args': args})
+            waiting.add(key)
+        elif event == DEQUEUED:
+            # The enqueue of the oldest messages might have been overwritten in the ring buffer already
+            if key in waiting:
+                waiting.remove(key)
+                events.append({'name': name, 'cat': 'mailbox', 'ph': 'e', 'id': f'{uni_id}:{service}',
+                               'ts': timestamp, 'pid': 1, 'tid': service})
+            handling[key] = timestamp
+        elif event == HANDLED and key in handling:
+            start = handling.pop(key)
+            events.append({'name': name, 'cat': 'handler', 'ph': 'X', 'ts': start, 'dur': timestamp - start,
+                           'pid': 1, 'tid': service, 'args': args})
+    return {'traceEvents': events, 'displayTimeUnit': 'ms'}
+
+
+def summarize(types, services, records):
+    enqueued = {}
+    dequeued = {}
+    waits = collections.defaultdict(list)
+    handlers = collections.defaultdict(list)
+    by_type = collections.defaultdict(list)
+    sent = collections.Counter()
+
+    for timestamp, uni_id, service, sender, type_id, event in records:
+        key = (uni_id, service)
+        if event == ENQUEUED:
+            enqueued[key] = timestamp
+            sent[sender] += 1
+        elif event == DEQUEUED:
+            dequeued[key] = timestamp
+            if key in enqueued:
+                waits[service].append(timestamp - enqueued.pop(key))
+        elif event == HANDLED and key in dequeued:
+            duration = timestamp - dequeued.pop(key)
+            handlers[service].append(duration)
+            by_type[type_id].append(duration)
+
+    def stats(values):
+        return len(values), sum(values) / len(values) / 1000, max(values) / 1000
+
+    print(f'{"service":32} {"handled":>8} {"mean ms":>8} {"max ms":>8} {"wait ms":>8} {"max wait":>8}')
+    for service in sorted(handlers, key=lambda s: sum(handlers[s]), reverse=True):
+        count, mean, worst = stats(handlers[service])
+        wait_mean, wait_worst = stats(waits[service])[1:] if waits[service] else (0, 0)
+        print(f'{services.get(service, "unknown"):32} {count:8} {mean:8.2f} {worst:8.2f} {wait_mean:8.2f} '
+              f'{wait_worst:8.2f}')
+
+    print(f'\n{"message type":64} {"handled":>8} {"mean ms":>8} {"max ms":>8}')
+    for type_id in sorted(by_type, key=lambda t: sum(by_type[t]), reverse=True)[:20]:
+        count, mean, worst = stats(by_type[type_id])
+        print(f'{types.get(type_id, "unknown")[:64]:64} {count:8} {mean:8.2f} {worst:8.2f}')
+
+    print(f'\n{"sender":32} {"messages":>8}')
+    for sender, count in sent.most_common():
+        print(f'{services.get(sender, "unknown"):32} {count:8}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert MuditaOS bus trace dump to Chrome trace JSON')
+    parser.add_argument('dump', help='bus_trace.bin downloaded from the device')
+    parser.add_argument('-o', '--output', default='bus_trace.json', help='output JSON file')
+    parser.add_argument('--summary', action='store_true', help='print per service and per message type statistics')
+    args = parser.parse_args()
+
+    types, services, records = parse(args.dump)
+    with open(args.output, 'w') as file:
+        json.dump(convert(types, services, records), file)
+    print(f'{len(records)} events written to {args.output}')
+
+    if args.summary:
+        summarize(types, services, records)
+
+
+if __name__ == '__main__':
+    main()